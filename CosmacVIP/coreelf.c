@@ -0,0 +1,14 @@
+//*******************************************************************************************************
+//*******************************************************************************************************
+//
+//      Name:       CoreElf.C
+//      Purpose:    1802 Emulation compiled for the Elf (with Pixie display)
+//      Date:       17th October 2026
+//
+//*******************************************************************************************************
+//*******************************************************************************************************
+
+#define IS_ELF
+#define CPU_CORE    CPU_CoreElf
+
+#include "cpumachine.h"
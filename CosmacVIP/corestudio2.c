@@ -0,0 +1,14 @@
+//*******************************************************************************************************
+//*******************************************************************************************************
+//
+//      Name:       CoreStudio2.C
+//      Purpose:    1802 Emulation compiled for the RCA Studio 2
+//      Date:       17th October 2026
+//
+//*******************************************************************************************************
+//*******************************************************************************************************
+
+#define IS_STUDIO2
+#define CPU_CORE    CPU_CoreStudio2
+
+#include "cpumachine.h"
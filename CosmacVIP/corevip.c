@@ -0,0 +1,14 @@
+//*******************************************************************************************************
+//*******************************************************************************************************
+//
+//      Name:       CoreVip.C
+//      Purpose:    1802 Emulation compiled for the RCA Cosmac VIP
+//      Date:       17th October 2026
+//
+//*******************************************************************************************************
+//*******************************************************************************************************
+
+#define IS_COSMACVIP
+#define CPU_CORE    CPU_CoreCosmacVip
+
+#include "cpumachine.h"
@@ -14,13 +14,180 @@
 
 #include "general.h"
 
-BYTE8 CPU_Execute();
-void CPU_Reset(BYTE8 *ramMemoryAddress,WORD16 ramSize);
-BYTE8  CPU_ReadMemory(WORD16 address);
-void CPU_WriteMemory(WORD16 address,BYTE8 data);
-BYTE8 *CPU_GetScreenMemoryAddress();
-WORD16 CPU_ReadProgramCounter();
-BYTE8 CPU_GetScreenScrollOffset();
+struct _CPU1802_CORE;
+
+typedef struct _CPU1802_EVENT
+{
+    unsigned long when;                                                             // Cycle it is due on
+    BYTE8 type;                                                                     // What it is (see cpumachine.h)
+} CPU1802EVENT;
+
+#define CPU_EVENT_MAX       (8)                                                     // Most events pending at once
+
+#define CPU_DISPLAY_LINES   (128)                                                   // Lines the 1861 fetches each frame
+#define CPU_DISPLAY_BYTES   (8)                                                     // and bytes in each line
+
+//*******************************************************************************************************
+//      Machine context. Everything one emulated machine needs lives here so that any number of them
+//      can run side by side. The hot state used on every instruction is kept in the first cache line.
+//*******************************************************************************************************
+
+typedef struct _CPU1802_MACHINE
+{
+    WORD16 R[16];                                                                   // 1802 16 bit registers
+    BYTE8 D,X,P,T;                                                                  // 1802 8 bit registers
+    BYTE8 DF,IE,Q;                                                                  // 1802 1 bit registers
+    BYTE8 State;                                                                    // Frame position state (NOT 1802 internal state)
+    INT16 Cycles;                                                                   // Cycles till the next event
+    WORD16 ramMemorySize;                                                           // RAM Memory Size
+    WORD16 ramMask;                                                                 // Address Mask for ELF2.
+    BYTE8 keyboardLatch;                                                            // Value stored in Keyboard Select Latch (Cosmac VIP/Studio 2) Keyboard Buffer (Elf 2)
+    BYTE8 screenEnabled;                                                            // Screen on (IN 1 on, OUT 1 off)
+    BYTE8 *ramMemory;                                                               // Pointer to RAM Memory
+                                                                                    // ---- end of hot state ----
+    BYTE8 currentKey;                                                               // Current key pressed (for ELF 2)
+    WORD16 breakPoint;                                                              // CPU_Run() stops when R[P] reaches this
+    BYTE8 breakEnabled;                                                             // if this is set.
+    unsigned long eventDeadline;                                                    // Cycle Cycles counts down to
+    BYTE8 eventCount;                                                               // Events pending,
+    CPU1802EVENT events[CPU_EVENT_MAX];                                             // a heap, earliest first (see cpuevents.h)
+    BYTE8 ef1;                                                                      // EF1 from the 1861, set round the display's ends
+    BYTE8 dmaLine;                                                                  // Next line the 1861 fetches, CPU_DISPLAY_LINES if none
+    BYTE8 dmaIdle;                                                                  // Last instruction was IDL, a DMA ends it
+    unsigned long dmaNext;                                                          // Cycle that line is due on
+    WORD16 clockMultiplier;                                                         // 1802 clock as a multiple of the 1861's
+    BYTE8 *readPage[256];                                                           // Host memory behind each 256 byte page,
+    BYTE8 *writePage[256];                                                          // NULL if it must be decoded the long way.
+    BYTE8 openBus[256];                                                             // Page read where nothing is decoded
+    BYTE8 discard[256];                                                             // Page written where there is no RAM
+    BYTE8 display[CPU_DISPLAY_LINES*CPU_DISPLAY_BYTES];                             // Lines fetched by the 1861 this frame
+    WORD16 displayFrom[CPU_DISPLAY_LINES];                                          // Address each line was fetched from
+    unsigned long frameCount;                                                       // Frames ended since it was created
+    unsigned long displayFrame;                                                     // Frame the lines were last fetched in,
+    unsigned long displayBefore;                                                    // the time before that,
+    unsigned long displayChanged;                                                   // and the last they came out different
+    unsigned long pageWritten[256];                                                 // Frame each page was last written in,
+    unsigned long *pageStamp[256];                                                  // the entry stamped by each (mirrors share one)
+    #ifdef BLOCK_CACHE
+    BYTE8 codePage[256];                                                            // Non zero if page has cached blocks in it
+    BYTE8 codeMap[256][32];                                                         // Bit set for each byte of cached code
+    void *blockCache;                                                               // Predecoded blocks (see cpumachine.h)
+    #endif
+    #ifdef STATIC_ROM
+    BYTE8 staticRam;                                                                // Compiled RAM image checked (see cpumachine.h)
+    #endif
+    #ifdef CHIP8_HLE
+    BYTE8 useChip8;                                                                 // Run CHIP-8 instructions natively
+    BYTE8 chip8Code;                                                                // CHIP-8 interpreter checked (see cpuchip8.h)
+    #endif
+    #ifdef STUDIO2_HLE
+    BYTE8 useStudio2;                                                               // Run BIOS instructions natively (see cpustudio2.h)
+    #endif
+    #ifdef ROUTINE_HOOKS
+    BYTE8 useHooks;                                                                 // Run hooked ROM routines natively
+    BYTE8 hookPage[32];                                                             // Bit set for each page with a hook
+    BYTE8 hookCode[8];                                                              // Each hook's image checked (see cpuhooks.h)
+    #endif
+    #ifdef JIT_X86_64
+    BYTE8 useJit;                                                                   // Run hot blocks as x86-64 code
+    void *jit;                                                                      // Translator and its code (see cpujit.h)
+    #endif
+    const struct _CPU1802_CORE *core;                                               // Core compiled for this machine
+    void *allocation;                                                               // Block to free if made by CPU_Create()
+} CACHE_ALIGNED CPU1802MACHINE;
+
+//*******************************************************************************************************
+//      A core is the emulation compiled for one machine (see cpumachine.h). CPU_Create() picks one
+//      and the calls below go through it, so nothing inside tests which machine it is running.
+//*******************************************************************************************************
+
+typedef struct _CPU1802_CORE
+{
+    BYTE8 machine;                                                                  // MACHINE_ it is for
+    CPU1802MACHINE *(*create)(WORD16 ramSize);
+    void (*destroy)(CPU1802MACHINE *cpu);
+    void (*reset)(CPU1802MACHINE *cpu,BYTE8 *ramMemoryAddress,WORD16 ramSize);
+    BYTE8 (*execute)(CPU1802MACHINE *cpu);
+    BYTE8 (*run)(CPU1802MACHINE *cpu,long cycleBudget);
+    BYTE8 (*readMemory)(CPU1802MACHINE *cpu,WORD16 address);
+    void (*writeMemory)(CPU1802MACHINE *cpu,WORD16 address,BYTE8 data);
+    BYTE8 (*setJit)(CPU1802MACHINE *cpu,BYTE8 enable);
+    BYTE8 (*setChip8)(CPU1802MACHINE *cpu,BYTE8 enable);
+    BYTE8 (*setStudio2)(CPU1802MACHINE *cpu,BYTE8 enable);
+    BYTE8 (*setHooks)(CPU1802MACHINE *cpu,BYTE8 enable);
+    void (*restore)(CPU1802MACHINE *cpu,const BYTE8 *ram);
+} CPU1802CORE;
+
+#define CPU_STOP_BUDGET     (0)                                                     // CPU_Run() return values : cycle budget used
+#define CPU_STOP_FRAME      (1)                                                     // frame ended (display finished)
+#define CPU_STOP_BREAK      (2)                                                     // reached the break point
+
+#define CPU_RUN_UNLIMITED   (0x7FFFFFFFL)                                           // Budget to run to the frame end or break
+
+#define CPU_CLOCK_MAX       (1000)                                                  // Fastest 1802 clock, as a multiple
+
+CPU1802MACHINE *CPU_Create(BYTE8 machine,WORD16 ramSize);
+BYTE8 CPU_GetMachine(CPU1802MACHINE *cpu);
+void CPU_Destroy(CPU1802MACHINE *cpu);
+BYTE8 CPU_Execute(CPU1802MACHINE *cpu);
+BYTE8 CPU_Run(CPU1802MACHINE *cpu,long cycleBudget);
+void CPU_SetBreakPoint(CPU1802MACHINE *cpu,WORD16 address);
+void CPU_ClearBreakPoint(CPU1802MACHINE *cpu);
+BYTE8 CPU_SetJit(CPU1802MACHINE *cpu,BYTE8 enable);
+BYTE8 CPU_SetChip8(CPU1802MACHINE *cpu,BYTE8 enable);
+BYTE8 CPU_SetStudio2(CPU1802MACHINE *cpu,BYTE8 enable);
+BYTE8 CPU_SetHooks(CPU1802MACHINE *cpu,BYTE8 enable);
+void CPU_Reset(CPU1802MACHINE *cpu,BYTE8 *ramMemoryAddress,WORD16 ramSize);
+BYTE8  CPU_ReadMemory(CPU1802MACHINE *cpu,WORD16 address);
+void CPU_WriteMemory(CPU1802MACHINE *cpu,WORD16 address,BYTE8 data);
+BYTE8 *CPU_GetScreenMemoryAddress(CPU1802MACHINE *cpu);
+WORD16 CPU_ReadProgramCounter(CPU1802MACHINE *cpu);
+unsigned long CPU_ReadCycleCount(CPU1802MACHINE *cpu);
+unsigned long CPU_ReadFrameCount(CPU1802MACHINE *cpu);
+BOOL CPU_DisplayChanged(CPU1802MACHINE *cpu,unsigned long frame);
+WORD16 CPU_SetClock(CPU1802MACHINE *cpu,WORD16 multiplier);
+
+//*******************************************************************************************************
+//      A saved machine is one flat block, this header followed by the RAM, so it can be copied about
+//      with memcpy() or written straight to a file. It is in the host's byte order and word sizes,
+//      so it is only for loading back into the same build, which the header checks.
+//*******************************************************************************************************
+
+#define CPU_STATE_MAGIC     (0x32303831)                                            // "1802" in the header
+#define CPU_STATE_VERSION   (2)                                                     // Bumped when the layout changes
+
+typedef struct _CPU1802_SAVEDSTATE
+{
+    unsigned long magic;                                                            // CPU_STATE_MAGIC
+    WORD16 version;                                                                 // CPU_STATE_VERSION
+    WORD16 headerSize;                                                              // sizeof(CPU1802SAVEDSTATE)
+    BYTE8 machine;                                                                  // MACHINE_ it was saved from
+    WORD16 ramMemorySize;                                                           // Bytes of RAM after the header
+    WORD16 R[16];                                                                   // 1802 registers
+    BYTE8 D,X,P,T,DF,IE,Q;
+    BYTE8 State;                                                                    // Frame position
+    INT16 Cycles;                                                                   // Cycles till the next event
+    unsigned long eventDeadline;                                                    // Event queue (see cpuevents.h)
+    BYTE8 eventCount;
+    CPU1802EVENT events[CPU_EVENT_MAX];
+    BYTE8 keyboardLatch;                                                            // Keyboard latch and key down
+    BYTE8 currentKey;
+    BYTE8 screenEnabled;                                                            // 1861 state
+    BYTE8 ef1;
+    BYTE8 dmaLine;
+    BYTE8 dmaIdle;
+    unsigned long dmaNext;
+    BYTE8 display[CPU_DISPLAY_LINES*CPU_DISPLAY_BYTES];
+    WORD16 clockMultiplier;                                                         // 1802 clock
+} CPU1802SAVEDSTATE;
+
+long CPU_StateSize(CPU1802MACHINE *cpu);
+long CPU_SaveState(CPU1802MACHINE *cpu,void *buffer,long size);
+BOOL CPU_LoadState(CPU1802MACHINE *cpu,const void *buffer,long size);
+#ifndef ARDUINO_VERSION
+BOOL CPU_SaveStateFile(CPU1802MACHINE *cpu,const char *fileName);
+BOOL CPU_LoadStateFile(CPU1802MACHINE *cpu,const char *fileName);
+#endif
 
 #ifdef CPUSTATECODE
 
@@ -30,7 +197,7 @@ typedef struct _CPU1802_STATE
     int Cycles,State;
 } CPU1802STATE;
 
-CPU1802STATE *CPU_ReadState(CPU1802STATE *s);
+CPU1802STATE *CPU_ReadState(CPU1802MACHINE *cpu,CPU1802STATE *s);
 
 #endif
 
@@ -1,7 +1,7 @@
 /* GENERATED */
 
 case 0x00: /* "idl" */
-    R[P]--;
+    R[P]--;IDLE(2);
     break;
 case 0x01: /* "ldn r1" */
     D = READ(R[1]);
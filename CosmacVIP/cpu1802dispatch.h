@@ -0,0 +1,3 @@
+/* GENERATED */
+
+&&_op00,&&_op01,&&_op02,&&_op03,&&_op04,&&_op05,&&_op06,&&_op07,&&_op08,&&_op09,&&_op0a,&&_op0b,&&_op0c,&&_op0d,&&_op0e,&&_op0f,&&_op10,&&_op11,&&_op12,&&_op13,&&_op14,&&_op15,&&_op16,&&_op17,&&_op18,&&_op19,&&_op1a,&&_op1b,&&_op1c,&&_op1d,&&_op1e,&&_op1f,&&_op20,&&_op21,&&_op22,&&_op23,&&_op24,&&_op25,&&_op26,&&_op27,&&_op28,&&_op29,&&_op2a,&&_op2b,&&_op2c,&&_op2d,&&_op2e,&&_op2f,&&_op30,&&_op31,&&_op32,&&_op33,&&_op34,&&_op35,&&_op36,&&_op37,&&_op38,&&_op39,&&_op3a,&&_op3b,&&_op3c,&&_op3d,&&_op3e,&&_op3f,&&_op40,&&_op41,&&_op42,&&_op43,&&_op44,&&_op45,&&_op46,&&_op47,&&_op48,&&_op49,&&_op4a,&&_op4b,&&_op4c,&&_op4d,&&_op4e,&&_op4f,&&_op50,&&_op51,&&_op52,&&_op53,&&_op54,&&_op55,&&_op56,&&_op57,&&_op58,&&_op59,&&_op5a,&&_op5b,&&_op5c,&&_op5d,&&_op5e,&&_op5f,&&_op60,&&_op61,&&_op62,&&_op63,&&_op64,&&_op65,&&_op66,&&_op67,&&_op68,&&_op69,&&_op6a,&&_op6b,&&_op6c,&&_op6d,&&_op6e,&&_op6f,&&_op70,&&_op71,&&_op72,&&_op73,&&_op74,&&_op75,&&_op76,&&_op77,&&_op78,&&_op79,&&_op7a,&&_op7b,&&_op7c,&&_op7d,&&_op7e,&&_op7f,&&_op80,&&_op81,&&_op82,&&_op83,&&_op84,&&_op85,&&_op86,&&_op87,&&_op88,&&_op89,&&_op8a,&&_op8b,&&_op8c,&&_op8d,&&_op8e,&&_op8f,&&_op90,&&_op91,&&_op92,&&_op93,&&_op94,&&_op95,&&_op96,&&_op97,&&_op98,&&_op99,&&_op9a,&&_op9b,&&_op9c,&&_op9d,&&_op9e,&&_op9f,&&_opa0,&&_opa1,&&_opa2,&&_opa3,&&_opa4,&&_opa5,&&_opa6,&&_opa7,&&_opa8,&&_opa9,&&_opaa,&&_opab,&&_opac,&&_opad,&&_opae,&&_opaf,&&_opb0,&&_opb1,&&_opb2,&&_opb3,&&_opb4,&&_opb5,&&_opb6,&&_opb7,&&_opb8,&&_opb9,&&_opba,&&_opbb,&&_opbc,&&_opbd,&&_opbe,&&_opbf,&&_opc0,&&_opc1,&&_opc2,&&_opc3,&&_opc4,&&_opc5,&&_opc6,&&_opc7,&&_opc8,&&_opc9,&&_opca,&&_opcb,&&_opcc,&&_opcd,&&_opce,&&_opcf,&&_opd0,&&_opd1,&&_opd2,&&_opd3,&&_opd4,&&_opd5,&&_opd6,&&_opd7,&&_opd8,&&_opd9,&&_opda,&&_opdb,&&_opdc,&&_opdd,&&_opde,&&_opdf,&&_ope0,&&_ope1,&&_ope2,&&_ope3,&&_ope4,&&_ope5,&&_ope6,&&_ope7,&&_ope8,&&_ope9,&&_opea,&&_opeb,&&_opec,&&_oped,&&_opee,&&_opef,&&_opf0,&&_opf1,&&_opf2,&&_opf3,&&_opf4,&&_opf5,&&_opf6,&&_opf7,&&_opf8,&&_opf9,&&_opfa,&&_opfb,&&_opfc,&&_opfd,&&_opfe,&&_opff
\ No newline at end of file
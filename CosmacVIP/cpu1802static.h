@@ -0,0 +1,3104 @@
+/* GENERATED */
+
+#ifdef IS_COSMACVIP
+    static const WORD16 _ranges_chip8[] = { 0x0000,75,0x0070,125,0x00f3,9,0x0105,80,0x0175,126,0x01fc,1,0,0 };
+    static const BYTE8 _image_chip8[] = { 145,187,255,1,178,182,248,207,162,248,129,177,248,70,161,144,180,248,27,164,248,1,181,248,252,165,212,150,183,226,148,188,69,175,246,246,246,246,50,68,249,80,172,143,250,15,249,240,166,5,246,246,246,246,249,240,167,76,179,140,252,15,172,12,163,211,48,27,143,250,15,179,69,48,64,34,105,18,212,0,0,1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,0,124,117,131,139,149,180,183,188,145,235,164,217,112,153,5,6,250,7,190,6,250,63,246,246,246,34,82,7,250,31,254,254,254,241,172,155,188,69,250,15,173,167,248,208,166,147,175,135,50,243,39,74,189,158,174,142,50,164,157,246,189,143,118,175,46,48,152,157,86,22,143,86,22,48,142,0,236,248,208,166,147,167,141,50,217,6,242,45,50,190,248,1,167,70,243,92,2,251,7,50,210,28,6,242,50,206,248,1,167,6,243,92,44,22,140,252,8,172,59,179,248,255,166,135,86,18,212,155,191,248,255,175,147,95,143,50,223,47,48,229,0,66,181,66,165,212,141,167,135,50,172,42,39,48,245,0,0,0,0,0,0,0,0,0,69,163,152,86,212,248,129,188,248,149,172,34,220,18,86,212,6,184,212,6,168,212,100,10,1,230,138,244,170,59,40,154,252,1,186,212,248,129,186,6,250,15,170,10,170,212,230,6,191,147,190,248,27,174,42,26,248,0,90,14,245,59,75,86,10,252,1,90,48,64,78,246,59,60,159,86,42,42,212,0,34,134,82,248,240,167,7,90,135,243,23,26,58,91,18,212,34,134,82,248,240,167,10,87,135,243,23,26,58,107,18,212,21,133,34,115,149,82,37,69,165,134,250,15,181,212,69,230,243,58,130,21,21,212,69,230,243,58,136,212,69,7,48,140,69,7,48,132,230,98,38,69,163,54,136,212,62,136,212,248,240,167,231,69,244,165,134,250,15,59,178,252,1,181,212,69,86,212,69,230,244,86,212,69,250,15,58,196,7,86,212,175,34,248,211,115,143,249,240,82,230,7,210,86,248,255,166,248,0,126,86,212,25,137,174,147,190,153,238,244,86,118,230,244,185,86,69,242,86,212,69,170,134,250,15,186,212,0,0,0,0,0,0,0,0,0,0,0,224,0,75 };
+staticDispatch:
+    switch (R[P])
+    {
+        case 0x8000: goto _s8000;
+        case 0x8008: goto _s8008;
+        case 0x8009: goto _s8009;
+        case 0x800a: goto _s800a;
+        case 0x8012: goto _s8012;
+        case 0x801a: goto _s801a;
+        case 0x801f: goto _s801f;
+        case 0x8022: goto _s8022;
+        case 0x8024: goto _s8024;
+        case 0x8028: goto _s8028;
+        case 0x8029: goto _s8029;
+        case 0x8031: goto _s8031;
+        case 0x803e: goto _s803e;
+        case 0x803f: goto _s803f;
+        case 0x804b: goto _s804b;
+        case 0x8051: goto _s8051;
+        case 0x8072: goto _s8072;
+        case 0x8073: goto _s8073;
+        case 0x8074: goto _s8074;
+        case 0x8075: goto _s8075;
+        case 0x8077: goto _s8077;
+        case 0x8078: goto _s8078;
+        case 0x8079: goto _s8079;
+        case 0x807b: goto _s807b;
+        case 0x807c: goto _s807c;
+        case 0x807f: goto _s807f;
+        case 0x8083: goto _s8083;
+        case 0x8084: goto _s8084;
+        case 0x808c: goto _s808c;
+        case 0x808f: goto _s808f;
+        case 0x8091: goto _s8091;
+        case 0x8097: goto _s8097;
+        case 0x809a: goto _s809a;
+        case 0x809e: goto _s809e;
+        case 0x80a9: goto _s80a9;
+        case 0x80ac: goto _s80ac;
+        case 0x80ad: goto _s80ad;
+        case 0x80b1: goto _s80b1;
+        case 0x80b5: goto _s80b5;
+        case 0x80b9: goto _s80b9;
+        case 0x80bc: goto _s80bc;
+        case 0x80bd: goto _s80bd;
+        case 0x80c0: goto _s80c0;
+        case 0x80c2: goto _s80c2;
+        case 0x80c5: goto _s80c5;
+        case 0x80c8: goto _s80c8;
+        case 0x80c9: goto _s80c9;
+        case 0x80cb: goto _s80cb;
+        case 0x80cf: goto _s80cf;
+        case 0x80d0: goto _s80d0;
+        case 0x80d2: goto _s80d2;
+        case 0x80d6: goto _s80d6;
+        case 0x80db: goto _s80db;
+        case 0x80de: goto _s80de;
+        case 0x80e2: goto _s80e2;
+        case 0x80e3: goto _s80e3;
+        case 0x80e9: goto _s80e9;
+        case 0x80ed: goto _s80ed;
+        case 0x80ef: goto _s80ef;
+        case 0x80f0: goto _s80f0;
+        case 0x80f2: goto _s80f2;
+        case 0x80f4: goto _s80f4;
+        case 0x80f5: goto _s80f5;
+        case 0x80f6: goto _s80f6;
+        case 0x80f7: goto _s80f7;
+        case 0x80f9: goto _s80f9;
+        case 0x8143: goto _s8143;
+        case 0x8144: goto _s8144;
+        case 0x8146: goto _s8146;
+        case 0x8153: goto _s8153;
+        case 0x8160: goto _s8160;
+        case 0x8163: goto _s8163;
+        case 0x8167: goto _s8167;
+        case 0x816a: goto _s816a;
+        case 0x8194: goto _s8194;
+        case 0x8195: goto _s8195;
+        case 0x8198: goto _s8198;
+        case 0x81a1: goto _s81a1;
+        case 0x81a4: goto _s81a4;
+        case 0x81a7: goto _s81a7;
+        case 0x81aa: goto _s81aa;
+        case 0x81ac: goto _s81ac;
+        case 0x81af: goto _s81af;
+        case 0x81b9: goto _s81b9;
+        case 0x81ba: goto _s81ba;
+        case 0x81bb: goto _s81bb;
+        case 0x81c1: goto _s81c1;
+        case 0x81c5: goto _s81c5;
+        case 0x81c6: goto _s81c6;
+        case 0x81cc: goto _s81cc;
+        case 0x81d6: goto _s81d6;
+        case 0x81dc: goto _s81dc;
+        case 0x81dd: goto _s81dd;
+        case 0x81ea: goto _s81ea;
+        case 0x81f0: goto _s81f0;
+        case 0x81f4: goto _s81f4;
+        case 0x81f9: goto _s81f9;
+        case 0x81fb: goto _s81fb;
+    }
+    if (R[P] >= 0x0000 && R[P] < 0x0200 && STATIC_RAM_OK(_image_chip8,0x0000,_ranges_chip8)) switch (R[P])
+    {
+        case 0x0000: goto _s0000;
+        case 0x001b: goto _s001b;
+        case 0x0028: goto _s0028;
+        case 0x0040: goto _s0040;
+        case 0x0042: goto _s0042;
+        case 0x0044: goto _s0044;
+        case 0x0070: goto _s0070;
+        case 0x008e: goto _s008e;
+        case 0x0093: goto _s0093;
+        case 0x0098: goto _s0098;
+        case 0x009b: goto _s009b;
+        case 0x00a4: goto _s00a4;
+        case 0x00ac: goto _s00ac;
+        case 0x00ad: goto _s00ad;
+        case 0x00b3: goto _s00b3;
+        case 0x00b6: goto _s00b6;
+        case 0x00bb: goto _s00bb;
+        case 0x00be: goto _s00be;
+        case 0x00c6: goto _s00c6;
+        case 0x00cb: goto _s00cb;
+        case 0x00ce: goto _s00ce;
+        case 0x00d2: goto _s00d2;
+        case 0x00d9: goto _s00d9;
+        case 0x00df: goto _s00df;
+        case 0x00e0: goto _s00e0;
+        case 0x00e5: goto _s00e5;
+        case 0x00ea: goto _s00ea;
+        case 0x00f3: goto _s00f3;
+        case 0x00f5: goto _s00f5;
+        case 0x00f8: goto _s00f8;
+        case 0x0105: goto _s0105;
+        case 0x010a: goto _s010a;
+        case 0x0112: goto _s0112;
+        case 0x0115: goto _s0115;
+        case 0x0118: goto _s0118;
+        case 0x011b: goto _s011b;
+        case 0x0124: goto _s0124;
+        case 0x0128: goto _s0128;
+        case 0x0129: goto _s0129;
+        case 0x0133: goto _s0133;
+        case 0x013c: goto _s013c;
+        case 0x0140: goto _s0140;
+        case 0x0144: goto _s0144;
+        case 0x014b: goto _s014b;
+        case 0x014f: goto _s014f;
+        case 0x0154: goto _s0154;
+        case 0x0175: goto _s0175;
+        case 0x017c: goto _s017c;
+        case 0x0182: goto _s0182;
+        case 0x0183: goto _s0183;
+        case 0x0184: goto _s0184;
+        case 0x0188: goto _s0188;
+        case 0x018b: goto _s018b;
+        case 0x018c: goto _s018c;
+        case 0x0190: goto _s0190;
+        case 0x0191: goto _s0191;
+        case 0x0195: goto _s0195;
+        case 0x0199: goto _s0199;
+        case 0x01a0: goto _s01a0;
+        case 0x01a1: goto _s01a1;
+        case 0x01a3: goto _s01a3;
+        case 0x01a4: goto _s01a4;
+        case 0x01b0: goto _s01b0;
+        case 0x01b2: goto _s01b2;
+        case 0x01b4: goto _s01b4;
+        case 0x01b7: goto _s01b7;
+        case 0x01bc: goto _s01bc;
+        case 0x01c1: goto _s01c1;
+        case 0x01c4: goto _s01c4;
+        case 0x01d0: goto _s01d0;
+        case 0x01d9: goto _s01d9;
+        case 0x01eb: goto _s01eb;
+        case 0x01f2: goto _s01f2;
+        case 0x01fc: goto _s01fc;
+    }
+    goto staticLeave;
+_s8000:
+    if (Cycles - 12 < limit) goto staticLeave;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x8002;D = 0x80; /* 8000 "ldi .1" */
+    STATIC_FETCH(0xb2);Cycles -= 2;R[P] = 0x8003;R[2] = (R[2] & 0x00FF) | (((WORD16)D) << 8); /* 8002 "phi r2" */
+    if (R[P] != 0x8003) goto staticDispatch;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x8005;D = 0x08; /* 8003 "ldi .1" */
+    STATIC_FETCH(0xa2);Cycles -= 2;R[P] = 0x8006;R[2] = (R[2] & 0xFF00) | D; /* 8005 "plo r2" */
+    if (R[P] != 0x8006) goto staticDispatch;
+    STATIC_FETCH(0xe2);Cycles -= 2;R[P] = 0x8007;X = 2; /* 8006 "sex r2" */
+    STATIC_FETCH(0xd2);Cycles -= 2;R[P] = 0x8008;P = 2; /* 8007 "sep r2" */
+    goto staticDispatch;
+_s8008:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0x64);Cycles -= 2;R[P] = 0x8009;UPDATEIO(4,READ(R[X]));R[X]++; /* 8008 "out 4" */
+    if (R[P] != 0x8009) goto staticDispatch;
+    goto _s8009;
+_s8009:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0x00);Cycles -= 2;R[P] = 0x800a;R[P]--;IDLE(2); /* 8009 "idl" */
+    goto _s8009;
+_s800a:
+    if (Cycles - 12 < limit) goto staticLeave;
+    STATIC_FETCH(0x62);Cycles -= 2;R[P] = 0x800b;UPDATEIO(2,READ(R[X]));R[X]++; /* 800a "out 2" */
+    if (R[P] != 0x800b) goto staticDispatch;
+    STATIC_FETCH(0x0c);Cycles -= 2;R[P] = 0x800c;D = READ(R[12]); /* 800b "ldn rc" */
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x800e;D = 0xff; /* 800c "ldi .1" */
+    STATIC_FETCH(0xa1);Cycles -= 2;R[P] = 0x800f;R[1] = (R[1] & 0xFF00) | D; /* 800e "plo r1" */
+    if (R[P] != 0x800f) goto staticDispatch;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x8011;D = 0x0f; /* 800f "ldi .1" */
+    STATIC_FETCH(0xb1);Cycles -= 2;R[P] = 0x8012;R[1] = (R[1] & 0x00FF) | (((WORD16)D) << 8); /* 8011 "phi r1" */
+    if (R[P] != 0x8012) goto staticDispatch;
+    goto _s8012;
+_s8012:
+    STATIC_ROUTINE();
+    if (Cycles - 10 < limit) goto staticLeave;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x8014;D = 0xaa; /* 8012 "ldi .1" */
+    STATIC_FETCH(0x51);Cycles -= 2;R[P] = 0x8015;WRITE(R[1],D); /* 8014 "str r1" */
+    STATIC_FETCH(0x01);Cycles -= 2;R[P] = 0x8016;D = READ(R[1]); /* 8015 "ldn r1" */
+    STATIC_FETCH(0xfb);Cycles -= 2;R[P] = 0x8018;D = D ^ 0xaa; /* 8016 "xri .1" */
+    STATIC_FETCH(0x32);Cycles -= 2;R[P] = 0x801a;_temp = 0x22; if ((D == 0)) SHORT(_temp); /* 8018 "bz .1" */
+    if (R[P] == 0x8022) goto _s8022;
+    goto _s801a;
+_s801a:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0x91);Cycles -= 2;R[P] = 0x801b;D = (R[1] >> 8) & 0xFF; /* 801a "ghi r1" */
+    STATIC_FETCH(0xff);Cycles -= 2;R[P] = 0x801d;SUB(D,0x01,1); /* 801b "smi .1" */
+    STATIC_FETCH(0x3b);Cycles -= 2;R[P] = 0x801f;_temp = 0x22; if (!((DF != 0))) SHORT(_temp); /* 801d "bnf .1" */
+    if (R[P] == 0x8022) goto _s8022;
+    goto _s801f;
+_s801f:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0xb1);Cycles -= 2;R[P] = 0x8020;R[1] = (R[1] & 0x00FF) | (((WORD16)D) << 8); /* 801f "phi r1" */
+    if (R[P] != 0x8020) goto staticDispatch;
+    STATIC_FETCH(0x30);Cycles -= 2;R[P] = 0x8022;_temp = 0x12;SHORT(_temp); /* 8020 "br .1" */
+    goto _s8012;
+_s8022:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0x36);Cycles -= 2;R[P] = 0x8024;_temp = 0x28; if ((READEFLAG(3) != 0)) SHORT(_temp); /* 8022 "b3 .1" */
+    if (R[P] == 0x8028) goto _s8028;
+    goto _s8024;
+_s8024:
+    if (Cycles - 8 < limit) goto staticLeave;
+    STATIC_FETCH(0x90);Cycles -= 2;R[P] = 0x8025;D = (R[0] >> 8) & 0xFF; /* 8024 "ghi r0" */
+    STATIC_FETCH(0xa0);Cycles -= 2;R[P] = 0x8026;R[0] = (R[0] & 0xFF00) | D; /* 8025 "plo r0" */
+    if (R[P] != 0x8026) goto staticDispatch;
+    STATIC_FETCH(0xe0);Cycles -= 2;R[P] = 0x8027;X = 0; /* 8026 "sex r0" */
+    STATIC_FETCH(0xd0);Cycles -= 2;R[P] = 0x8028;P = 0; /* 8027 "sep r0" */
+    goto staticDispatch;
+_s8028:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0xe1);Cycles -= 2;R[P] = 0x8029;X = 1; /* 8028 "sex r1" */
+    goto _s8029;
+_s8029:
+    if (Cycles - 10 < limit) goto staticLeave;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x802b;D = 0x00; /* 8029 "ldi .1" */
+    STATIC_FETCH(0x73);Cycles -= 2;R[P] = 0x802c;WRITE(R[X],D);R[X]--; /* 802b "stxd" */
+    if (R[P] != 0x802c) goto staticDispatch;
+    STATIC_FETCH(0x81);Cycles -= 2;R[P] = 0x802d;D = R[1] & 0xFF; /* 802c "glo r1" */
+    STATIC_FETCH(0xfb);Cycles -= 2;R[P] = 0x802f;D = D ^ 0xaf; /* 802d "xri .1" */
+    STATIC_FETCH(0x3a);Cycles -= 2;R[P] = 0x8031;_temp = 0x29; if (!((D == 0))) SHORT(_temp); /* 802f "bnz .1" */
+    if (R[P] == 0x8029) goto _s8029;
+    goto _s8031;
+_s8031:
+    if (Cycles - 20 < limit) goto staticLeave;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x8033;D = 0xd2; /* 8031 "ldi .1" */
+    STATIC_FETCH(0x73);Cycles -= 2;R[P] = 0x8034;WRITE(R[X],D);R[X]--; /* 8033 "stxd" */
+    if (R[P] != 0x8034) goto staticDispatch;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x8036;D = 0x9f; /* 8034 "ldi .1" */
+    STATIC_FETCH(0x51);Cycles -= 2;R[P] = 0x8037;WRITE(R[1],D); /* 8036 "str r1" */
+    STATIC_FETCH(0x81);Cycles -= 2;R[P] = 0x8038;D = R[1] & 0xFF; /* 8037 "glo r1" */
+    STATIC_FETCH(0xa0);Cycles -= 2;R[P] = 0x8039;R[0] = (R[0] & 0xFF00) | D; /* 8038 "plo r0" */
+    if (R[P] != 0x8039) goto staticDispatch;
+    STATIC_FETCH(0x91);Cycles -= 2;R[P] = 0x803a;D = (R[1] >> 8) & 0xFF; /* 8039 "ghi r1" */
+    STATIC_FETCH(0xb0);Cycles -= 2;R[P] = 0x803b;R[0] = (R[0] & 0x00FF) | (((WORD16)D) << 8); /* 803a "phi r0" */
+    if (R[P] != 0x803b) goto staticDispatch;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x803d;D = 0xcf; /* 803b "ldi .1" */
+    STATIC_FETCH(0xa1);Cycles -= 2;R[P] = 0x803e;R[1] = (R[1] & 0xFF00) | D; /* 803d "plo r1" */
+    if (R[P] != 0x803e) goto staticDispatch;
+    goto _s803e;
+_s803e:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0xd0);Cycles -= 2;R[P] = 0x803f;P = 0; /* 803e "sep r0" */
+    goto staticDispatch;
+_s803f:
+    if (Cycles - 18 < limit) goto staticLeave;
+    STATIC_FETCH(0x73);Cycles -= 2;R[P] = 0x8040;WRITE(R[X],D);R[X]--; /* 803f "stxd" */
+    if (R[P] != 0x8040) goto staticDispatch;
+    STATIC_FETCH(0x20);Cycles -= 2;R[P] = 0x8041;R[0]--; /* 8040 "dec r0" */
+    if (R[P] != 0x8041) goto staticDispatch;
+    STATIC_FETCH(0x20);Cycles -= 2;R[P] = 0x8042;R[0]--; /* 8041 "dec r0" */
+    if (R[P] != 0x8042) goto staticDispatch;
+    STATIC_FETCH(0x40);Cycles -= 2;R[P] = 0x8043;D = READ(R[0]);R[0]++; /* 8042 "lda r0" */
+    if (R[P] != 0x8043) goto staticDispatch;
+    STATIC_FETCH(0xff);Cycles -= 2;R[P] = 0x8045;SUB(D,0x01,1); /* 8043 "smi .1" */
+    STATIC_FETCH(0x20);Cycles -= 2;R[P] = 0x8046;R[0]--; /* 8045 "dec r0" */
+    if (R[P] != 0x8046) goto staticDispatch;
+    STATIC_FETCH(0x50);Cycles -= 2;R[P] = 0x8047;WRITE(R[0],D); /* 8046 "str r0" */
+    STATIC_FETCH(0xfb);Cycles -= 2;R[P] = 0x8049;D = D ^ 0x82; /* 8047 "xri .1" */
+    STATIC_FETCH(0x3a);Cycles -= 2;R[P] = 0x804b;_temp = 0x3e; if (!((D == 0))) SHORT(_temp); /* 8049 "bnz .1" */
+    if (R[P] == 0x803e) goto _s803e;
+    goto _s804b;
+_s804b:
+    if (Cycles - 10 < limit) goto staticLeave;
+    STATIC_FETCH(0x92);Cycles -= 2;R[P] = 0x804c;D = (R[2] >> 8) & 0xFF; /* 804b "ghi r2" */
+    STATIC_FETCH(0xb3);Cycles -= 2;R[P] = 0x804d;R[3] = (R[3] & 0x00FF) | (((WORD16)D) << 8); /* 804c "phi r3" */
+    if (R[P] != 0x804d) goto staticDispatch;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x804f;D = 0x51; /* 804d "ldi .1" */
+    STATIC_FETCH(0xa3);Cycles -= 2;R[P] = 0x8050;R[3] = (R[3] & 0xFF00) | D; /* 804f "plo r3" */
+    if (R[P] != 0x8050) goto staticDispatch;
+    STATIC_FETCH(0xd3);Cycles -= 2;R[P] = 0x8051;P = 3; /* 8050 "sep r3" */
+    goto staticDispatch;
+_s8051:
+    if (Cycles - 52 < limit) goto staticLeave;
+    STATIC_FETCH(0x90);Cycles -= 2;R[P] = 0x8052;D = (R[0] >> 8) & 0xFF; /* 8051 "ghi r0" */
+    STATIC_FETCH(0xb2);Cycles -= 2;R[P] = 0x8053;R[2] = (R[2] & 0x00FF) | (((WORD16)D) << 8); /* 8052 "phi r2" */
+    if (R[P] != 0x8053) goto staticDispatch;
+    STATIC_FETCH(0xbb);Cycles -= 2;R[P] = 0x8054;R[11] = (R[11] & 0x00FF) | (((WORD16)D) << 8); /* 8053 "phi rb" */
+    if (R[P] != 0x8054) goto staticDispatch;
+    STATIC_FETCH(0xbd);Cycles -= 2;R[P] = 0x8055;R[13] = (R[13] & 0x00FF) | (((WORD16)D) << 8); /* 8054 "phi rd" */
+    if (R[P] != 0x8055) goto staticDispatch;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x8057;D = 0x81; /* 8055 "ldi .1" */
+    STATIC_FETCH(0xb1);Cycles -= 2;R[P] = 0x8058;R[1] = (R[1] & 0x00FF) | (((WORD16)D) << 8); /* 8057 "phi r1" */
+    if (R[P] != 0x8058) goto staticDispatch;
+    STATIC_FETCH(0xb4);Cycles -= 2;R[P] = 0x8059;R[4] = (R[4] & 0x00FF) | (((WORD16)D) << 8); /* 8058 "phi r4" */
+    if (R[P] != 0x8059) goto staticDispatch;
+    STATIC_FETCH(0xb5);Cycles -= 2;R[P] = 0x805a;R[5] = (R[5] & 0x00FF) | (((WORD16)D) << 8); /* 8059 "phi r5" */
+    if (R[P] != 0x805a) goto staticDispatch;
+    STATIC_FETCH(0xb7);Cycles -= 2;R[P] = 0x805b;R[7] = (R[7] & 0x00FF) | (((WORD16)D) << 8); /* 805a "phi r7" */
+    if (R[P] != 0x805b) goto staticDispatch;
+    STATIC_FETCH(0xba);Cycles -= 2;R[P] = 0x805c;R[10] = (R[10] & 0x00FF) | (((WORD16)D) << 8); /* 805b "phi ra" */
+    if (R[P] != 0x805c) goto staticDispatch;
+    STATIC_FETCH(0xbc);Cycles -= 2;R[P] = 0x805d;R[12] = (R[12] & 0x00FF) | (((WORD16)D) << 8); /* 805c "phi rc" */
+    if (R[P] != 0x805d) goto staticDispatch;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x805f;D = 0x46; /* 805d "ldi .1" */
+    STATIC_FETCH(0xa1);Cycles -= 2;R[P] = 0x8060;R[1] = (R[1] & 0xFF00) | D; /* 805f "plo r1" */
+    if (R[P] != 0x8060) goto staticDispatch;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x8062;D = 0xaf; /* 8060 "ldi .1" */
+    STATIC_FETCH(0xa2);Cycles -= 2;R[P] = 0x8063;R[2] = (R[2] & 0xFF00) | D; /* 8062 "plo r2" */
+    if (R[P] != 0x8063) goto staticDispatch;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x8065;D = 0xdd; /* 8063 "ldi .1" */
+    STATIC_FETCH(0xa4);Cycles -= 2;R[P] = 0x8066;R[4] = (R[4] & 0xFF00) | D; /* 8065 "plo r4" */
+    if (R[P] != 0x8066) goto staticDispatch;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x8068;D = 0xc6; /* 8066 "ldi .1" */
+    STATIC_FETCH(0xa5);Cycles -= 2;R[P] = 0x8069;R[5] = (R[5] & 0xFF00) | D; /* 8068 "plo r5" */
+    if (R[P] != 0x8069) goto staticDispatch;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x806b;D = 0xba; /* 8069 "ldi .1" */
+    STATIC_FETCH(0xa7);Cycles -= 2;R[P] = 0x806c;R[7] = (R[7] & 0xFF00) | D; /* 806b "plo r7" */
+    if (R[P] != 0x806c) goto staticDispatch;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x806e;D = 0xa1; /* 806c "ldi .1" */
+    STATIC_FETCH(0xac);Cycles -= 2;R[P] = 0x806f;R[12] = (R[12] & 0xFF00) | D; /* 806e "plo rc" */
+    if (R[P] != 0x806f) goto staticDispatch;
+    STATIC_FETCH(0xe2);Cycles -= 2;R[P] = 0x8070;X = 2; /* 806f "sex r2" */
+    STATIC_FETCH(0x69);Cycles -= 2;R[P] = 0x8071;D = INPUTIO(1);WRITE(R[X],D); /* 8070 "inp 1" */
+    STATIC_FETCH(0xdc);Cycles -= 2;R[P] = 0x8072;P = 12; /* 8071 "sep rc" */
+    goto staticDispatch;
+_s8072:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0xd7);Cycles -= 2;R[P] = 0x8073;P = 7; /* 8072 "sep r7" */
+    goto staticDispatch;
+_s8073:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0xd7);Cycles -= 2;R[P] = 0x8074;P = 7; /* 8073 "sep r7" */
+    goto staticDispatch;
+_s8074:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0xd7);Cycles -= 2;R[P] = 0x8075;P = 7; /* 8074 "sep r7" */
+    goto staticDispatch;
+_s8075:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0xb6);Cycles -= 2;R[P] = 0x8076;R[6] = (R[6] & 0x00FF) | (((WORD16)D) << 8); /* 8075 "phi r6" */
+    if (R[P] != 0x8076) goto staticDispatch;
+    STATIC_FETCH(0xd7);Cycles -= 2;R[P] = 0x8077;P = 7; /* 8076 "sep r7" */
+    goto staticDispatch;
+_s8077:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0xd7);Cycles -= 2;R[P] = 0x8078;P = 7; /* 8077 "sep r7" */
+    goto staticDispatch;
+_s8078:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0xd7);Cycles -= 2;R[P] = 0x8079;P = 7; /* 8078 "sep r7" */
+    goto staticDispatch;
+_s8079:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0xa6);Cycles -= 2;R[P] = 0x807a;R[6] = (R[6] & 0xFF00) | D; /* 8079 "plo r6" */
+    if (R[P] != 0x807a) goto staticDispatch;
+    STATIC_FETCH(0xd4);Cycles -= 2;R[P] = 0x807b;P = 4; /* 807a "sep r4" */
+    goto staticDispatch;
+_s807b:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0xdc);Cycles -= 2;R[P] = 0x807c;P = 12; /* 807b "sep rc" */
+    goto staticDispatch;
+_s807c:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0xbe);Cycles -= 2;R[P] = 0x807d;R[14] = (R[14] & 0x00FF) | (((WORD16)D) << 8); /* 807c "phi re" */
+    if (R[P] != 0x807d) goto staticDispatch;
+    STATIC_FETCH(0x32);Cycles -= 2;R[P] = 0x807f;_temp = 0xf4; if ((D == 0)) SHORT(_temp); /* 807d "bz .1" */
+    if (R[P] == 0x80f4) goto _s80f4;
+    goto _s807f;
+_s807f:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0xfb);Cycles -= 2;R[P] = 0x8081;D = D ^ 0x0a; /* 807f "xri .1" */
+    STATIC_FETCH(0x32);Cycles -= 2;R[P] = 0x8083;_temp = 0xef; if ((D == 0)) SHORT(_temp); /* 8081 "bz .1" */
+    if (R[P] == 0x80ef) goto _s80ef;
+    goto _s8083;
+_s8083:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0xdc);Cycles -= 2;R[P] = 0x8084;P = 12; /* 8083 "sep rc" */
+    goto staticDispatch;
+_s8084:
+    if (Cycles - 12 < limit) goto staticLeave;
+    STATIC_FETCH(0xae);Cycles -= 2;R[P] = 0x8085;R[14] = (R[14] & 0xFF00) | D; /* 8084 "plo re" */
+    if (R[P] != 0x8085) goto staticDispatch;
+    STATIC_FETCH(0x22);Cycles -= 2;R[P] = 0x8086;R[2]--; /* 8085 "dec r2" */
+    if (R[P] != 0x8086) goto staticDispatch;
+    STATIC_FETCH(0x61);Cycles -= 2;R[P] = 0x8087;UPDATEIO(1,READ(R[X]));R[X]++; /* 8086 "out 1" */
+    if (R[P] != 0x8087) goto staticDispatch;
+    STATIC_FETCH(0x9e);Cycles -= 2;R[P] = 0x8088;D = (R[14] >> 8) & 0xFF; /* 8087 "ghi re" */
+    STATIC_FETCH(0xfb);Cycles -= 2;R[P] = 0x808a;D = D ^ 0x0b; /* 8088 "xri .1" */
+    STATIC_FETCH(0x32);Cycles -= 2;R[P] = 0x808c;_temp = 0xc2; if ((D == 0)) SHORT(_temp); /* 808a "bz .1" */
+    if (R[P] == 0x80c2) goto _s80c2;
+    goto _s808c;
+_s808c:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0x9e);Cycles -= 2;R[P] = 0x808d;D = (R[14] >> 8) & 0xFF; /* 808c "ghi re" */
+    STATIC_FETCH(0xfb);Cycles -= 2;R[P] = 0x808f;D = D ^ 0x0f; /* 808d "xri .1" */
+    goto _s808f;
+_s808f:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0x3a);Cycles -= 2;R[P] = 0x8091;_temp = 0x8f; if (!((D == 0))) SHORT(_temp); /* 808f "bnz .1" */
+    if (R[P] == 0x808f) goto _s808f;
+    goto _s8091;
+_s8091:
+    if (Cycles - 8 < limit) goto staticLeave;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x8093;D = 0x6f; /* 8091 "ldi .1" */
+    STATIC_FETCH(0xac);Cycles -= 2;R[P] = 0x8094;R[12] = (R[12] & 0xFF00) | D; /* 8093 "plo rc" */
+    if (R[P] != 0x8094) goto staticDispatch;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x8096;D = 0x40; /* 8094 "ldi .1" */
+    STATIC_FETCH(0xb9);Cycles -= 2;R[P] = 0x8097;R[9] = (R[9] & 0x00FF) | (((WORD16)D) << 8); /* 8096 "phi r9" */
+    if (R[P] != 0x8097) goto staticDispatch;
+    goto _s8097;
+_s8097:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0x93);Cycles -= 2;R[P] = 0x8098;D = (R[3] >> 8) & 0xFF; /* 8097 "ghi r3" */
+    STATIC_FETCH(0xf6);Cycles -= 2;R[P] = 0x8099;DF = D & 1;D = (D >> 1) & 0x7F; /* 8098 "shr" */
+    STATIC_FETCH(0xdc);Cycles -= 2;R[P] = 0x809a;P = 12; /* 8099 "sep rc" */
+    goto staticDispatch;
+_s809a:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0x29);Cycles -= 2;R[P] = 0x809b;R[9]--; /* 809a "dec r9" */
+    if (R[P] != 0x809b) goto staticDispatch;
+    STATIC_FETCH(0x99);Cycles -= 2;R[P] = 0x809c;D = (R[9] >> 8) & 0xFF; /* 809b "ghi r9" */
+    STATIC_FETCH(0x3a);Cycles -= 2;R[P] = 0x809e;_temp = 0x97; if (!((D == 0))) SHORT(_temp); /* 809c "bnz .1" */
+    if (R[P] == 0x8097) goto _s8097;
+    goto _s809e;
+_s809e:
+    if (Cycles - 20 < limit) goto staticLeave;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x80a0;D = 0x10; /* 809e "ldi .1" */
+    STATIC_FETCH(0xa7);Cycles -= 2;R[P] = 0x80a1;R[7] = (R[7] & 0xFF00) | D; /* 80a0 "plo r7" */
+    if (R[P] != 0x80a1) goto staticDispatch;
+    STATIC_FETCH(0xb8);Cycles -= 2;R[P] = 0x80a2;R[8] = (R[8] & 0x00FF) | (((WORD16)D) << 8); /* 80a1 "phi r8" */
+    if (R[P] != 0x80a2) goto staticDispatch;
+    STATIC_FETCH(0x08);Cycles -= 2;R[P] = 0x80a3;D = READ(R[8]); /* 80a2 "ldn r8" */
+    STATIC_FETCH(0xa9);Cycles -= 2;R[P] = 0x80a4;R[9] = (R[9] & 0xFF00) | D; /* 80a3 "plo r9" */
+    if (R[P] != 0x80a4) goto staticDispatch;
+    STATIC_FETCH(0x46);Cycles -= 2;R[P] = 0x80a5;D = READ(R[6]);R[6]++; /* 80a4 "lda r6" */
+    if (R[P] != 0x80a5) goto staticDispatch;
+    STATIC_FETCH(0xb7);Cycles -= 2;R[P] = 0x80a6;R[7] = (R[7] & 0x00FF) | (((WORD16)D) << 8); /* 80a5 "phi r7" */
+    if (R[P] != 0x80a6) goto staticDispatch;
+    STATIC_FETCH(0x93);Cycles -= 2;R[P] = 0x80a7;D = (R[3] >> 8) & 0xFF; /* 80a6 "ghi r3" */
+    STATIC_FETCH(0xfe);Cycles -= 2;R[P] = 0x80a8;DF = (D >> 7); D = D << 1; /* 80a7 "shl" */
+    STATIC_FETCH(0xdc);Cycles -= 2;R[P] = 0x80a9;P = 12; /* 80a8 "sep rc" */
+    goto staticDispatch;
+_s80a9:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0x86);Cycles -= 2;R[P] = 0x80aa;D = R[6] & 0xFF; /* 80a9 "glo r6" */
+    STATIC_FETCH(0x3a);Cycles -= 2;R[P] = 0x80ac;_temp = 0xad; if (!((D == 0))) SHORT(_temp); /* 80aa "bnz .1" */
+    if (R[P] == 0x80ad) goto _s80ad;
+    goto _s80ac;
+_s80ac:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0x2e);Cycles -= 2;R[P] = 0x80ad;R[14]--; /* 80ac "dec re" */
+    if (R[P] != 0x80ad) goto staticDispatch;
+    goto _s80ad;
+_s80ad:
+    if (Cycles - 8 < limit) goto staticLeave;
+    STATIC_FETCH(0x97);Cycles -= 2;R[P] = 0x80ae;D = (R[7] >> 8) & 0xFF; /* 80ad "ghi r7" */
+    STATIC_FETCH(0xf6);Cycles -= 2;R[P] = 0x80af;DF = D & 1;D = (D >> 1) & 0x7F; /* 80ae "shr" */
+    STATIC_FETCH(0xb7);Cycles -= 2;R[P] = 0x80b0;R[7] = (R[7] & 0x00FF) | (((WORD16)D) << 8); /* 80af "phi r7" */
+    if (R[P] != 0x80b0) goto staticDispatch;
+    STATIC_FETCH(0xdc);Cycles -= 2;R[P] = 0x80b1;P = 12; /* 80b0 "sep rc" */
+    goto staticDispatch;
+_s80b1:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0x29);Cycles -= 2;R[P] = 0x80b2;R[9]--; /* 80b1 "dec r9" */
+    if (R[P] != 0x80b2) goto staticDispatch;
+    STATIC_FETCH(0x89);Cycles -= 2;R[P] = 0x80b3;D = R[9] & 0xFF; /* 80b2 "glo r9" */
+    STATIC_FETCH(0x3a);Cycles -= 2;R[P] = 0x80b5;_temp = 0xad; if (!((D == 0))) SHORT(_temp); /* 80b3 "bnz .1" */
+    if (R[P] == 0x80ad) goto _s80ad;
+    goto _s80b5;
+_s80b5:
+    if (Cycles - 8 < limit) goto staticLeave;
+    STATIC_FETCH(0x17);Cycles -= 2;R[P] = 0x80b6;R[7]++; /* 80b5 "inc r7" */
+    if (R[P] != 0x80b6) goto staticDispatch;
+    STATIC_FETCH(0x87);Cycles -= 2;R[P] = 0x80b7;D = R[7] & 0xFF; /* 80b6 "glo r7" */
+    STATIC_FETCH(0xf6);Cycles -= 2;R[P] = 0x80b8;DF = D & 1;D = (D >> 1) & 0x7F; /* 80b7 "shr" */
+    STATIC_FETCH(0xdc);Cycles -= 2;R[P] = 0x80b9;P = 12; /* 80b8 "sep rc" */
+    goto staticDispatch;
+_s80b9:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0x8e);Cycles -= 2;R[P] = 0x80ba;D = R[14] & 0xFF; /* 80b9 "glo re" */
+    STATIC_FETCH(0x3a);Cycles -= 2;R[P] = 0x80bc;_temp = 0x9e; if (!((D == 0))) SHORT(_temp); /* 80ba "bnz .1" */
+    if (R[P] == 0x809e) goto _s809e;
+    goto _s80bc;
+_s80bc:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0xdc);Cycles -= 2;R[P] = 0x80bd;P = 12; /* 80bc "sep rc" */
+    goto staticDispatch;
+_s80bd:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0x69);Cycles -= 2;R[P] = 0x80be;D = INPUTIO(1);WRITE(R[X],D); /* 80bd "inp 1" */
+    STATIC_FETCH(0x26);Cycles -= 2;R[P] = 0x80bf;R[6]--; /* 80be "dec r6" */
+    if (R[P] != 0x80bf) goto staticDispatch;
+    STATIC_FETCH(0xd4);Cycles -= 2;R[P] = 0x80c0;P = 4; /* 80bf "sep r4" */
+    goto staticDispatch;
+_s80c0:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0x30);Cycles -= 2;R[P] = 0x80c2;_temp = 0xc0;SHORT(_temp); /* 80c0 "br .1" */
+    goto _s80c0;
+_s80c2:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x80c4;D = 0x83; /* 80c2 "ldi .1" */
+    STATIC_FETCH(0xac);Cycles -= 2;R[P] = 0x80c5;R[12] = (R[12] & 0xFF00) | D; /* 80c4 "plo rc" */
+    if (R[P] != 0x80c5) goto staticDispatch;
+    goto _s80c5;
+_s80c5:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x80c7;D = 0x0a; /* 80c5 "ldi .1" */
+    STATIC_FETCH(0xb9);Cycles -= 2;R[P] = 0x80c8;R[9] = (R[9] & 0x00FF) | (((WORD16)D) << 8); /* 80c7 "phi r9" */
+    if (R[P] != 0x80c8) goto staticDispatch;
+    goto _s80c8;
+_s80c8:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0xdc);Cycles -= 2;R[P] = 0x80c9;P = 12; /* 80c8 "sep rc" */
+    goto staticDispatch;
+_s80c9:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0x33);Cycles -= 2;R[P] = 0x80cb;_temp = 0xc5; if ((DF != 0)) SHORT(_temp); /* 80c9 "bdf .1" */
+    if (R[P] == 0x80c5) goto _s80c5;
+    goto _s80cb;
+_s80cb:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0x29);Cycles -= 2;R[P] = 0x80cc;R[9]--; /* 80cb "dec r9" */
+    if (R[P] != 0x80cc) goto staticDispatch;
+    STATIC_FETCH(0x99);Cycles -= 2;R[P] = 0x80cd;D = (R[9] >> 8) & 0xFF; /* 80cc "ghi r9" */
+    STATIC_FETCH(0x3a);Cycles -= 2;R[P] = 0x80cf;_temp = 0xc8; if (!((D == 0))) SHORT(_temp); /* 80cd "bnz .1" */
+    if (R[P] == 0x80c8) goto _s80c8;
+    goto _s80cf;
+_s80cf:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0xdc);Cycles -= 2;R[P] = 0x80d0;P = 12; /* 80cf "sep rc" */
+    goto staticDispatch;
+_s80d0:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0x3b);Cycles -= 2;R[P] = 0x80d2;_temp = 0xcf; if (!((DF != 0))) SHORT(_temp); /* 80d0 "bnf .1" */
+    if (R[P] == 0x80cf) goto _s80cf;
+    goto _s80d2;
+_s80d2:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x80d4;D = 0x09; /* 80d2 "ldi .1" */
+    STATIC_FETCH(0xa9);Cycles -= 2;R[P] = 0x80d5;R[9] = (R[9] & 0xFF00) | D; /* 80d4 "plo r9" */
+    if (R[P] != 0x80d5) goto staticDispatch;
+    STATIC_FETCH(0xa7);Cycles -= 2;R[P] = 0x80d6;R[7] = (R[7] & 0xFF00) | D; /* 80d5 "plo r7" */
+    if (R[P] != 0x80d6) goto staticDispatch;
+    goto _s80d6;
+_s80d6:
+    if (Cycles - 10 < limit) goto staticLeave;
+    STATIC_FETCH(0x97);Cycles -= 2;R[P] = 0x80d7;D = (R[7] >> 8) & 0xFF; /* 80d6 "ghi r7" */
+    STATIC_FETCH(0x76);Cycles -= 2;R[P] = 0x80d8;_temp = D & 1;D = ((D >> 1) & 0x7F) | (DF << 7);DF = _temp; /* 80d7 "rshr" */
+    STATIC_FETCH(0xb7);Cycles -= 2;R[P] = 0x80d9;R[7] = (R[7] & 0x00FF) | (((WORD16)D) << 8); /* 80d8 "phi r7" */
+    if (R[P] != 0x80d9) goto staticDispatch;
+    STATIC_FETCH(0x29);Cycles -= 2;R[P] = 0x80da;R[9]--; /* 80d9 "dec r9" */
+    if (R[P] != 0x80da) goto staticDispatch;
+    STATIC_FETCH(0xdc);Cycles -= 2;R[P] = 0x80db;P = 12; /* 80da "sep rc" */
+    goto staticDispatch;
+_s80db:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0x89);Cycles -= 2;R[P] = 0x80dc;D = R[9] & 0xFF; /* 80db "glo r9" */
+    STATIC_FETCH(0x3a);Cycles -= 2;R[P] = 0x80de;_temp = 0xd6; if (!((D == 0))) SHORT(_temp); /* 80dc "bnz .1" */
+    if (R[P] == 0x80d6) goto _s80d6;
+    goto _s80de;
+_s80de:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0x87);Cycles -= 2;R[P] = 0x80df;D = R[7] & 0xFF; /* 80de "glo r7" */
+    STATIC_FETCH(0xf6);Cycles -= 2;R[P] = 0x80e0;DF = D & 1;D = (D >> 1) & 0x7F; /* 80df "shr" */
+    STATIC_FETCH(0x33);Cycles -= 2;R[P] = 0x80e2;_temp = 0xe3; if ((DF != 0)) SHORT(_temp); /* 80e0 "bdf .1" */
+    if (R[P] == 0x80e3) goto _s80e3;
+    goto _s80e2;
+_s80e2:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0x7b);Cycles -= 2;R[P] = 0x80e3;Q = 1;UPDATEIO(0,1); /* 80e2 "seq" */
+    goto _s80e3;
+_s80e3:
+    if (Cycles - 10 < limit) goto staticLeave;
+    STATIC_FETCH(0x97);Cycles -= 2;R[P] = 0x80e4;D = (R[7] >> 8) & 0xFF; /* 80e3 "ghi r7" */
+    STATIC_FETCH(0x56);Cycles -= 2;R[P] = 0x80e5;WRITE(R[6],D); /* 80e4 "str r6" */
+    STATIC_FETCH(0x16);Cycles -= 2;R[P] = 0x80e6;R[6]++; /* 80e5 "inc r6" */
+    if (R[P] != 0x80e6) goto staticDispatch;
+    STATIC_FETCH(0x86);Cycles -= 2;R[P] = 0x80e7;D = R[6] & 0xFF; /* 80e6 "glo r6" */
+    STATIC_FETCH(0x3a);Cycles -= 2;R[P] = 0x80e9;_temp = 0xcf; if (!((D == 0))) SHORT(_temp); /* 80e7 "bnz .1" */
+    if (R[P] == 0x80cf) goto _s80cf;
+    goto _s80e9;
+_s80e9:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0x2e);Cycles -= 2;R[P] = 0x80ea;R[14]--; /* 80e9 "dec re" */
+    if (R[P] != 0x80ea) goto staticDispatch;
+    STATIC_FETCH(0x8e);Cycles -= 2;R[P] = 0x80eb;D = R[14] & 0xFF; /* 80ea "glo re" */
+    STATIC_FETCH(0x3a);Cycles -= 2;R[P] = 0x80ed;_temp = 0xcf; if (!((D == 0))) SHORT(_temp); /* 80eb "bnz .1" */
+    if (R[P] == 0x80cf) goto _s80cf;
+    goto _s80ed;
+_s80ed:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0x30);Cycles -= 2;R[P] = 0x80ef;_temp = 0xbd;SHORT(_temp); /* 80ed "br .1" */
+    goto _s80bd;
+_s80ef:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0xdc);Cycles -= 2;R[P] = 0x80f0;P = 12; /* 80ef "sep rc" */
+    goto staticDispatch;
+_s80f0:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0x16);Cycles -= 2;R[P] = 0x80f1;R[6]++; /* 80f0 "inc r6" */
+    if (R[P] != 0x80f1) goto staticDispatch;
+    STATIC_FETCH(0xd4);Cycles -= 2;R[P] = 0x80f2;P = 4; /* 80f1 "sep r4" */
+    goto staticDispatch;
+_s80f2:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0x30);Cycles -= 2;R[P] = 0x80f4;_temp = 0xef;SHORT(_temp); /* 80f2 "br .1" */
+    goto _s80ef;
+_s80f4:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0xd7);Cycles -= 2;R[P] = 0x80f5;P = 7; /* 80f4 "sep r7" */
+    goto staticDispatch;
+_s80f5:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0xd7);Cycles -= 2;R[P] = 0x80f6;P = 7; /* 80f5 "sep r7" */
+    goto staticDispatch;
+_s80f6:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0xd7);Cycles -= 2;R[P] = 0x80f7;P = 7; /* 80f6 "sep r7" */
+    goto staticDispatch;
+_s80f7:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0x56);Cycles -= 2;R[P] = 0x80f8;WRITE(R[6],D); /* 80f7 "str r6" */
+    STATIC_FETCH(0xd4);Cycles -= 2;R[P] = 0x80f9;P = 4; /* 80f8 "sep r4" */
+    goto staticDispatch;
+_s80f9:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0x16);Cycles -= 2;R[P] = 0x80fa;R[6]++; /* 80f9 "inc r6" */
+    if (R[P] != 0x80fa) goto staticDispatch;
+    STATIC_FETCH(0x30);Cycles -= 2;R[P] = 0x80fc;_temp = 0xf4;SHORT(_temp); /* 80fa "br .1" */
+    goto _s80f4;
+_s8143:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0x7a);Cycles -= 2;R[P] = 0x8144;Q = 0;UPDATEIO(0,0); /* 8143 "req" */
+    goto _s8144;
+_s8144:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0x42);Cycles -= 2;R[P] = 0x8145;D = READ(R[2]);R[2]++; /* 8144 "lda r2" */
+    if (R[P] != 0x8145) goto staticDispatch;
+    STATIC_FETCH(0x70);Cycles -= 2;R[P] = 0x8146;RETURN();IE = 1; /* 8145 "ret" */
+    goto staticDispatch;
+_s8146:
+    if (Cycles - 25 < limit) goto staticLeave;
+    STATIC_FETCH(0x22);Cycles -= 2;R[P] = 0x8147;R[2]--; /* 8146 "dec r2" */
+    if (R[P] != 0x8147) goto staticDispatch;
+    STATIC_FETCH(0x78);Cycles -= 2;R[P] = 0x8148;WRITE(R[X],T); /* 8147 "sav" */
+    STATIC_FETCH(0x22);Cycles -= 2;R[P] = 0x8149;R[2]--; /* 8148 "dec r2" */
+    if (R[P] != 0x8149) goto staticDispatch;
+    STATIC_FETCH(0x52);Cycles -= 2;R[P] = 0x814a;WRITE(R[2],D); /* 8149 "str r2" */
+    STATIC_FETCH(0xc4);Cycles -= 2;R[P] = 0x814b;Cycles--; /* 814a "nop" */
+    STATIC_FETCH(0x19);Cycles -= 2;R[P] = 0x814c;R[9]++; /* 814b "inc r9" */
+    if (R[P] != 0x814c) goto staticDispatch;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x814e;D = 0x00; /* 814c "ldi .1" */
+    STATIC_FETCH(0xa0);Cycles -= 2;R[P] = 0x814f;R[0] = (R[0] & 0xFF00) | D; /* 814e "plo r0" */
+    if (R[P] != 0x814f) goto staticDispatch;
+    STATIC_FETCH(0x9b);Cycles -= 2;R[P] = 0x8150;D = (R[11] >> 8) & 0xFF; /* 814f "ghi rb" */
+    STATIC_FETCH(0xb0);Cycles -= 2;R[P] = 0x8151;R[0] = (R[0] & 0x00FF) | (((WORD16)D) << 8); /* 8150 "phi r0" */
+    if (R[P] != 0x8151) goto staticDispatch;
+    STATIC_FETCH(0xe2);Cycles -= 2;R[P] = 0x8152;X = 2; /* 8151 "sex r2" */
+    STATIC_FETCH(0xe2);Cycles -= 2;R[P] = 0x8153;X = 2; /* 8152 "sex r2" */
+    goto _s8153;
+_s8153:
+    if (Cycles - 24 < limit) goto staticLeave;
+    STATIC_FETCH(0x80);Cycles -= 2;R[P] = 0x8154;D = R[0] & 0xFF; /* 8153 "glo r0" */
+    STATIC_FETCH(0xe2);Cycles -= 2;R[P] = 0x8155;X = 2; /* 8154 "sex r2" */
+    STATIC_FETCH(0xe2);Cycles -= 2;R[P] = 0x8156;X = 2; /* 8155 "sex r2" */
+    STATIC_FETCH(0x20);Cycles -= 2;R[P] = 0x8157;R[0]--; /* 8156 "dec r0" */
+    if (R[P] != 0x8157) goto staticDispatch;
+    STATIC_FETCH(0xa0);Cycles -= 2;R[P] = 0x8158;R[0] = (R[0] & 0xFF00) | D; /* 8157 "plo r0" */
+    if (R[P] != 0x8158) goto staticDispatch;
+    STATIC_FETCH(0xe2);Cycles -= 2;R[P] = 0x8159;X = 2; /* 8158 "sex r2" */
+    STATIC_FETCH(0x20);Cycles -= 2;R[P] = 0x815a;R[0]--; /* 8159 "dec r0" */
+    if (R[P] != 0x815a) goto staticDispatch;
+    STATIC_FETCH(0xa0);Cycles -= 2;R[P] = 0x815b;R[0] = (R[0] & 0xFF00) | D; /* 815a "plo r0" */
+    if (R[P] != 0x815b) goto staticDispatch;
+    STATIC_FETCH(0xe2);Cycles -= 2;R[P] = 0x815c;X = 2; /* 815b "sex r2" */
+    STATIC_FETCH(0x20);Cycles -= 2;R[P] = 0x815d;R[0]--; /* 815c "dec r0" */
+    if (R[P] != 0x815d) goto staticDispatch;
+    STATIC_FETCH(0xa0);Cycles -= 2;R[P] = 0x815e;R[0] = (R[0] & 0xFF00) | D; /* 815d "plo r0" */
+    if (R[P] != 0x815e) goto staticDispatch;
+    STATIC_FETCH(0x3c);Cycles -= 2;R[P] = 0x8160;_temp = 0x53; if (!((READEFLAG(1) != 0))) SHORT(_temp); /* 815e "bn1 .1" */
+    if (R[P] == 0x8153) goto _s8153;
+    goto _s8160;
+_s8160:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0x98);Cycles -= 2;R[P] = 0x8161;D = (R[8] >> 8) & 0xFF; /* 8160 "ghi r8" */
+    STATIC_FETCH(0x32);Cycles -= 2;R[P] = 0x8163;_temp = 0x67; if ((D == 0)) SHORT(_temp); /* 8161 "bz .1" */
+    if (R[P] == 0x8167) goto _s8167;
+    goto _s8163;
+_s8163:
+    if (Cycles - 8 < limit) goto staticLeave;
+    STATIC_FETCH(0xab);Cycles -= 2;R[P] = 0x8164;R[11] = (R[11] & 0xFF00) | D; /* 8163 "plo rb" */
+    if (R[P] != 0x8164) goto staticDispatch;
+    STATIC_FETCH(0x2b);Cycles -= 2;R[P] = 0x8165;R[11]--; /* 8164 "dec rb" */
+    if (R[P] != 0x8165) goto staticDispatch;
+    STATIC_FETCH(0x8b);Cycles -= 2;R[P] = 0x8166;D = R[11] & 0xFF; /* 8165 "glo rb" */
+    STATIC_FETCH(0xb8);Cycles -= 2;R[P] = 0x8167;R[8] = (R[8] & 0x00FF) | (((WORD16)D) << 8); /* 8166 "phi r8" */
+    if (R[P] != 0x8167) goto staticDispatch;
+    goto _s8167;
+_s8167:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0x88);Cycles -= 2;R[P] = 0x8168;D = R[8] & 0xFF; /* 8167 "glo r8" */
+    STATIC_FETCH(0x32);Cycles -= 2;R[P] = 0x816a;_temp = 0x43; if ((D == 0)) SHORT(_temp); /* 8168 "bz .1" */
+    if (R[P] == 0x8143) goto _s8143;
+    goto _s816a;
+_s816a:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0x7b);Cycles -= 2;R[P] = 0x816b;Q = 1;UPDATEIO(0,1); /* 816a "seq" */
+    STATIC_FETCH(0x28);Cycles -= 2;R[P] = 0x816c;R[8]--; /* 816b "dec r8" */
+    if (R[P] != 0x816c) goto staticDispatch;
+    STATIC_FETCH(0x30);Cycles -= 2;R[P] = 0x816e;_temp = 0x44;SHORT(_temp); /* 816c "br .1" */
+    goto _s8144;
+_s8194:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0xd3);Cycles -= 2;R[P] = 0x8195;P = 3; /* 8194 "sep r3" */
+    goto staticDispatch;
+_s8195:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0xe2);Cycles -= 2;R[P] = 0x8196;X = 2; /* 8195 "sex r2" */
+    STATIC_FETCH(0x9c);Cycles -= 2;R[P] = 0x8197;D = (R[12] >> 8) & 0xFF; /* 8196 "ghi rc" */
+    STATIC_FETCH(0xaf);Cycles -= 2;R[P] = 0x8198;R[15] = (R[15] & 0xFF00) | D; /* 8197 "plo rf" */
+    if (R[P] != 0x8198) goto staticDispatch;
+    goto _s8198;
+_s8198:
+    if (Cycles - 16 < limit) goto staticLeave;
+    STATIC_FETCH(0x2f);Cycles -= 2;R[P] = 0x8199;R[15]--; /* 8198 "dec rf" */
+    if (R[P] != 0x8199) goto staticDispatch;
+    STATIC_FETCH(0x22);Cycles -= 2;R[P] = 0x819a;R[2]--; /* 8199 "dec r2" */
+    if (R[P] != 0x819a) goto staticDispatch;
+    STATIC_FETCH(0x8f);Cycles -= 2;R[P] = 0x819b;D = R[15] & 0xFF; /* 819a "glo rf" */
+    STATIC_FETCH(0x52);Cycles -= 2;R[P] = 0x819c;WRITE(R[2],D); /* 819b "str r2" */
+    STATIC_FETCH(0x62);Cycles -= 2;R[P] = 0x819d;UPDATEIO(2,READ(R[X]));R[X]++; /* 819c "out 2" */
+    if (R[P] != 0x819d) goto staticDispatch;
+    STATIC_FETCH(0xe2);Cycles -= 2;R[P] = 0x819e;X = 2; /* 819d "sex r2" */
+    STATIC_FETCH(0xe2);Cycles -= 2;R[P] = 0x819f;X = 2; /* 819e "sex r2" */
+    STATIC_FETCH(0x3e);Cycles -= 2;R[P] = 0x81a1;_temp = 0x98; if (!((READEFLAG(3) != 0))) SHORT(_temp); /* 819f "bn3 .1" */
+    if (R[P] == 0x8198) goto _s8198;
+    goto _s81a1;
+_s81a1:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x81a3;D = 0x04; /* 81a1 "ldi .1" */
+    STATIC_FETCH(0xa8);Cycles -= 2;R[P] = 0x81a4;R[8] = (R[8] & 0xFF00) | D; /* 81a3 "plo r8" */
+    if (R[P] != 0x81a4) goto staticDispatch;
+    goto _s81a4;
+_s81a4:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0x88);Cycles -= 2;R[P] = 0x81a5;D = R[8] & 0xFF; /* 81a4 "glo r8" */
+    STATIC_FETCH(0x3a);Cycles -= 2;R[P] = 0x81a7;_temp = 0xa4; if (!((D == 0))) SHORT(_temp); /* 81a5 "bnz .1" */
+    if (R[P] == 0x81a4) goto _s81a4;
+    goto _s81a7;
+_s81a7:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x81a9;D = 0x04; /* 81a7 "ldi .1" */
+    STATIC_FETCH(0xa8);Cycles -= 2;R[P] = 0x81aa;R[8] = (R[8] & 0xFF00) | D; /* 81a9 "plo r8" */
+    if (R[P] != 0x81aa) goto staticDispatch;
+    goto _s81aa;
+_s81aa:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0x36);Cycles -= 2;R[P] = 0x81ac;_temp = 0xa7; if ((READEFLAG(3) != 0)) SHORT(_temp); /* 81aa "b3 .1" */
+    if (R[P] == 0x81a7) goto _s81a7;
+    goto _s81ac;
+_s81ac:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0x88);Cycles -= 2;R[P] = 0x81ad;D = R[8] & 0xFF; /* 81ac "glo r8" */
+    STATIC_FETCH(0x31);Cycles -= 2;R[P] = 0x81af;_temp = 0xaa; if ((Q != 0)) SHORT(_temp); /* 81ad "bq .1" */
+    if (R[P] == 0x81aa) goto _s81aa;
+    goto _s81af;
+_s81af:
+    if (Cycles - 8 < limit) goto staticLeave;
+    STATIC_FETCH(0x8f);Cycles -= 2;R[P] = 0x81b0;D = R[15] & 0xFF; /* 81af "glo rf" */
+    STATIC_FETCH(0xfa);Cycles -= 2;R[P] = 0x81b2;D = D & 0x0f; /* 81b0 "ani .1" */
+    STATIC_FETCH(0x52);Cycles -= 2;R[P] = 0x81b3;WRITE(R[2],D); /* 81b2 "str r2" */
+    STATIC_FETCH(0x30);Cycles -= 2;R[P] = 0x81b5;_temp = 0x94;SHORT(_temp); /* 81b3 "br .1" */
+    goto _s8194;
+_s81b9:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0xd3);Cycles -= 2;R[P] = 0x81ba;P = 3; /* 81b9 "sep r3" */
+    goto staticDispatch;
+_s81ba:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0xdc);Cycles -= 2;R[P] = 0x81bb;P = 12; /* 81ba "sep rc" */
+    goto staticDispatch;
+_s81bb:
+    if (Cycles - 12 < limit) goto staticLeave;
+    STATIC_FETCH(0xfe);Cycles -= 2;R[P] = 0x81bc;DF = (D >> 7); D = D << 1; /* 81bb "shl" */
+    STATIC_FETCH(0xfe);Cycles -= 2;R[P] = 0x81bd;DF = (D >> 7); D = D << 1; /* 81bc "shl" */
+    STATIC_FETCH(0xfe);Cycles -= 2;R[P] = 0x81be;DF = (D >> 7); D = D << 1; /* 81bd "shl" */
+    STATIC_FETCH(0xfe);Cycles -= 2;R[P] = 0x81bf;DF = (D >> 7); D = D << 1; /* 81be "shl" */
+    STATIC_FETCH(0xae);Cycles -= 2;R[P] = 0x81c0;R[14] = (R[14] & 0xFF00) | D; /* 81bf "plo re" */
+    if (R[P] != 0x81c0) goto staticDispatch;
+    STATIC_FETCH(0xdc);Cycles -= 2;R[P] = 0x81c1;P = 12; /* 81c0 "sep rc" */
+    goto staticDispatch;
+_s81c1:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0x8e);Cycles -= 2;R[P] = 0x81c2;D = R[14] & 0xFF; /* 81c1 "glo re" */
+    STATIC_FETCH(0xf1);Cycles -= 2;R[P] = 0x81c3;D = D | READ(R[X]); /* 81c2 "or" */
+    STATIC_FETCH(0x30);Cycles -= 2;R[P] = 0x81c5;_temp = 0xb9;SHORT(_temp); /* 81c3 "br .1" */
+    goto _s81b9;
+_s81c5:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0xd4);Cycles -= 2;R[P] = 0x81c6;P = 4; /* 81c5 "sep r4" */
+    goto staticDispatch;
+_s81c6:
+    if (Cycles - 10 < limit) goto staticLeave;
+    STATIC_FETCH(0xaa);Cycles -= 2;R[P] = 0x81c7;R[10] = (R[10] & 0xFF00) | D; /* 81c6 "plo ra" */
+    if (R[P] != 0x81c7) goto staticDispatch;
+    STATIC_FETCH(0x0a);Cycles -= 2;R[P] = 0x81c8;D = READ(R[10]); /* 81c7 "ldn ra" */
+    STATIC_FETCH(0xaa);Cycles -= 2;R[P] = 0x81c9;R[10] = (R[10] & 0xFF00) | D; /* 81c8 "plo ra" */
+    if (R[P] != 0x81c9) goto staticDispatch;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x81cb;D = 0x05; /* 81c9 "ldi .1" */
+    STATIC_FETCH(0xaf);Cycles -= 2;R[P] = 0x81cc;R[15] = (R[15] & 0xFF00) | D; /* 81cb "plo rf" */
+    if (R[P] != 0x81cc) goto staticDispatch;
+    goto _s81cc;
+_s81cc:
+    if (Cycles - 16 < limit) goto staticLeave;
+    STATIC_FETCH(0x4a);Cycles -= 2;R[P] = 0x81cd;D = READ(R[10]);R[10]++; /* 81cc "lda ra" */
+    if (R[P] != 0x81cd) goto staticDispatch;
+    STATIC_FETCH(0x5d);Cycles -= 2;R[P] = 0x81ce;WRITE(R[13],D); /* 81cd "str rd" */
+    STATIC_FETCH(0x8d);Cycles -= 2;R[P] = 0x81cf;D = R[13] & 0xFF; /* 81ce "glo rd" */
+    STATIC_FETCH(0xfc);Cycles -= 2;R[P] = 0x81d1;ADD(D,0x08,0); /* 81cf "adi .1" */
+    STATIC_FETCH(0xad);Cycles -= 2;R[P] = 0x81d2;R[13] = (R[13] & 0xFF00) | D; /* 81d1 "plo rd" */
+    if (R[P] != 0x81d2) goto staticDispatch;
+    STATIC_FETCH(0x2f);Cycles -= 2;R[P] = 0x81d3;R[15]--; /* 81d2 "dec rf" */
+    if (R[P] != 0x81d3) goto staticDispatch;
+    STATIC_FETCH(0x8f);Cycles -= 2;R[P] = 0x81d4;D = R[15] & 0xFF; /* 81d3 "glo rf" */
+    STATIC_FETCH(0x3a);Cycles -= 2;R[P] = 0x81d6;_temp = 0xcc; if (!((D == 0))) SHORT(_temp); /* 81d4 "bnz .1" */
+    if (R[P] == 0x81cc) goto _s81cc;
+    goto _s81d6;
+_s81d6:
+    if (Cycles - 8 < limit) goto staticLeave;
+    STATIC_FETCH(0x8d);Cycles -= 2;R[P] = 0x81d7;D = R[13] & 0xFF; /* 81d6 "glo rd" */
+    STATIC_FETCH(0xfc);Cycles -= 2;R[P] = 0x81d9;ADD(D,0xd9,0); /* 81d7 "adi .1" */
+    STATIC_FETCH(0xad);Cycles -= 2;R[P] = 0x81da;R[13] = (R[13] & 0xFF00) | D; /* 81d9 "plo rd" */
+    if (R[P] != 0x81da) goto staticDispatch;
+    STATIC_FETCH(0x30);Cycles -= 2;R[P] = 0x81dc;_temp = 0xc5;SHORT(_temp); /* 81da "br .1" */
+    goto _s81c5;
+_s81dc:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0xd3);Cycles -= 2;R[P] = 0x81dd;P = 3; /* 81dc "sep r3" */
+    goto staticDispatch;
+_s81dd:
+    if (Cycles - 22 < limit) goto staticLeave;
+    STATIC_FETCH(0x22);Cycles -= 2;R[P] = 0x81de;R[2]--; /* 81dd "dec r2" */
+    if (R[P] != 0x81de) goto staticDispatch;
+    STATIC_FETCH(0x06);Cycles -= 2;R[P] = 0x81df;D = READ(R[6]); /* 81de "ldn r6" */
+    STATIC_FETCH(0x73);Cycles -= 2;R[P] = 0x81e0;WRITE(R[X],D);R[X]--; /* 81df "stxd" */
+    if (R[P] != 0x81e0) goto staticDispatch;
+    STATIC_FETCH(0x86);Cycles -= 2;R[P] = 0x81e1;D = R[6] & 0xFF; /* 81e0 "glo r6" */
+    STATIC_FETCH(0x73);Cycles -= 2;R[P] = 0x81e2;WRITE(R[X],D);R[X]--; /* 81e1 "stxd" */
+    if (R[P] != 0x81e2) goto staticDispatch;
+    STATIC_FETCH(0x96);Cycles -= 2;R[P] = 0x81e3;D = (R[6] >> 8) & 0xFF; /* 81e2 "ghi r6" */
+    STATIC_FETCH(0x52);Cycles -= 2;R[P] = 0x81e4;WRITE(R[2],D); /* 81e3 "str r2" */
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x81e6;D = 0x06; /* 81e4 "ldi .1" */
+    STATIC_FETCH(0xae);Cycles -= 2;R[P] = 0x81e7;R[14] = (R[14] & 0xFF00) | D; /* 81e6 "plo re" */
+    if (R[P] != 0x81e7) goto staticDispatch;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x81e9;D = 0xd8; /* 81e7 "ldi .1" */
+    STATIC_FETCH(0xad);Cycles -= 2;R[P] = 0x81ea;R[13] = (R[13] & 0xFF00) | D; /* 81e9 "plo rd" */
+    if (R[P] != 0x81ea) goto staticDispatch;
+    goto _s81ea;
+_s81ea:
+    if (Cycles - 12 < limit) goto staticLeave;
+    STATIC_FETCH(0x02);Cycles -= 2;R[P] = 0x81eb;D = READ(R[2]); /* 81ea "ldn r2" */
+    STATIC_FETCH(0xf6);Cycles -= 2;R[P] = 0x81ec;DF = D & 1;D = (D >> 1) & 0x7F; /* 81eb "shr" */
+    STATIC_FETCH(0xf6);Cycles -= 2;R[P] = 0x81ed;DF = D & 1;D = (D >> 1) & 0x7F; /* 81ec "shr" */
+    STATIC_FETCH(0xf6);Cycles -= 2;R[P] = 0x81ee;DF = D & 1;D = (D >> 1) & 0x7F; /* 81ed "shr" */
+    STATIC_FETCH(0xf6);Cycles -= 2;R[P] = 0x81ef;DF = D & 1;D = (D >> 1) & 0x7F; /* 81ee "shr" */
+    STATIC_FETCH(0xd5);Cycles -= 2;R[P] = 0x81f0;P = 5; /* 81ef "sep r5" */
+    goto staticDispatch;
+_s81f0:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0x42);Cycles -= 2;R[P] = 0x81f1;D = READ(R[2]);R[2]++; /* 81f0 "lda r2" */
+    if (R[P] != 0x81f1) goto staticDispatch;
+    STATIC_FETCH(0xfa);Cycles -= 2;R[P] = 0x81f3;D = D & 0x0f; /* 81f1 "ani .1" */
+    STATIC_FETCH(0xd5);Cycles -= 2;R[P] = 0x81f4;P = 5; /* 81f3 "sep r5" */
+    goto staticDispatch;
+_s81f4:
+    if (Cycles - 8 < limit) goto staticLeave;
+    STATIC_FETCH(0x8e);Cycles -= 2;R[P] = 0x81f5;D = R[14] & 0xFF; /* 81f4 "glo re" */
+    STATIC_FETCH(0xf6);Cycles -= 2;R[P] = 0x81f6;DF = D & 1;D = (D >> 1) & 0x7F; /* 81f5 "shr" */
+    STATIC_FETCH(0xae);Cycles -= 2;R[P] = 0x81f7;R[14] = (R[14] & 0xFF00) | D; /* 81f6 "plo re" */
+    if (R[P] != 0x81f7) goto staticDispatch;
+    STATIC_FETCH(0x32);Cycles -= 2;R[P] = 0x81f9;_temp = 0xdc; if ((D == 0)) SHORT(_temp); /* 81f7 "bz .1" */
+    if (R[P] == 0x81dc) goto _s81dc;
+    goto _s81f9;
+_s81f9:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0x3b);Cycles -= 2;R[P] = 0x81fb;_temp = 0xea; if (!((DF != 0))) SHORT(_temp); /* 81f9 "bnf .1" */
+    if (R[P] == 0x81ea) goto _s81ea;
+    goto _s81fb;
+_s81fb:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0x1d);Cycles -= 2;R[P] = 0x81fc;R[13]++; /* 81fb "inc rd" */
+    if (R[P] != 0x81fc) goto staticDispatch;
+    STATIC_FETCH(0x1d);Cycles -= 2;R[P] = 0x81fd;R[13]++; /* 81fc "inc rd" */
+    if (R[P] != 0x81fd) goto staticDispatch;
+    STATIC_FETCH(0x30);Cycles -= 2;R[P] = 0x81ff;_temp = 0xea;SHORT(_temp); /* 81fd "br .1" */
+    goto _s81ea;
+_s0000:
+    if (Cycles - 40 < limit) goto staticLeave;
+    STATIC_FETCH(0x91);Cycles -= 2;R[P] = 0x0001;D = (R[1] >> 8) & 0xFF; /* 0000 "ghi r1" */
+    STATIC_FETCH(0xbb);Cycles -= 2;R[P] = 0x0002;R[11] = (R[11] & 0x00FF) | (((WORD16)D) << 8); /* 0001 "phi rb" */
+    if (R[P] != 0x0002) goto staticDispatch;
+    STATIC_FETCH(0xff);Cycles -= 2;R[P] = 0x0004;SUB(D,0x01,1); /* 0002 "smi .1" */
+    STATIC_FETCH(0xb2);Cycles -= 2;R[P] = 0x0005;R[2] = (R[2] & 0x00FF) | (((WORD16)D) << 8); /* 0004 "phi r2" */
+    if (R[P] != 0x0005) goto staticDispatch;
+    STATIC_FETCH(0xb6);Cycles -= 2;R[P] = 0x0006;R[6] = (R[6] & 0x00FF) | (((WORD16)D) << 8); /* 0005 "phi r6" */
+    if (R[P] != 0x0006) goto staticDispatch;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x0008;D = 0xcf; /* 0006 "ldi .1" */
+    STATIC_FETCH(0xa2);Cycles -= 2;R[P] = 0x0009;R[2] = (R[2] & 0xFF00) | D; /* 0008 "plo r2" */
+    if (R[P] != 0x0009) goto staticDispatch;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x000b;D = 0x81; /* 0009 "ldi .1" */
+    STATIC_FETCH(0xb1);Cycles -= 2;R[P] = 0x000c;R[1] = (R[1] & 0x00FF) | (((WORD16)D) << 8); /* 000b "phi r1" */
+    if (R[P] != 0x000c) goto staticDispatch;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x000e;D = 0x46; /* 000c "ldi .1" */
+    STATIC_FETCH(0xa1);Cycles -= 2;R[P] = 0x000f;R[1] = (R[1] & 0xFF00) | D; /* 000e "plo r1" */
+    if (R[P] != 0x000f) goto staticDispatch;
+    STATIC_FETCH(0x90);Cycles -= 2;R[P] = 0x0010;D = (R[0] >> 8) & 0xFF; /* 000f "ghi r0" */
+    STATIC_FETCH(0xb4);Cycles -= 2;R[P] = 0x0011;R[4] = (R[4] & 0x00FF) | (((WORD16)D) << 8); /* 0010 "phi r4" */
+    if (R[P] != 0x0011) goto staticDispatch;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x0013;D = 0x1b; /* 0011 "ldi .1" */
+    STATIC_FETCH(0xa4);Cycles -= 2;R[P] = 0x0014;R[4] = (R[4] & 0xFF00) | D; /* 0013 "plo r4" */
+    if (R[P] != 0x0014) goto staticDispatch;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x0016;D = 0x01; /* 0014 "ldi .1" */
+    STATIC_FETCH(0xb5);Cycles -= 2;R[P] = 0x0017;R[5] = (R[5] & 0x00FF) | (((WORD16)D) << 8); /* 0016 "phi r5" */
+    if (R[P] != 0x0017) goto staticDispatch;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x0019;D = 0xfc; /* 0017 "ldi .1" */
+    STATIC_FETCH(0xa5);Cycles -= 2;R[P] = 0x001a;R[5] = (R[5] & 0xFF00) | D; /* 0019 "plo r5" */
+    if (R[P] != 0x001a) goto staticDispatch;
+    STATIC_FETCH(0xd4);Cycles -= 2;R[P] = 0x001b;P = 4; /* 001a "sep r4" */
+    goto staticDispatch;
+_s001b:
+    STATIC_HOOK();
+    if (Cycles - 24 < limit) goto staticLeave;
+    STATIC_FETCH(0x96);Cycles -= 2;R[P] = 0x001c;D = (R[6] >> 8) & 0xFF; /* 001b "ghi r6" */
+    STATIC_FETCH(0xb7);Cycles -= 2;R[P] = 0x001d;R[7] = (R[7] & 0x00FF) | (((WORD16)D) << 8); /* 001c "phi r7" */
+    if (R[P] != 0x001d) goto staticDispatch;
+    STATIC_FETCH(0xe2);Cycles -= 2;R[P] = 0x001e;X = 2; /* 001d "sex r2" */
+    STATIC_FETCH(0x94);Cycles -= 2;R[P] = 0x001f;D = (R[4] >> 8) & 0xFF; /* 001e "ghi r4" */
+    STATIC_FETCH(0xbc);Cycles -= 2;R[P] = 0x0020;R[12] = (R[12] & 0x00FF) | (((WORD16)D) << 8); /* 001f "phi rc" */
+    if (R[P] != 0x0020) goto staticDispatch;
+    STATIC_FETCH(0x45);Cycles -= 2;R[P] = 0x0021;D = READ(R[5]);R[5]++; /* 0020 "lda r5" */
+    if (R[P] != 0x0021) goto staticDispatch;
+    STATIC_FETCH(0xaf);Cycles -= 2;R[P] = 0x0022;R[15] = (R[15] & 0xFF00) | D; /* 0021 "plo rf" */
+    if (R[P] != 0x0022) goto staticDispatch;
+    STATIC_FETCH(0xf6);Cycles -= 2;R[P] = 0x0023;DF = D & 1;D = (D >> 1) & 0x7F; /* 0022 "shr" */
+    STATIC_FETCH(0xf6);Cycles -= 2;R[P] = 0x0024;DF = D & 1;D = (D >> 1) & 0x7F; /* 0023 "shr" */
+    STATIC_FETCH(0xf6);Cycles -= 2;R[P] = 0x0025;DF = D & 1;D = (D >> 1) & 0x7F; /* 0024 "shr" */
+    STATIC_FETCH(0xf6);Cycles -= 2;R[P] = 0x0026;DF = D & 1;D = (D >> 1) & 0x7F; /* 0025 "shr" */
+    STATIC_FETCH(0x32);Cycles -= 2;R[P] = 0x0028;_temp = 0x44; if ((D == 0)) SHORT(_temp); /* 0026 "bz .1" */
+    if (R[P] == 0x0044) goto _s0044;
+    goto _s0028;
+_s0028:
+    if (Cycles - 38 < limit) goto staticLeave;
+    STATIC_FETCH(0xf9);Cycles -= 2;R[P] = 0x002a;D = D | 0x50; /* 0028 "ori .1" */
+    STATIC_FETCH(0xac);Cycles -= 2;R[P] = 0x002b;R[12] = (R[12] & 0xFF00) | D; /* 002a "plo rc" */
+    if (R[P] != 0x002b) goto staticDispatch;
+    STATIC_FETCH(0x8f);Cycles -= 2;R[P] = 0x002c;D = R[15] & 0xFF; /* 002b "glo rf" */
+    STATIC_FETCH(0xfa);Cycles -= 2;R[P] = 0x002e;D = D & 0x0f; /* 002c "ani .1" */
+    STATIC_FETCH(0xf9);Cycles -= 2;R[P] = 0x0030;D = D | 0xf0; /* 002e "ori .1" */
+    STATIC_FETCH(0xa6);Cycles -= 2;R[P] = 0x0031;R[6] = (R[6] & 0xFF00) | D; /* 0030 "plo r6" */
+    if (R[P] != 0x0031) goto staticDispatch;
+    STATIC_FETCH(0x05);Cycles -= 2;R[P] = 0x0032;D = READ(R[5]); /* 0031 "ldn r5" */
+    STATIC_FETCH(0xf6);Cycles -= 2;R[P] = 0x0033;DF = D & 1;D = (D >> 1) & 0x7F; /* 0032 "shr" */
+    STATIC_FETCH(0xf6);Cycles -= 2;R[P] = 0x0034;DF = D & 1;D = (D >> 1) & 0x7F; /* 0033 "shr" */
+    STATIC_FETCH(0xf6);Cycles -= 2;R[P] = 0x0035;DF = D & 1;D = (D >> 1) & 0x7F; /* 0034 "shr" */
+    STATIC_FETCH(0xf6);Cycles -= 2;R[P] = 0x0036;DF = D & 1;D = (D >> 1) & 0x7F; /* 0035 "shr" */
+    STATIC_FETCH(0xf9);Cycles -= 2;R[P] = 0x0038;D = D | 0xf0; /* 0036 "ori .1" */
+    STATIC_FETCH(0xa7);Cycles -= 2;R[P] = 0x0039;R[7] = (R[7] & 0xFF00) | D; /* 0038 "plo r7" */
+    if (R[P] != 0x0039) goto staticDispatch;
+    STATIC_FETCH(0x4c);Cycles -= 2;R[P] = 0x003a;D = READ(R[12]);R[12]++; /* 0039 "lda rc" */
+    if (R[P] != 0x003a) goto staticDispatch;
+    STATIC_FETCH(0xb3);Cycles -= 2;R[P] = 0x003b;R[3] = (R[3] & 0x00FF) | (((WORD16)D) << 8); /* 003a "phi r3" */
+    if (R[P] != 0x003b) goto staticDispatch;
+    STATIC_FETCH(0x8c);Cycles -= 2;R[P] = 0x003c;D = R[12] & 0xFF; /* 003b "glo rc" */
+    STATIC_FETCH(0xfc);Cycles -= 2;R[P] = 0x003e;ADD(D,0x0f,0); /* 003c "adi .1" */
+    STATIC_FETCH(0xac);Cycles -= 2;R[P] = 0x003f;R[12] = (R[12] & 0xFF00) | D; /* 003e "plo rc" */
+    if (R[P] != 0x003f) goto staticDispatch;
+    STATIC_FETCH(0x0c);Cycles -= 2;R[P] = 0x0040;D = READ(R[12]); /* 003f "ldn rc" */
+    goto _s0040;
+_s0040:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0xa3);Cycles -= 2;R[P] = 0x0041;R[3] = (R[3] & 0xFF00) | D; /* 0040 "plo r3" */
+    if (R[P] != 0x0041) goto staticDispatch;
+    STATIC_FETCH(0xd3);Cycles -= 2;R[P] = 0x0042;P = 3; /* 0041 "sep r3" */
+    goto staticDispatch;
+_s0042:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0x30);Cycles -= 2;R[P] = 0x0044;_temp = 0x1b;SHORT(_temp); /* 0042 "br .1" */
+    goto _s001b;
+_s0044:
+    if (Cycles - 10 < limit) goto staticLeave;
+    STATIC_FETCH(0x8f);Cycles -= 2;R[P] = 0x0045;D = R[15] & 0xFF; /* 0044 "glo rf" */
+    STATIC_FETCH(0xfa);Cycles -= 2;R[P] = 0x0047;D = D & 0x0f; /* 0045 "ani .1" */
+    STATIC_FETCH(0xb3);Cycles -= 2;R[P] = 0x0048;R[3] = (R[3] & 0x00FF) | (((WORD16)D) << 8); /* 0047 "phi r3" */
+    if (R[P] != 0x0048) goto staticDispatch;
+    STATIC_FETCH(0x45);Cycles -= 2;R[P] = 0x0049;D = READ(R[5]);R[5]++; /* 0048 "lda r5" */
+    if (R[P] != 0x0049) goto staticDispatch;
+    STATIC_FETCH(0x30);Cycles -= 2;R[P] = 0x004b;_temp = 0x40;SHORT(_temp); /* 0049 "br .1" */
+    goto _s0040;
+_s0070:
+    if (Cycles - 50 < limit) goto staticLeave;
+    STATIC_FETCH(0x06);Cycles -= 2;R[P] = 0x0071;D = READ(R[6]); /* 0070 "ldn r6" */
+    STATIC_FETCH(0xfa);Cycles -= 2;R[P] = 0x0073;D = D & 0x07; /* 0071 "ani .1" */
+    STATIC_FETCH(0xbe);Cycles -= 2;R[P] = 0x0074;R[14] = (R[14] & 0x00FF) | (((WORD16)D) << 8); /* 0073 "phi re" */
+    if (R[P] != 0x0074) goto staticDispatch;
+    STATIC_FETCH(0x06);Cycles -= 2;R[P] = 0x0075;D = READ(R[6]); /* 0074 "ldn r6" */
+    STATIC_FETCH(0xfa);Cycles -= 2;R[P] = 0x0077;D = D & 0x3f; /* 0075 "ani .1" */
+    STATIC_FETCH(0xf6);Cycles -= 2;R[P] = 0x0078;DF = D & 1;D = (D >> 1) & 0x7F; /* 0077 "shr" */
+    STATIC_FETCH(0xf6);Cycles -= 2;R[P] = 0x0079;DF = D & 1;D = (D >> 1) & 0x7F; /* 0078 "shr" */
+    STATIC_FETCH(0xf6);Cycles -= 2;R[P] = 0x007a;DF = D & 1;D = (D >> 1) & 0x7F; /* 0079 "shr" */
+    STATIC_FETCH(0x22);Cycles -= 2;R[P] = 0x007b;R[2]--; /* 007a "dec r2" */
+    if (R[P] != 0x007b) goto staticDispatch;
+    STATIC_FETCH(0x52);Cycles -= 2;R[P] = 0x007c;WRITE(R[2],D); /* 007b "str r2" */
+    if (cpu->staticRam != STATIC_VALID) goto staticDispatch;
+    STATIC_FETCH(0x07);Cycles -= 2;R[P] = 0x007d;D = READ(R[7]); /* 007c "ldn r7" */
+    STATIC_FETCH(0xfa);Cycles -= 2;R[P] = 0x007f;D = D & 0x1f; /* 007d "ani .1" */
+    STATIC_FETCH(0xfe);Cycles -= 2;R[P] = 0x0080;DF = (D >> 7); D = D << 1; /* 007f "shl" */
+    STATIC_FETCH(0xfe);Cycles -= 2;R[P] = 0x0081;DF = (D >> 7); D = D << 1; /* 0080 "shl" */
+    STATIC_FETCH(0xfe);Cycles -= 2;R[P] = 0x0082;DF = (D >> 7); D = D << 1; /* 0081 "shl" */
+    STATIC_FETCH(0xf1);Cycles -= 2;R[P] = 0x0083;D = D | READ(R[X]); /* 0082 "or" */
+    STATIC_FETCH(0xac);Cycles -= 2;R[P] = 0x0084;R[12] = (R[12] & 0xFF00) | D; /* 0083 "plo rc" */
+    if (R[P] != 0x0084) goto staticDispatch;
+    STATIC_FETCH(0x9b);Cycles -= 2;R[P] = 0x0085;D = (R[11] >> 8) & 0xFF; /* 0084 "ghi rb" */
+    STATIC_FETCH(0xbc);Cycles -= 2;R[P] = 0x0086;R[12] = (R[12] & 0x00FF) | (((WORD16)D) << 8); /* 0085 "phi rc" */
+    if (R[P] != 0x0086) goto staticDispatch;
+    STATIC_FETCH(0x45);Cycles -= 2;R[P] = 0x0087;D = READ(R[5]);R[5]++; /* 0086 "lda r5" */
+    if (R[P] != 0x0087) goto staticDispatch;
+    STATIC_FETCH(0xfa);Cycles -= 2;R[P] = 0x0089;D = D & 0x0f; /* 0087 "ani .1" */
+    STATIC_FETCH(0xad);Cycles -= 2;R[P] = 0x008a;R[13] = (R[13] & 0xFF00) | D; /* 0089 "plo rd" */
+    if (R[P] != 0x008a) goto staticDispatch;
+    STATIC_FETCH(0xa7);Cycles -= 2;R[P] = 0x008b;R[7] = (R[7] & 0xFF00) | D; /* 008a "plo r7" */
+    if (R[P] != 0x008b) goto staticDispatch;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x008d;D = 0xd0; /* 008b "ldi .1" */
+    STATIC_FETCH(0xa6);Cycles -= 2;R[P] = 0x008e;R[6] = (R[6] & 0xFF00) | D; /* 008d "plo r6" */
+    if (R[P] != 0x008e) goto staticDispatch;
+    goto _s008e;
+_s008e:
+    if (Cycles - 8 < limit) goto staticLeave;
+    STATIC_FETCH(0x93);Cycles -= 2;R[P] = 0x008f;D = (R[3] >> 8) & 0xFF; /* 008e "ghi r3" */
+    STATIC_FETCH(0xaf);Cycles -= 2;R[P] = 0x0090;R[15] = (R[15] & 0xFF00) | D; /* 008f "plo rf" */
+    if (R[P] != 0x0090) goto staticDispatch;
+    STATIC_FETCH(0x87);Cycles -= 2;R[P] = 0x0091;D = R[7] & 0xFF; /* 0090 "glo r7" */
+    STATIC_FETCH(0x32);Cycles -= 2;R[P] = 0x0093;_temp = 0xf3; if ((D == 0)) SHORT(_temp); /* 0091 "bz .1" */
+    if (R[P] == 0x00f3) goto _s00f3;
+    goto _s0093;
+_s0093:
+    if (Cycles - 10 < limit) goto staticLeave;
+    STATIC_FETCH(0x27);Cycles -= 2;R[P] = 0x0094;R[7]--; /* 0093 "dec r7" */
+    if (R[P] != 0x0094) goto staticDispatch;
+    STATIC_FETCH(0x4a);Cycles -= 2;R[P] = 0x0095;D = READ(R[10]);R[10]++; /* 0094 "lda ra" */
+    if (R[P] != 0x0095) goto staticDispatch;
+    STATIC_FETCH(0xbd);Cycles -= 2;R[P] = 0x0096;R[13] = (R[13] & 0x00FF) | (((WORD16)D) << 8); /* 0095 "phi rd" */
+    if (R[P] != 0x0096) goto staticDispatch;
+    STATIC_FETCH(0x9e);Cycles -= 2;R[P] = 0x0097;D = (R[14] >> 8) & 0xFF; /* 0096 "ghi re" */
+    STATIC_FETCH(0xae);Cycles -= 2;R[P] = 0x0098;R[14] = (R[14] & 0xFF00) | D; /* 0097 "plo re" */
+    if (R[P] != 0x0098) goto staticDispatch;
+    goto _s0098;
+_s0098:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0x8e);Cycles -= 2;R[P] = 0x0099;D = R[14] & 0xFF; /* 0098 "glo re" */
+    STATIC_FETCH(0x32);Cycles -= 2;R[P] = 0x009b;_temp = 0xa4; if ((D == 0)) SHORT(_temp); /* 0099 "bz .1" */
+    if (R[P] == 0x00a4) goto _s00a4;
+    goto _s009b;
+_s009b:
+    if (Cycles - 16 < limit) goto staticLeave;
+    STATIC_FETCH(0x9d);Cycles -= 2;R[P] = 0x009c;D = (R[13] >> 8) & 0xFF; /* 009b "ghi rd" */
+    STATIC_FETCH(0xf6);Cycles -= 2;R[P] = 0x009d;DF = D & 1;D = (D >> 1) & 0x7F; /* 009c "shr" */
+    STATIC_FETCH(0xbd);Cycles -= 2;R[P] = 0x009e;R[13] = (R[13] & 0x00FF) | (((WORD16)D) << 8); /* 009d "phi rd" */
+    if (R[P] != 0x009e) goto staticDispatch;
+    STATIC_FETCH(0x8f);Cycles -= 2;R[P] = 0x009f;D = R[15] & 0xFF; /* 009e "glo rf" */
+    STATIC_FETCH(0x76);Cycles -= 2;R[P] = 0x00a0;_temp = D & 1;D = ((D >> 1) & 0x7F) | (DF << 7);DF = _temp; /* 009f "rshr" */
+    STATIC_FETCH(0xaf);Cycles -= 2;R[P] = 0x00a1;R[15] = (R[15] & 0xFF00) | D; /* 00a0 "plo rf" */
+    if (R[P] != 0x00a1) goto staticDispatch;
+    STATIC_FETCH(0x2e);Cycles -= 2;R[P] = 0x00a2;R[14]--; /* 00a1 "dec re" */
+    if (R[P] != 0x00a2) goto staticDispatch;
+    STATIC_FETCH(0x30);Cycles -= 2;R[P] = 0x00a4;_temp = 0x98;SHORT(_temp); /* 00a2 "br .1" */
+    goto _s0098;
+_s00a4:
+    if (Cycles - 14 < limit) goto staticLeave;
+    STATIC_FETCH(0x9d);Cycles -= 2;R[P] = 0x00a5;D = (R[13] >> 8) & 0xFF; /* 00a4 "ghi rd" */
+    STATIC_FETCH(0x56);Cycles -= 2;R[P] = 0x00a6;WRITE(R[6],D); /* 00a5 "str r6" */
+    if (cpu->staticRam != STATIC_VALID) goto staticDispatch;
+    STATIC_FETCH(0x16);Cycles -= 2;R[P] = 0x00a7;R[6]++; /* 00a6 "inc r6" */
+    if (R[P] != 0x00a7) goto staticDispatch;
+    STATIC_FETCH(0x8f);Cycles -= 2;R[P] = 0x00a8;D = R[15] & 0xFF; /* 00a7 "glo rf" */
+    STATIC_FETCH(0x56);Cycles -= 2;R[P] = 0x00a9;WRITE(R[6],D); /* 00a8 "str r6" */
+    if (cpu->staticRam != STATIC_VALID) goto staticDispatch;
+    STATIC_FETCH(0x16);Cycles -= 2;R[P] = 0x00aa;R[6]++; /* 00a9 "inc r6" */
+    if (R[P] != 0x00aa) goto staticDispatch;
+    STATIC_FETCH(0x30);Cycles -= 2;R[P] = 0x00ac;_temp = 0x8e;SHORT(_temp); /* 00aa "br .1" */
+    goto _s008e;
+_s00ac:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0x00);Cycles -= 2;R[P] = 0x00ad;R[P]--;IDLE(2); /* 00ac "idl" */
+    goto _s00ac;
+_s00ad:
+    STATIC_HOOK();
+    STATIC_ROUTINE();
+    if (Cycles - 10 < limit) goto staticLeave;
+    STATIC_FETCH(0xec);Cycles -= 2;R[P] = 0x00ae;X = 12; /* 00ad "sex rc" */
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x00b0;D = 0xd0; /* 00ae "ldi .1" */
+    STATIC_FETCH(0xa6);Cycles -= 2;R[P] = 0x00b1;R[6] = (R[6] & 0xFF00) | D; /* 00b0 "plo r6" */
+    if (R[P] != 0x00b1) goto staticDispatch;
+    STATIC_FETCH(0x93);Cycles -= 2;R[P] = 0x00b2;D = (R[3] >> 8) & 0xFF; /* 00b1 "ghi r3" */
+    STATIC_FETCH(0xa7);Cycles -= 2;R[P] = 0x00b3;R[7] = (R[7] & 0xFF00) | D; /* 00b2 "plo r7" */
+    if (R[P] != 0x00b3) goto staticDispatch;
+    goto _s00b3;
+_s00b3:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0x8d);Cycles -= 2;R[P] = 0x00b4;D = R[13] & 0xFF; /* 00b3 "glo rd" */
+    STATIC_FETCH(0x32);Cycles -= 2;R[P] = 0x00b6;_temp = 0xd9; if ((D == 0)) SHORT(_temp); /* 00b4 "bz .1" */
+    if (R[P] == 0x00d9) goto _s00d9;
+    goto _s00b6;
+_s00b6:
+    if (Cycles - 8 < limit) goto staticLeave;
+    STATIC_FETCH(0x06);Cycles -= 2;R[P] = 0x00b7;D = READ(R[6]); /* 00b6 "ldn r6" */
+    STATIC_FETCH(0xf2);Cycles -= 2;R[P] = 0x00b8;D = D & READ(R[X]); /* 00b7 "and" */
+    STATIC_FETCH(0x2d);Cycles -= 2;R[P] = 0x00b9;R[13]--; /* 00b8 "dec rd" */
+    if (R[P] != 0x00b9) goto staticDispatch;
+    STATIC_FETCH(0x32);Cycles -= 2;R[P] = 0x00bb;_temp = 0xbe; if ((D == 0)) SHORT(_temp); /* 00b9 "bz .1" */
+    if (R[P] == 0x00be) goto _s00be;
+    goto _s00bb;
+_s00bb:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x00bd;D = 0x01; /* 00bb "ldi .1" */
+    STATIC_FETCH(0xa7);Cycles -= 2;R[P] = 0x00be;R[7] = (R[7] & 0xFF00) | D; /* 00bd "plo r7" */
+    if (R[P] != 0x00be) goto staticDispatch;
+    goto _s00be;
+_s00be:
+    if (Cycles - 12 < limit) goto staticLeave;
+    STATIC_FETCH(0x46);Cycles -= 2;R[P] = 0x00bf;D = READ(R[6]);R[6]++; /* 00be "lda r6" */
+    if (R[P] != 0x00bf) goto staticDispatch;
+    STATIC_FETCH(0xf3);Cycles -= 2;R[P] = 0x00c0;D = D ^ READ(R[X]); /* 00bf "xor" */
+    STATIC_FETCH(0x5c);Cycles -= 2;R[P] = 0x00c1;WRITE(R[12],D); /* 00c0 "str rc" */
+    if (cpu->staticRam != STATIC_VALID) goto staticDispatch;
+    STATIC_FETCH(0x02);Cycles -= 2;R[P] = 0x00c2;D = READ(R[2]); /* 00c1 "ldn r2" */
+    STATIC_FETCH(0xfb);Cycles -= 2;R[P] = 0x00c4;D = D ^ 0x07; /* 00c2 "xri .1" */
+    STATIC_FETCH(0x32);Cycles -= 2;R[P] = 0x00c6;_temp = 0xd2; if ((D == 0)) SHORT(_temp); /* 00c4 "bz .1" */
+    if (R[P] == 0x00d2) goto _s00d2;
+    goto _s00c6;
+_s00c6:
+    if (Cycles - 8 < limit) goto staticLeave;
+    STATIC_FETCH(0x1c);Cycles -= 2;R[P] = 0x00c7;R[12]++; /* 00c6 "inc rc" */
+    if (R[P] != 0x00c7) goto staticDispatch;
+    STATIC_FETCH(0x06);Cycles -= 2;R[P] = 0x00c8;D = READ(R[6]); /* 00c7 "ldn r6" */
+    STATIC_FETCH(0xf2);Cycles -= 2;R[P] = 0x00c9;D = D & READ(R[X]); /* 00c8 "and" */
+    STATIC_FETCH(0x32);Cycles -= 2;R[P] = 0x00cb;_temp = 0xce; if ((D == 0)) SHORT(_temp); /* 00c9 "bz .1" */
+    if (R[P] == 0x00ce) goto _s00ce;
+    goto _s00cb;
+_s00cb:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x00cd;D = 0x01; /* 00cb "ldi .1" */
+    STATIC_FETCH(0xa7);Cycles -= 2;R[P] = 0x00ce;R[7] = (R[7] & 0xFF00) | D; /* 00cd "plo r7" */
+    if (R[P] != 0x00ce) goto staticDispatch;
+    goto _s00ce;
+_s00ce:
+    if (Cycles - 8 < limit) goto staticLeave;
+    STATIC_FETCH(0x06);Cycles -= 2;R[P] = 0x00cf;D = READ(R[6]); /* 00ce "ldn r6" */
+    STATIC_FETCH(0xf3);Cycles -= 2;R[P] = 0x00d0;D = D ^ READ(R[X]); /* 00cf "xor" */
+    STATIC_FETCH(0x5c);Cycles -= 2;R[P] = 0x00d1;WRITE(R[12],D); /* 00d0 "str rc" */
+    if (cpu->staticRam != STATIC_VALID) goto staticDispatch;
+    STATIC_FETCH(0x2c);Cycles -= 2;R[P] = 0x00d2;R[12]--; /* 00d1 "dec rc" */
+    if (R[P] != 0x00d2) goto staticDispatch;
+    goto _s00d2;
+_s00d2:
+    if (Cycles - 10 < limit) goto staticLeave;
+    STATIC_FETCH(0x16);Cycles -= 2;R[P] = 0x00d3;R[6]++; /* 00d2 "inc r6" */
+    if (R[P] != 0x00d3) goto staticDispatch;
+    STATIC_FETCH(0x8c);Cycles -= 2;R[P] = 0x00d4;D = R[12] & 0xFF; /* 00d3 "glo rc" */
+    STATIC_FETCH(0xfc);Cycles -= 2;R[P] = 0x00d6;ADD(D,0x08,0); /* 00d4 "adi .1" */
+    STATIC_FETCH(0xac);Cycles -= 2;R[P] = 0x00d7;R[12] = (R[12] & 0xFF00) | D; /* 00d6 "plo rc" */
+    if (R[P] != 0x00d7) goto staticDispatch;
+    STATIC_FETCH(0x3b);Cycles -= 2;R[P] = 0x00d9;_temp = 0xb3; if (!((DF != 0))) SHORT(_temp); /* 00d7 "bnf .1" */
+    if (R[P] == 0x00b3) goto _s00b3;
+    goto _s00d9;
+_s00d9:
+    if (Cycles - 10 < limit) goto staticLeave;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x00db;D = 0xff; /* 00d9 "ldi .1" */
+    STATIC_FETCH(0xa6);Cycles -= 2;R[P] = 0x00dc;R[6] = (R[6] & 0xFF00) | D; /* 00db "plo r6" */
+    if (R[P] != 0x00dc) goto staticDispatch;
+    STATIC_FETCH(0x87);Cycles -= 2;R[P] = 0x00dd;D = R[7] & 0xFF; /* 00dc "glo r7" */
+    STATIC_FETCH(0x56);Cycles -= 2;R[P] = 0x00de;WRITE(R[6],D); /* 00dd "str r6" */
+    if (cpu->staticRam != STATIC_VALID) goto staticDispatch;
+    STATIC_FETCH(0x12);Cycles -= 2;R[P] = 0x00df;R[2]++; /* 00de "inc r2" */
+    if (R[P] != 0x00df) goto staticDispatch;
+    goto _s00df;
+_s00df:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0xd4);Cycles -= 2;R[P] = 0x00e0;P = 4; /* 00df "sep r4" */
+    goto staticDispatch;
+_s00e0:
+    if (Cycles - 8 < limit) goto staticLeave;
+    STATIC_FETCH(0x9b);Cycles -= 2;R[P] = 0x00e1;D = (R[11] >> 8) & 0xFF; /* 00e0 "ghi rb" */
+    STATIC_FETCH(0xbf);Cycles -= 2;R[P] = 0x00e2;R[15] = (R[15] & 0x00FF) | (((WORD16)D) << 8); /* 00e1 "phi rf" */
+    if (R[P] != 0x00e2) goto staticDispatch;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x00e4;D = 0xff; /* 00e2 "ldi .1" */
+    STATIC_FETCH(0xaf);Cycles -= 2;R[P] = 0x00e5;R[15] = (R[15] & 0xFF00) | D; /* 00e4 "plo rf" */
+    if (R[P] != 0x00e5) goto staticDispatch;
+    goto _s00e5;
+_s00e5:
+    STATIC_ROUTINE();
+    if (Cycles - 8 < limit) goto staticLeave;
+    STATIC_FETCH(0x93);Cycles -= 2;R[P] = 0x00e6;D = (R[3] >> 8) & 0xFF; /* 00e5 "ghi r3" */
+    STATIC_FETCH(0x5f);Cycles -= 2;R[P] = 0x00e7;WRITE(R[15],D); /* 00e6 "str rf" */
+    if (cpu->staticRam != STATIC_VALID) goto staticDispatch;
+    STATIC_FETCH(0x8f);Cycles -= 2;R[P] = 0x00e8;D = R[15] & 0xFF; /* 00e7 "glo rf" */
+    STATIC_FETCH(0x32);Cycles -= 2;R[P] = 0x00ea;_temp = 0xdf; if ((D == 0)) SHORT(_temp); /* 00e8 "bz .1" */
+    if (R[P] == 0x00df) goto _s00df;
+    goto _s00ea;
+_s00ea:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0x2f);Cycles -= 2;R[P] = 0x00eb;R[15]--; /* 00ea "dec rf" */
+    if (R[P] != 0x00eb) goto staticDispatch;
+    STATIC_FETCH(0x30);Cycles -= 2;R[P] = 0x00ed;_temp = 0xe5;SHORT(_temp); /* 00eb "br .1" */
+    goto _s00e5;
+_s00f3:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0x8d);Cycles -= 2;R[P] = 0x00f4;D = R[13] & 0xFF; /* 00f3 "glo rd" */
+    STATIC_FETCH(0xa7);Cycles -= 2;R[P] = 0x00f5;R[7] = (R[7] & 0xFF00) | D; /* 00f4 "plo r7" */
+    if (R[P] != 0x00f5) goto staticDispatch;
+    goto _s00f5;
+_s00f5:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0x87);Cycles -= 2;R[P] = 0x00f6;D = R[7] & 0xFF; /* 00f5 "glo r7" */
+    STATIC_FETCH(0x32);Cycles -= 2;R[P] = 0x00f8;_temp = 0xac; if ((D == 0)) SHORT(_temp); /* 00f6 "bz .1" */
+    if (R[P] == 0x00ac) goto _s00ac;
+    goto _s00f8;
+_s00f8:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0x2a);Cycles -= 2;R[P] = 0x00f9;R[10]--; /* 00f8 "dec ra" */
+    if (R[P] != 0x00f9) goto staticDispatch;
+    STATIC_FETCH(0x27);Cycles -= 2;R[P] = 0x00fa;R[7]--; /* 00f9 "dec r7" */
+    if (R[P] != 0x00fa) goto staticDispatch;
+    STATIC_FETCH(0x30);Cycles -= 2;R[P] = 0x00fc;_temp = 0xf5;SHORT(_temp); /* 00fa "br .1" */
+    goto _s00f5;
+_s0105:
+    if (Cycles - 10 < limit) goto staticLeave;
+    STATIC_FETCH(0x45);Cycles -= 2;R[P] = 0x0106;D = READ(R[5]);R[5]++; /* 0105 "lda r5" */
+    if (R[P] != 0x0106) goto staticDispatch;
+    STATIC_FETCH(0xa3);Cycles -= 2;R[P] = 0x0107;R[3] = (R[3] & 0xFF00) | D; /* 0106 "plo r3" */
+    if (R[P] != 0x0107) goto staticDispatch;
+    STATIC_FETCH(0x98);Cycles -= 2;R[P] = 0x0108;D = (R[8] >> 8) & 0xFF; /* 0107 "ghi r8" */
+    STATIC_FETCH(0x56);Cycles -= 2;R[P] = 0x0109;WRITE(R[6],D); /* 0108 "str r6" */
+    if (cpu->staticRam != STATIC_VALID) goto staticDispatch;
+    STATIC_FETCH(0xd4);Cycles -= 2;R[P] = 0x010a;P = 4; /* 0109 "sep r4" */
+    goto staticDispatch;
+_s010a:
+    if (Cycles - 12 < limit) goto staticLeave;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x010c;D = 0x81; /* 010a "ldi .1" */
+    STATIC_FETCH(0xbc);Cycles -= 2;R[P] = 0x010d;R[12] = (R[12] & 0x00FF) | (((WORD16)D) << 8); /* 010c "phi rc" */
+    if (R[P] != 0x010d) goto staticDispatch;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x010f;D = 0x95; /* 010d "ldi .1" */
+    STATIC_FETCH(0xac);Cycles -= 2;R[P] = 0x0110;R[12] = (R[12] & 0xFF00) | D; /* 010f "plo rc" */
+    if (R[P] != 0x0110) goto staticDispatch;
+    STATIC_FETCH(0x22);Cycles -= 2;R[P] = 0x0111;R[2]--; /* 0110 "dec r2" */
+    if (R[P] != 0x0111) goto staticDispatch;
+    STATIC_FETCH(0xdc);Cycles -= 2;R[P] = 0x0112;P = 12; /* 0111 "sep rc" */
+    goto staticDispatch;
+_s0112:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0x12);Cycles -= 2;R[P] = 0x0113;R[2]++; /* 0112 "inc r2" */
+    if (R[P] != 0x0113) goto staticDispatch;
+    STATIC_FETCH(0x56);Cycles -= 2;R[P] = 0x0114;WRITE(R[6],D); /* 0113 "str r6" */
+    if (cpu->staticRam != STATIC_VALID) goto staticDispatch;
+    STATIC_FETCH(0xd4);Cycles -= 2;R[P] = 0x0115;P = 4; /* 0114 "sep r4" */
+    goto staticDispatch;
+_s0115:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0x06);Cycles -= 2;R[P] = 0x0116;D = READ(R[6]); /* 0115 "ldn r6" */
+    STATIC_FETCH(0xb8);Cycles -= 2;R[P] = 0x0117;R[8] = (R[8] & 0x00FF) | (((WORD16)D) << 8); /* 0116 "phi r8" */
+    if (R[P] != 0x0117) goto staticDispatch;
+    STATIC_FETCH(0xd4);Cycles -= 2;R[P] = 0x0118;P = 4; /* 0117 "sep r4" */
+    goto staticDispatch;
+_s0118:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0x06);Cycles -= 2;R[P] = 0x0119;D = READ(R[6]); /* 0118 "ldn r6" */
+    STATIC_FETCH(0xa8);Cycles -= 2;R[P] = 0x011a;R[8] = (R[8] & 0xFF00) | D; /* 0119 "plo r8" */
+    if (R[P] != 0x011a) goto staticDispatch;
+    STATIC_FETCH(0xd4);Cycles -= 2;R[P] = 0x011b;P = 4; /* 011a "sep r4" */
+    goto staticDispatch;
+_s011b:
+    if (Cycles - 16 < limit) goto staticLeave;
+    STATIC_FETCH(0x64);Cycles -= 2;R[P] = 0x011c;UPDATEIO(4,READ(R[X]));R[X]++; /* 011b "out 4" */
+    if (R[P] != 0x011c) goto staticDispatch;
+    STATIC_FETCH(0x0a);Cycles -= 2;R[P] = 0x011d;D = READ(R[10]); /* 011c "ldn ra" */
+    STATIC_FETCH(0x01);Cycles -= 2;R[P] = 0x011e;D = READ(R[1]); /* 011d "ldn r1" */
+    STATIC_FETCH(0xe6);Cycles -= 2;R[P] = 0x011f;X = 6; /* 011e "sex r6" */
+    STATIC_FETCH(0x8a);Cycles -= 2;R[P] = 0x0120;D = R[10] & 0xFF; /* 011f "glo ra" */
+    STATIC_FETCH(0xf4);Cycles -= 2;R[P] = 0x0121;ADD(D,READ(R[X]),0); /* 0120 "add" */
+    STATIC_FETCH(0xaa);Cycles -= 2;R[P] = 0x0122;R[10] = (R[10] & 0xFF00) | D; /* 0121 "plo ra" */
+    if (R[P] != 0x0122) goto staticDispatch;
+    STATIC_FETCH(0x3b);Cycles -= 2;R[P] = 0x0124;_temp = 0x28; if (!((DF != 0))) SHORT(_temp); /* 0122 "bnf .1" */
+    if (R[P] == 0x0128) goto _s0128;
+    goto _s0124;
+_s0124:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0x9a);Cycles -= 2;R[P] = 0x0125;D = (R[10] >> 8) & 0xFF; /* 0124 "ghi ra" */
+    STATIC_FETCH(0xfc);Cycles -= 2;R[P] = 0x0127;ADD(D,0x01,0); /* 0125 "adi .1" */
+    STATIC_FETCH(0xba);Cycles -= 2;R[P] = 0x0128;R[10] = (R[10] & 0x00FF) | (((WORD16)D) << 8); /* 0127 "phi ra" */
+    if (R[P] != 0x0128) goto staticDispatch;
+    goto _s0128;
+_s0128:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0xd4);Cycles -= 2;R[P] = 0x0129;P = 4; /* 0128 "sep r4" */
+    goto staticDispatch;
+_s0129:
+    if (Cycles - 16 < limit) goto staticLeave;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x012b;D = 0x81; /* 0129 "ldi .1" */
+    STATIC_FETCH(0xba);Cycles -= 2;R[P] = 0x012c;R[10] = (R[10] & 0x00FF) | (((WORD16)D) << 8); /* 012b "phi ra" */
+    if (R[P] != 0x012c) goto staticDispatch;
+    STATIC_FETCH(0x06);Cycles -= 2;R[P] = 0x012d;D = READ(R[6]); /* 012c "ldn r6" */
+    STATIC_FETCH(0xfa);Cycles -= 2;R[P] = 0x012f;D = D & 0x0f; /* 012d "ani .1" */
+    STATIC_FETCH(0xaa);Cycles -= 2;R[P] = 0x0130;R[10] = (R[10] & 0xFF00) | D; /* 012f "plo ra" */
+    if (R[P] != 0x0130) goto staticDispatch;
+    STATIC_FETCH(0x0a);Cycles -= 2;R[P] = 0x0131;D = READ(R[10]); /* 0130 "ldn ra" */
+    STATIC_FETCH(0xaa);Cycles -= 2;R[P] = 0x0132;R[10] = (R[10] & 0xFF00) | D; /* 0131 "plo ra" */
+    if (R[P] != 0x0132) goto staticDispatch;
+    STATIC_FETCH(0xd4);Cycles -= 2;R[P] = 0x0133;P = 4; /* 0132 "sep r4" */
+    goto staticDispatch;
+_s0133:
+    if (Cycles - 16 < limit) goto staticLeave;
+    STATIC_FETCH(0xe6);Cycles -= 2;R[P] = 0x0134;X = 6; /* 0133 "sex r6" */
+    STATIC_FETCH(0x06);Cycles -= 2;R[P] = 0x0135;D = READ(R[6]); /* 0134 "ldn r6" */
+    STATIC_FETCH(0xbf);Cycles -= 2;R[P] = 0x0136;R[15] = (R[15] & 0x00FF) | (((WORD16)D) << 8); /* 0135 "phi rf" */
+    if (R[P] != 0x0136) goto staticDispatch;
+    STATIC_FETCH(0x93);Cycles -= 2;R[P] = 0x0137;D = (R[3] >> 8) & 0xFF; /* 0136 "ghi r3" */
+    STATIC_FETCH(0xbe);Cycles -= 2;R[P] = 0x0138;R[14] = (R[14] & 0x00FF) | (((WORD16)D) << 8); /* 0137 "phi re" */
+    if (R[P] != 0x0138) goto staticDispatch;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x013a;D = 0x1b; /* 0138 "ldi .1" */
+    STATIC_FETCH(0xae);Cycles -= 2;R[P] = 0x013b;R[14] = (R[14] & 0xFF00) | D; /* 013a "plo re" */
+    if (R[P] != 0x013b) goto staticDispatch;
+    STATIC_FETCH(0x2a);Cycles -= 2;R[P] = 0x013c;R[10]--; /* 013b "dec ra" */
+    if (R[P] != 0x013c) goto staticDispatch;
+    goto _s013c;
+_s013c:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0x1a);Cycles -= 2;R[P] = 0x013d;R[10]++; /* 013c "inc ra" */
+    if (R[P] != 0x013d) goto staticDispatch;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x013f;D = 0x00; /* 013d "ldi .1" */
+    STATIC_FETCH(0x5a);Cycles -= 2;R[P] = 0x0140;WRITE(R[10],D); /* 013f "str ra" */
+    if (cpu->staticRam != STATIC_VALID) goto staticDispatch;
+    goto _s0140;
+_s0140:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0x0e);Cycles -= 2;R[P] = 0x0141;D = READ(R[14]); /* 0140 "ldn re" */
+    STATIC_FETCH(0xf5);Cycles -= 2;R[P] = 0x0142;SUB(READ(R[X]),D,1); /* 0141 "sd" */
+    STATIC_FETCH(0x3b);Cycles -= 2;R[P] = 0x0144;_temp = 0x4b; if (!((DF != 0))) SHORT(_temp); /* 0142 "bnf .1" */
+    if (R[P] == 0x014b) goto _s014b;
+    goto _s0144;
+_s0144:
+    if (Cycles - 10 < limit) goto staticLeave;
+    STATIC_FETCH(0x56);Cycles -= 2;R[P] = 0x0145;WRITE(R[6],D); /* 0144 "str r6" */
+    if (cpu->staticRam != STATIC_VALID) goto staticDispatch;
+    STATIC_FETCH(0x0a);Cycles -= 2;R[P] = 0x0146;D = READ(R[10]); /* 0145 "ldn ra" */
+    STATIC_FETCH(0xfc);Cycles -= 2;R[P] = 0x0148;ADD(D,0x01,0); /* 0146 "adi .1" */
+    STATIC_FETCH(0x5a);Cycles -= 2;R[P] = 0x0149;WRITE(R[10],D); /* 0148 "str ra" */
+    if (cpu->staticRam != STATIC_VALID) goto staticDispatch;
+    STATIC_FETCH(0x30);Cycles -= 2;R[P] = 0x014b;_temp = 0x40;SHORT(_temp); /* 0149 "br .1" */
+    goto _s0140;
+_s014b:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0x4e);Cycles -= 2;R[P] = 0x014c;D = READ(R[14]);R[14]++; /* 014b "lda re" */
+    if (R[P] != 0x014c) goto staticDispatch;
+    STATIC_FETCH(0xf6);Cycles -= 2;R[P] = 0x014d;DF = D & 1;D = (D >> 1) & 0x7F; /* 014c "shr" */
+    STATIC_FETCH(0x3b);Cycles -= 2;R[P] = 0x014f;_temp = 0x3c; if (!((DF != 0))) SHORT(_temp); /* 014d "bnf .1" */
+    if (R[P] == 0x013c) goto _s013c;
+    goto _s014f;
+_s014f:
+    if (Cycles - 10 < limit) goto staticLeave;
+    STATIC_FETCH(0x9f);Cycles -= 2;R[P] = 0x0150;D = (R[15] >> 8) & 0xFF; /* 014f "ghi rf" */
+    STATIC_FETCH(0x56);Cycles -= 2;R[P] = 0x0151;WRITE(R[6],D); /* 0150 "str r6" */
+    if (cpu->staticRam != STATIC_VALID) goto staticDispatch;
+    STATIC_FETCH(0x2a);Cycles -= 2;R[P] = 0x0152;R[10]--; /* 0151 "dec ra" */
+    if (R[P] != 0x0152) goto staticDispatch;
+    STATIC_FETCH(0x2a);Cycles -= 2;R[P] = 0x0153;R[10]--; /* 0152 "dec ra" */
+    if (R[P] != 0x0153) goto staticDispatch;
+    STATIC_FETCH(0xd4);Cycles -= 2;R[P] = 0x0154;P = 4; /* 0153 "sep r4" */
+    goto staticDispatch;
+_s0154:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0x00);Cycles -= 2;R[P] = 0x0155;R[P]--;IDLE(2); /* 0154 "idl" */
+    goto _s0154;
+_s0175:
+    if (Cycles - 14 < limit) goto staticLeave;
+    STATIC_FETCH(0x15);Cycles -= 2;R[P] = 0x0176;R[5]++; /* 0175 "inc r5" */
+    if (R[P] != 0x0176) goto staticDispatch;
+    STATIC_FETCH(0x85);Cycles -= 2;R[P] = 0x0177;D = R[5] & 0xFF; /* 0176 "glo r5" */
+    STATIC_FETCH(0x22);Cycles -= 2;R[P] = 0x0178;R[2]--; /* 0177 "dec r2" */
+    if (R[P] != 0x0178) goto staticDispatch;
+    STATIC_FETCH(0x73);Cycles -= 2;R[P] = 0x0179;WRITE(R[X],D);R[X]--; /* 0178 "stxd" */
+    if (R[P] != 0x0179) goto staticDispatch;
+    if (cpu->staticRam != STATIC_VALID) goto staticDispatch;
+    STATIC_FETCH(0x95);Cycles -= 2;R[P] = 0x017a;D = (R[5] >> 8) & 0xFF; /* 0179 "ghi r5" */
+    STATIC_FETCH(0x52);Cycles -= 2;R[P] = 0x017b;WRITE(R[2],D); /* 017a "str r2" */
+    if (cpu->staticRam != STATIC_VALID) goto staticDispatch;
+    STATIC_FETCH(0x25);Cycles -= 2;R[P] = 0x017c;R[5]--; /* 017b "dec r5" */
+    if (R[P] != 0x017c) goto staticDispatch;
+    goto _s017c;
+_s017c:
+    if (Cycles - 10 < limit) goto staticLeave;
+    STATIC_FETCH(0x45);Cycles -= 2;R[P] = 0x017d;D = READ(R[5]);R[5]++; /* 017c "lda r5" */
+    if (R[P] != 0x017d) goto staticDispatch;
+    STATIC_FETCH(0xa5);Cycles -= 2;R[P] = 0x017e;R[5] = (R[5] & 0xFF00) | D; /* 017d "plo r5" */
+    if (R[P] != 0x017e) goto staticDispatch;
+    STATIC_FETCH(0x86);Cycles -= 2;R[P] = 0x017f;D = R[6] & 0xFF; /* 017e "glo r6" */
+    STATIC_FETCH(0xfa);Cycles -= 2;R[P] = 0x0181;D = D & 0x0f; /* 017f "ani .1" */
+    STATIC_FETCH(0xb5);Cycles -= 2;R[P] = 0x0182;R[5] = (R[5] & 0x00FF) | (((WORD16)D) << 8); /* 0181 "phi r5" */
+    if (R[P] != 0x0182) goto staticDispatch;
+    goto _s0182;
+_s0182:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0xd4);Cycles -= 2;R[P] = 0x0183;P = 4; /* 0182 "sep r4" */
+    goto staticDispatch;
+_s0183:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0x45);Cycles -= 2;R[P] = 0x0184;D = READ(R[5]);R[5]++; /* 0183 "lda r5" */
+    if (R[P] != 0x0184) goto staticDispatch;
+    goto _s0184;
+_s0184:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0xe6);Cycles -= 2;R[P] = 0x0185;X = 6; /* 0184 "sex r6" */
+    STATIC_FETCH(0xf3);Cycles -= 2;R[P] = 0x0186;D = D ^ READ(R[X]); /* 0185 "xor" */
+    STATIC_FETCH(0x3a);Cycles -= 2;R[P] = 0x0188;_temp = 0x82; if (!((D == 0))) SHORT(_temp); /* 0186 "bnz .1" */
+    if (R[P] == 0x0182) goto _s0182;
+    goto _s0188;
+_s0188:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0x15);Cycles -= 2;R[P] = 0x0189;R[5]++; /* 0188 "inc r5" */
+    if (R[P] != 0x0189) goto staticDispatch;
+    STATIC_FETCH(0x15);Cycles -= 2;R[P] = 0x018a;R[5]++; /* 0189 "inc r5" */
+    if (R[P] != 0x018a) goto staticDispatch;
+    STATIC_FETCH(0xd4);Cycles -= 2;R[P] = 0x018b;P = 4; /* 018a "sep r4" */
+    goto staticDispatch;
+_s018b:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0x45);Cycles -= 2;R[P] = 0x018c;D = READ(R[5]);R[5]++; /* 018b "lda r5" */
+    if (R[P] != 0x018c) goto staticDispatch;
+    goto _s018c;
+_s018c:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0xe6);Cycles -= 2;R[P] = 0x018d;X = 6; /* 018c "sex r6" */
+    STATIC_FETCH(0xf3);Cycles -= 2;R[P] = 0x018e;D = D ^ READ(R[X]); /* 018d "xor" */
+    STATIC_FETCH(0x3a);Cycles -= 2;R[P] = 0x0190;_temp = 0x88; if (!((D == 0))) SHORT(_temp); /* 018e "bnz .1" */
+    if (R[P] == 0x0188) goto _s0188;
+    goto _s0190;
+_s0190:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0xd4);Cycles -= 2;R[P] = 0x0191;P = 4; /* 0190 "sep r4" */
+    goto staticDispatch;
+_s0191:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0x45);Cycles -= 2;R[P] = 0x0192;D = READ(R[5]);R[5]++; /* 0191 "lda r5" */
+    if (R[P] != 0x0192) goto staticDispatch;
+    STATIC_FETCH(0x07);Cycles -= 2;R[P] = 0x0193;D = READ(R[7]); /* 0192 "ldn r7" */
+    STATIC_FETCH(0x30);Cycles -= 2;R[P] = 0x0195;_temp = 0x8c;SHORT(_temp); /* 0193 "br .1" */
+    goto _s018c;
+_s0195:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0x45);Cycles -= 2;R[P] = 0x0196;D = READ(R[5]);R[5]++; /* 0195 "lda r5" */
+    if (R[P] != 0x0196) goto staticDispatch;
+    STATIC_FETCH(0x07);Cycles -= 2;R[P] = 0x0197;D = READ(R[7]); /* 0196 "ldn r7" */
+    STATIC_FETCH(0x30);Cycles -= 2;R[P] = 0x0199;_temp = 0x84;SHORT(_temp); /* 0197 "br .1" */
+    goto _s0184;
+_s0199:
+    if (Cycles - 12 < limit) goto staticLeave;
+    STATIC_FETCH(0xe6);Cycles -= 2;R[P] = 0x019a;X = 6; /* 0199 "sex r6" */
+    STATIC_FETCH(0x62);Cycles -= 2;R[P] = 0x019b;UPDATEIO(2,READ(R[X]));R[X]++; /* 019a "out 2" */
+    if (R[P] != 0x019b) goto staticDispatch;
+    STATIC_FETCH(0x26);Cycles -= 2;R[P] = 0x019c;R[6]--; /* 019b "dec r6" */
+    if (R[P] != 0x019c) goto staticDispatch;
+    STATIC_FETCH(0x45);Cycles -= 2;R[P] = 0x019d;D = READ(R[5]);R[5]++; /* 019c "lda r5" */
+    if (R[P] != 0x019d) goto staticDispatch;
+    STATIC_FETCH(0xa3);Cycles -= 2;R[P] = 0x019e;R[3] = (R[3] & 0xFF00) | D; /* 019d "plo r3" */
+    if (R[P] != 0x019e) goto staticDispatch;
+    STATIC_FETCH(0x36);Cycles -= 2;R[P] = 0x01a0;_temp = 0x88; if ((READEFLAG(3) != 0)) SHORT(_temp); /* 019e "b3 .1" */
+    if (R[P] == 0x0188) goto _s0188;
+    goto _s01a0;
+_s01a0:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0xd4);Cycles -= 2;R[P] = 0x01a1;P = 4; /* 01a0 "sep r4" */
+    goto staticDispatch;
+_s01a1:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0x3e);Cycles -= 2;R[P] = 0x01a3;_temp = 0x88; if (!((READEFLAG(3) != 0))) SHORT(_temp); /* 01a1 "bn3 .1" */
+    if (R[P] == 0x0188) goto _s0188;
+    goto _s01a3;
+_s01a3:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0xd4);Cycles -= 2;R[P] = 0x01a4;P = 4; /* 01a3 "sep r4" */
+    goto staticDispatch;
+_s01a4:
+    if (Cycles - 18 < limit) goto staticLeave;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x01a6;D = 0xf0; /* 01a4 "ldi .1" */
+    STATIC_FETCH(0xa7);Cycles -= 2;R[P] = 0x01a7;R[7] = (R[7] & 0xFF00) | D; /* 01a6 "plo r7" */
+    if (R[P] != 0x01a7) goto staticDispatch;
+    STATIC_FETCH(0xe7);Cycles -= 2;R[P] = 0x01a8;X = 7; /* 01a7 "sex r7" */
+    STATIC_FETCH(0x45);Cycles -= 2;R[P] = 0x01a9;D = READ(R[5]);R[5]++; /* 01a8 "lda r5" */
+    if (R[P] != 0x01a9) goto staticDispatch;
+    STATIC_FETCH(0xf4);Cycles -= 2;R[P] = 0x01aa;ADD(D,READ(R[X]),0); /* 01a9 "add" */
+    STATIC_FETCH(0xa5);Cycles -= 2;R[P] = 0x01ab;R[5] = (R[5] & 0xFF00) | D; /* 01aa "plo r5" */
+    if (R[P] != 0x01ab) goto staticDispatch;
+    STATIC_FETCH(0x86);Cycles -= 2;R[P] = 0x01ac;D = R[6] & 0xFF; /* 01ab "glo r6" */
+    STATIC_FETCH(0xfa);Cycles -= 2;R[P] = 0x01ae;D = D & 0x0f; /* 01ac "ani .1" */
+    STATIC_FETCH(0x3b);Cycles -= 2;R[P] = 0x01b0;_temp = 0xb2; if (!((DF != 0))) SHORT(_temp); /* 01ae "bnf .1" */
+    if (R[P] == 0x01b2) goto _s01b2;
+    goto _s01b0;
+_s01b0:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0xfc);Cycles -= 2;R[P] = 0x01b2;ADD(D,0x01,0); /* 01b0 "adi .1" */
+    goto _s01b2;
+_s01b2:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0xb5);Cycles -= 2;R[P] = 0x01b3;R[5] = (R[5] & 0x00FF) | (((WORD16)D) << 8); /* 01b2 "phi r5" */
+    if (R[P] != 0x01b3) goto staticDispatch;
+    STATIC_FETCH(0xd4);Cycles -= 2;R[P] = 0x01b4;P = 4; /* 01b3 "sep r4" */
+    goto staticDispatch;
+_s01b4:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0x45);Cycles -= 2;R[P] = 0x01b5;D = READ(R[5]);R[5]++; /* 01b4 "lda r5" */
+    if (R[P] != 0x01b5) goto staticDispatch;
+    STATIC_FETCH(0x56);Cycles -= 2;R[P] = 0x01b6;WRITE(R[6],D); /* 01b5 "str r6" */
+    if (cpu->staticRam != STATIC_VALID) goto staticDispatch;
+    STATIC_FETCH(0xd4);Cycles -= 2;R[P] = 0x01b7;P = 4; /* 01b6 "sep r4" */
+    goto staticDispatch;
+_s01b7:
+    if (Cycles - 10 < limit) goto staticLeave;
+    STATIC_FETCH(0x45);Cycles -= 2;R[P] = 0x01b8;D = READ(R[5]);R[5]++; /* 01b7 "lda r5" */
+    if (R[P] != 0x01b8) goto staticDispatch;
+    STATIC_FETCH(0xe6);Cycles -= 2;R[P] = 0x01b9;X = 6; /* 01b8 "sex r6" */
+    STATIC_FETCH(0xf4);Cycles -= 2;R[P] = 0x01ba;ADD(D,READ(R[X]),0); /* 01b9 "add" */
+    STATIC_FETCH(0x56);Cycles -= 2;R[P] = 0x01bb;WRITE(R[6],D); /* 01ba "str r6" */
+    if (cpu->staticRam != STATIC_VALID) goto staticDispatch;
+    STATIC_FETCH(0xd4);Cycles -= 2;R[P] = 0x01bc;P = 4; /* 01bb "sep r4" */
+    goto staticDispatch;
+_s01bc:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0x45);Cycles -= 2;R[P] = 0x01bd;D = READ(R[5]);R[5]++; /* 01bc "lda r5" */
+    if (R[P] != 0x01bd) goto staticDispatch;
+    STATIC_FETCH(0xfa);Cycles -= 2;R[P] = 0x01bf;D = D & 0x0f; /* 01bd "ani .1" */
+    STATIC_FETCH(0x3a);Cycles -= 2;R[P] = 0x01c1;_temp = 0xc4; if (!((D == 0))) SHORT(_temp); /* 01bf "bnz .1" */
+    if (R[P] == 0x01c4) goto _s01c4;
+    goto _s01c1;
+_s01c1:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0x07);Cycles -= 2;R[P] = 0x01c2;D = READ(R[7]); /* 01c1 "ldn r7" */
+    STATIC_FETCH(0x56);Cycles -= 2;R[P] = 0x01c3;WRITE(R[6],D); /* 01c2 "str r6" */
+    if (cpu->staticRam != STATIC_VALID) goto staticDispatch;
+    STATIC_FETCH(0xd4);Cycles -= 2;R[P] = 0x01c4;P = 4; /* 01c3 "sep r4" */
+    goto staticDispatch;
+_s01c4:
+    if (Cycles - 20 < limit) goto staticLeave;
+    STATIC_FETCH(0xaf);Cycles -= 2;R[P] = 0x01c5;R[15] = (R[15] & 0xFF00) | D; /* 01c4 "plo rf" */
+    if (R[P] != 0x01c5) goto staticDispatch;
+    STATIC_FETCH(0x22);Cycles -= 2;R[P] = 0x01c6;R[2]--; /* 01c5 "dec r2" */
+    if (R[P] != 0x01c6) goto staticDispatch;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x01c8;D = 0xd3; /* 01c6 "ldi .1" */
+    STATIC_FETCH(0x73);Cycles -= 2;R[P] = 0x01c9;WRITE(R[X],D);R[X]--; /* 01c8 "stxd" */
+    if (R[P] != 0x01c9) goto staticDispatch;
+    if (cpu->staticRam != STATIC_VALID) goto staticDispatch;
+    STATIC_FETCH(0x8f);Cycles -= 2;R[P] = 0x01ca;D = R[15] & 0xFF; /* 01c9 "glo rf" */
+    STATIC_FETCH(0xf9);Cycles -= 2;R[P] = 0x01cc;D = D | 0xf0; /* 01ca "ori .1" */
+    STATIC_FETCH(0x52);Cycles -= 2;R[P] = 0x01cd;WRITE(R[2],D); /* 01cc "str r2" */
+    if (cpu->staticRam != STATIC_VALID) goto staticDispatch;
+    STATIC_FETCH(0xe6);Cycles -= 2;R[P] = 0x01ce;X = 6; /* 01cd "sex r6" */
+    STATIC_FETCH(0x07);Cycles -= 2;R[P] = 0x01cf;D = READ(R[7]); /* 01ce "ldn r7" */
+    STATIC_FETCH(0xd2);Cycles -= 2;R[P] = 0x01d0;P = 2; /* 01cf "sep r2" */
+    goto staticDispatch;
+_s01d0:
+    if (Cycles - 14 < limit) goto staticLeave;
+    STATIC_FETCH(0x56);Cycles -= 2;R[P] = 0x01d1;WRITE(R[6],D); /* 01d0 "str r6" */
+    if (cpu->staticRam != STATIC_VALID) goto staticDispatch;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x01d3;D = 0xff; /* 01d1 "ldi .1" */
+    STATIC_FETCH(0xa6);Cycles -= 2;R[P] = 0x01d4;R[6] = (R[6] & 0xFF00) | D; /* 01d3 "plo r6" */
+    if (R[P] != 0x01d4) goto staticDispatch;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x01d6;D = 0x00; /* 01d4 "ldi .1" */
+    STATIC_FETCH(0x7e);Cycles -= 2;R[P] = 0x01d7;_temp = D;D = (D << 1) | DF;DF = (_temp >> 7) & 1; /* 01d6 "rshl" */
+    STATIC_FETCH(0x56);Cycles -= 2;R[P] = 0x01d8;WRITE(R[6],D); /* 01d7 "str r6" */
+    if (cpu->staticRam != STATIC_VALID) goto staticDispatch;
+    STATIC_FETCH(0xd4);Cycles -= 2;R[P] = 0x01d9;P = 4; /* 01d8 "sep r4" */
+    goto staticDispatch;
+_s01d9:
+    if (Cycles - 36 < limit) goto staticLeave;
+    STATIC_FETCH(0x19);Cycles -= 2;R[P] = 0x01da;R[9]++; /* 01d9 "inc r9" */
+    if (R[P] != 0x01da) goto staticDispatch;
+    STATIC_FETCH(0x89);Cycles -= 2;R[P] = 0x01db;D = R[9] & 0xFF; /* 01da "glo r9" */
+    STATIC_FETCH(0xae);Cycles -= 2;R[P] = 0x01dc;R[14] = (R[14] & 0xFF00) | D; /* 01db "plo re" */
+    if (R[P] != 0x01dc) goto staticDispatch;
+    STATIC_FETCH(0x93);Cycles -= 2;R[P] = 0x01dd;D = (R[3] >> 8) & 0xFF; /* 01dc "ghi r3" */
+    STATIC_FETCH(0xbe);Cycles -= 2;R[P] = 0x01de;R[14] = (R[14] & 0x00FF) | (((WORD16)D) << 8); /* 01dd "phi re" */
+    if (R[P] != 0x01de) goto staticDispatch;
+    STATIC_FETCH(0x99);Cycles -= 2;R[P] = 0x01df;D = (R[9] >> 8) & 0xFF; /* 01de "ghi r9" */
+    STATIC_FETCH(0xee);Cycles -= 2;R[P] = 0x01e0;X = 14; /* 01df "sex re" */
+    STATIC_FETCH(0xf4);Cycles -= 2;R[P] = 0x01e1;ADD(D,READ(R[X]),0); /* 01e0 "add" */
+    STATIC_FETCH(0x56);Cycles -= 2;R[P] = 0x01e2;WRITE(R[6],D); /* 01e1 "str r6" */
+    if (cpu->staticRam != STATIC_VALID) goto staticDispatch;
+    STATIC_FETCH(0x76);Cycles -= 2;R[P] = 0x01e3;_temp = D & 1;D = ((D >> 1) & 0x7F) | (DF << 7);DF = _temp; /* 01e2 "rshr" */
+    STATIC_FETCH(0xe6);Cycles -= 2;R[P] = 0x01e4;X = 6; /* 01e3 "sex r6" */
+    STATIC_FETCH(0xf4);Cycles -= 2;R[P] = 0x01e5;ADD(D,READ(R[X]),0); /* 01e4 "add" */
+    STATIC_FETCH(0xb9);Cycles -= 2;R[P] = 0x01e6;R[9] = (R[9] & 0x00FF) | (((WORD16)D) << 8); /* 01e5 "phi r9" */
+    if (R[P] != 0x01e6) goto staticDispatch;
+    STATIC_FETCH(0x56);Cycles -= 2;R[P] = 0x01e7;WRITE(R[6],D); /* 01e6 "str r6" */
+    if (cpu->staticRam != STATIC_VALID) goto staticDispatch;
+    STATIC_FETCH(0x45);Cycles -= 2;R[P] = 0x01e8;D = READ(R[5]);R[5]++; /* 01e7 "lda r5" */
+    if (R[P] != 0x01e8) goto staticDispatch;
+    STATIC_FETCH(0xf2);Cycles -= 2;R[P] = 0x01e9;D = D & READ(R[X]); /* 01e8 "and" */
+    STATIC_FETCH(0x56);Cycles -= 2;R[P] = 0x01ea;WRITE(R[6],D); /* 01e9 "str r6" */
+    if (cpu->staticRam != STATIC_VALID) goto staticDispatch;
+    STATIC_FETCH(0xd4);Cycles -= 2;R[P] = 0x01eb;P = 4; /* 01ea "sep r4" */
+    goto staticDispatch;
+_s01eb:
+    if (Cycles - 12 < limit) goto staticLeave;
+    STATIC_FETCH(0x45);Cycles -= 2;R[P] = 0x01ec;D = READ(R[5]);R[5]++; /* 01eb "lda r5" */
+    if (R[P] != 0x01ec) goto staticDispatch;
+    STATIC_FETCH(0xaa);Cycles -= 2;R[P] = 0x01ed;R[10] = (R[10] & 0xFF00) | D; /* 01ec "plo ra" */
+    if (R[P] != 0x01ed) goto staticDispatch;
+    STATIC_FETCH(0x86);Cycles -= 2;R[P] = 0x01ee;D = R[6] & 0xFF; /* 01ed "glo r6" */
+    STATIC_FETCH(0xfa);Cycles -= 2;R[P] = 0x01f0;D = D & 0x0f; /* 01ee "ani .1" */
+    STATIC_FETCH(0xba);Cycles -= 2;R[P] = 0x01f1;R[10] = (R[10] & 0x00FF) | (((WORD16)D) << 8); /* 01f0 "phi ra" */
+    if (R[P] != 0x01f1) goto staticDispatch;
+    STATIC_FETCH(0xd4);Cycles -= 2;R[P] = 0x01f2;P = 4; /* 01f1 "sep r4" */
+    goto staticDispatch;
+_s01f2:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0x00);Cycles -= 2;R[P] = 0x01f3;R[P]--;IDLE(2); /* 01f2 "idl" */
+    goto _s01f2;
+_s01fc:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0x00);Cycles -= 2;R[P] = 0x01fd;R[P]--;IDLE(2); /* 01fc "idl" */
+    goto _s01fc;
+#endif
+
+#ifdef IS_STUDIO2
+staticDispatch:
+    switch (R[P])
+    {
+        case 0x0000: goto _s0000;
+        case 0x0017: goto _s0017;
+        case 0x0018: goto _s0018;
+        case 0x001c: goto _s001c;
+        case 0x0023: goto _s0023;
+        case 0x002f: goto _s002f;
+        case 0x003c: goto _s003c;
+        case 0x0040: goto _s0040;
+        case 0x0044: goto _s0044;
+        case 0x0047: goto _s0047;
+        case 0x004c: goto _s004c;
+        case 0x004f: goto _s004f;
+        case 0x0052: goto _s0052;
+        case 0x0064: goto _s0064;
+        case 0x006b: goto _s006b;
+        case 0x0078: goto _s0078;
+        case 0x0090: goto _s0090;
+        case 0x0092: goto _s0092;
+        case 0x0094: goto _s0094;
+        case 0x009b: goto _s009b;
+        case 0x00a7: goto _s00a7;
+        case 0x00af: goto _s00af;
+        case 0x00b4: goto _s00b4;
+        case 0x00b9: goto _s00b9;
+        case 0x00bc: goto _s00bc;
+        case 0x00bf: goto _s00bf;
+        case 0x00c2: goto _s00c2;
+        case 0x00c4: goto _s00c4;
+        case 0x00c7: goto _s00c7;
+        case 0x00ca: goto _s00ca;
+        case 0x00d2: goto _s00d2;
+        case 0x00d9: goto _s00d9;
+        case 0x00e0: goto _s00e0;
+        case 0x0100: goto _s0100;
+        case 0x0115: goto _s0115;
+        case 0x0119: goto _s0119;
+        case 0x0129: goto _s0129;
+        case 0x012c: goto _s012c;
+        case 0x012f: goto _s012f;
+        case 0x0132: goto _s0132;
+        case 0x0135: goto _s0135;
+        case 0x013c: goto _s013c;
+        case 0x013d: goto _s013d;
+        case 0x013e: goto _s013e;
+        case 0x0141: goto _s0141;
+        case 0x0149: goto _s0149;
+        case 0x014e: goto _s014e;
+        case 0x0153: goto _s0153;
+        case 0x0158: goto _s0158;
+        case 0x015d: goto _s015d;
+        case 0x0162: goto _s0162;
+        case 0x0163: goto _s0163;
+        case 0x0166: goto _s0166;
+        case 0x0168: goto _s0168;
+        case 0x016d: goto _s016d;
+        case 0x0172: goto _s0172;
+        case 0x0175: goto _s0175;
+        case 0x017a: goto _s017a;
+        case 0x017d: goto _s017d;
+        case 0x0181: goto _s0181;
+        case 0x0187: goto _s0187;
+        case 0x0190: goto _s0190;
+        case 0x0193: goto _s0193;
+        case 0x0197: goto _s0197;
+        case 0x019a: goto _s019a;
+        case 0x019f: goto _s019f;
+        case 0x01a2: goto _s01a2;
+        case 0x01a5: goto _s01a5;
+        case 0x01ab: goto _s01ab;
+        case 0x01b4: goto _s01b4;
+        case 0x01b8: goto _s01b8;
+        case 0x01bc: goto _s01bc;
+        case 0x01c6: goto _s01c6;
+        case 0x01c7: goto _s01c7;
+        case 0x01ca: goto _s01ca;
+        case 0x01cb: goto _s01cb;
+        case 0x01cd: goto _s01cd;
+        case 0x01d4: goto _s01d4;
+        case 0x01d7: goto _s01d7;
+        case 0x01d8: goto _s01d8;
+        case 0x01da: goto _s01da;
+        case 0x01e1: goto _s01e1;
+        case 0x01e4: goto _s01e4;
+        case 0x01e6: goto _s01e6;
+        case 0x01e9: goto _s01e9;
+        case 0x01eb: goto _s01eb;
+        case 0x01f3: goto _s01f3;
+        case 0x01f4: goto _s01f4;
+        case 0x01f9: goto _s01f9;
+        case 0x01fa: goto _s01fa;
+        case 0x0200: goto _s0200;
+        case 0x020b: goto _s020b;
+        case 0x0211: goto _s0211;
+        case 0x0216: goto _s0216;
+        case 0x0219: goto _s0219;
+        case 0x021f: goto _s021f;
+        case 0x0222: goto _s0222;
+        case 0x0229: goto _s0229;
+        case 0x023d: goto _s023d;
+        case 0x0242: goto _s0242;
+        case 0x0247: goto _s0247;
+        case 0x024c: goto _s024c;
+        case 0x024d: goto _s024d;
+        case 0x024e: goto _s024e;
+        case 0x024f: goto _s024f;
+        case 0x0253: goto _s0253;
+        case 0x0256: goto _s0256;
+        case 0x025e: goto _s025e;
+        case 0x0261: goto _s0261;
+        case 0x0264: goto _s0264;
+        case 0x0267: goto _s0267;
+        case 0x026a: goto _s026a;
+        case 0x026d: goto _s026d;
+        case 0x0270: goto _s0270;
+        case 0x0279: goto _s0279;
+        case 0x027c: goto _s027c;
+        case 0x0280: goto _s0280;
+        case 0x0287: goto _s0287;
+        case 0x028b: goto _s028b;
+        case 0x0290: goto _s0290;
+        case 0x0292: goto _s0292;
+        case 0x029b: goto _s029b;
+        case 0x029e: goto _s029e;
+        case 0x02a1: goto _s02a1;
+        case 0x02a2: goto _s02a2;
+        case 0x02a4: goto _s02a4;
+        case 0x02a9: goto _s02a9;
+        case 0x02ac: goto _s02ac;
+        case 0x02af: goto _s02af;
+        case 0x02b3: goto _s02b3;
+        case 0x02b6: goto _s02b6;
+        case 0x02bf: goto _s02bf;
+        case 0x02ca: goto _s02ca;
+        case 0x02cc: goto _s02cc;
+        case 0x02d7: goto _s02d7;
+        case 0x02d9: goto _s02d9;
+        case 0x02db: goto _s02db;
+        case 0x02dd: goto _s02dd;
+        case 0x02e1: goto _s02e1;
+        case 0x02e2: goto _s02e2;
+        case 0x02e5: goto _s02e5;
+        case 0x02f2: goto _s02f2;
+        case 0x02f8: goto _s02f8;
+        case 0x02f9: goto _s02f9;
+        case 0x02fd: goto _s02fd;
+        case 0x02ff: goto _s02ff;
+    }
+    goto staticLeave;
+_s0000:
+    if (Cycles - 36 < limit) goto staticLeave;
+    STATIC_FETCH(0x90);Cycles -= 2;R[P] = 0x0001;D = (R[0] >> 8) & 0xFF; /* 0000 "ghi r0" */
+    STATIC_FETCH(0xb1);Cycles -= 2;R[P] = 0x0002;R[1] = (R[1] & 0x00FF) | (((WORD16)D) << 8); /* 0001 "phi r1" */
+    if (R[P] != 0x0002) goto staticDispatch;
+    STATIC_FETCH(0xb4);Cycles -= 2;R[P] = 0x0003;R[4] = (R[4] & 0x00FF) | (((WORD16)D) << 8); /* 0002 "phi r4" */
+    if (R[P] != 0x0003) goto staticDispatch;
+    STATIC_FETCH(0xa5);Cycles -= 2;R[P] = 0x0004;R[5] = (R[5] & 0xFF00) | D; /* 0003 "plo r5" */
+    if (R[P] != 0x0004) goto staticDispatch;
+    STATIC_FETCH(0xab);Cycles -= 2;R[P] = 0x0005;R[11] = (R[11] & 0xFF00) | D; /* 0004 "plo rb" */
+    if (R[P] != 0x0005) goto staticDispatch;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x0007;D = 0x08; /* 0005 "ldi .1" */
+    STATIC_FETCH(0xb2);Cycles -= 2;R[P] = 0x0008;R[2] = (R[2] & 0x00FF) | (((WORD16)D) << 8); /* 0007 "phi r2" */
+    if (R[P] != 0x0008) goto staticDispatch;
+    STATIC_FETCH(0xb6);Cycles -= 2;R[P] = 0x0009;R[6] = (R[6] & 0x00FF) | (((WORD16)D) << 8); /* 0008 "phi r6" */
+    if (R[P] != 0x0009) goto staticDispatch;
+    STATIC_FETCH(0xb8);Cycles -= 2;R[P] = 0x000a;R[8] = (R[8] & 0x00FF) | (((WORD16)D) << 8); /* 0009 "phi r8" */
+    if (R[P] != 0x000a) goto staticDispatch;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x000c;D = 0x1c; /* 000a "ldi .1" */
+    STATIC_FETCH(0xa1);Cycles -= 2;R[P] = 0x000d;R[1] = (R[1] & 0xFF00) | D; /* 000c "plo r1" */
+    if (R[P] != 0x000d) goto staticDispatch;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x000f;D = 0xbf; /* 000d "ldi .1" */
+    STATIC_FETCH(0xa2);Cycles -= 2;R[P] = 0x0010;R[2] = (R[2] & 0xFF00) | D; /* 000f "plo r2" */
+    if (R[P] != 0x0010) goto staticDispatch;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x0012;D = 0x6b; /* 0010 "ldi .1" */
+    STATIC_FETCH(0xa4);Cycles -= 2;R[P] = 0x0013;R[4] = (R[4] & 0xFF00) | D; /* 0012 "plo r4" */
+    if (R[P] != 0x0013) goto staticDispatch;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x0015;D = 0x03; /* 0013 "ldi .1" */
+    STATIC_FETCH(0xb5);Cycles -= 2;R[P] = 0x0016;R[5] = (R[5] & 0x00FF) | (((WORD16)D) << 8); /* 0015 "phi r5" */
+    if (R[P] != 0x0016) goto staticDispatch;
+    STATIC_FETCH(0xd4);Cycles -= 2;R[P] = 0x0017;P = 4; /* 0016 "sep r4" */
+    goto staticDispatch;
+_s0017:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0x7a);Cycles -= 2;R[P] = 0x0018;Q = 0;UPDATEIO(0,0); /* 0017 "req" */
+    goto _s0018;
+_s0018:
+    if (Cycles - 8 < limit) goto staticLeave;
+    STATIC_FETCH(0x42);Cycles -= 2;R[P] = 0x0019;D = READ(R[2]);R[2]++; /* 0018 "lda r2" */
+    if (R[P] != 0x0019) goto staticDispatch;
+    STATIC_FETCH(0xf6);Cycles -= 2;R[P] = 0x001a;DF = D & 1;D = (D >> 1) & 0x7F; /* 0019 "shr" */
+    STATIC_FETCH(0x42);Cycles -= 2;R[P] = 0x001b;D = READ(R[2]);R[2]++; /* 001a "lda r2" */
+    if (R[P] != 0x001b) goto staticDispatch;
+    STATIC_FETCH(0x70);Cycles -= 2;R[P] = 0x001c;RETURN();IE = 1; /* 001b "ret" */
+    goto staticDispatch;
+_s001c:
+    if (Cycles - 11 < limit) goto staticLeave;
+    STATIC_FETCH(0x22);Cycles -= 2;R[P] = 0x001d;R[2]--; /* 001c "dec r2" */
+    if (R[P] != 0x001d) goto staticDispatch;
+    STATIC_FETCH(0x78);Cycles -= 2;R[P] = 0x001e;WRITE(R[X],T); /* 001d "sav" */
+    STATIC_FETCH(0x22);Cycles -= 2;R[P] = 0x001f;R[2]--; /* 001e "dec r2" */
+    if (R[P] != 0x001f) goto staticDispatch;
+    STATIC_FETCH(0x73);Cycles -= 2;R[P] = 0x0020;WRITE(R[X],D);R[X]--; /* 001f "stxd" */
+    if (R[P] != 0x0020) goto staticDispatch;
+    STATIC_FETCH(0xc0);Cycles -= 2;R[P] = 0x0023;Cycles--;{ _temp = 0x0023; };LONG(_temp); /* 0020 "lbr .2" */
+    goto _s0023;
+_s0023:
+    if (Cycles - 20 < limit) goto staticLeave;
+    STATIC_FETCH(0x7e);Cycles -= 2;R[P] = 0x0024;_temp = D;D = (D << 1) | DF;DF = (_temp >> 7) & 1; /* 0023 "rshl" */
+    STATIC_FETCH(0x52);Cycles -= 2;R[P] = 0x0025;WRITE(R[2],D); /* 0024 "str r2" */
+    STATIC_FETCH(0x19);Cycles -= 2;R[P] = 0x0026;R[9]++; /* 0025 "inc r9" */
+    if (R[P] != 0x0026) goto staticDispatch;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x0028;D = 0x09; /* 0026 "ldi .1" */
+    STATIC_FETCH(0xb0);Cycles -= 2;R[P] = 0x0029;R[0] = (R[0] & 0x00FF) | (((WORD16)D) << 8); /* 0028 "phi r0" */
+    if (R[P] != 0x0029) goto staticDispatch;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x002b;D = 0xd0; /* 0029 "ldi .1" */
+    STATIC_FETCH(0xa8);Cycles -= 2;R[P] = 0x002c;R[8] = (R[8] & 0xFF00) | D; /* 002b "plo r8" */
+    if (R[P] != 0x002c) goto staticDispatch;
+    STATIC_FETCH(0x8b);Cycles -= 2;R[P] = 0x002d;D = R[11] & 0xFF; /* 002c "glo rb" */
+    STATIC_FETCH(0xa0);Cycles -= 2;R[P] = 0x002e;R[0] = (R[0] & 0xFF00) | D; /* 002d "plo r0" */
+    if (R[P] != 0x002e) goto staticDispatch;
+    STATIC_FETCH(0xe2);Cycles -= 2;R[P] = 0x002f;X = 2; /* 002e "sex r2" */
+    goto _s002f;
+_s002f:
+    if (Cycles - 24 < limit) goto staticLeave;
+    STATIC_FETCH(0x20);Cycles -= 2;R[P] = 0x0030;R[0]--; /* 002f "dec r0" */
+    if (R[P] != 0x0030) goto staticDispatch;
+    STATIC_FETCH(0xa0);Cycles -= 2;R[P] = 0x0031;R[0] = (R[0] & 0xFF00) | D; /* 0030 "plo r0" */
+    if (R[P] != 0x0031) goto staticDispatch;
+    STATIC_FETCH(0xe2);Cycles -= 2;R[P] = 0x0032;X = 2; /* 0031 "sex r2" */
+    STATIC_FETCH(0x20);Cycles -= 2;R[P] = 0x0033;R[0]--; /* 0032 "dec r0" */
+    if (R[P] != 0x0033) goto staticDispatch;
+    STATIC_FETCH(0xa0);Cycles -= 2;R[P] = 0x0034;R[0] = (R[0] & 0xFF00) | D; /* 0033 "plo r0" */
+    if (R[P] != 0x0034) goto staticDispatch;
+    STATIC_FETCH(0xe2);Cycles -= 2;R[P] = 0x0035;X = 2; /* 0034 "sex r2" */
+    STATIC_FETCH(0x20);Cycles -= 2;R[P] = 0x0036;R[0]--; /* 0035 "dec r0" */
+    if (R[P] != 0x0036) goto staticDispatch;
+    STATIC_FETCH(0xa0);Cycles -= 2;R[P] = 0x0037;R[0] = (R[0] & 0xFF00) | D; /* 0036 "plo r0" */
+    if (R[P] != 0x0037) goto staticDispatch;
+    STATIC_FETCH(0x80);Cycles -= 2;R[P] = 0x0038;D = R[0] & 0xFF; /* 0037 "glo r0" */
+    STATIC_FETCH(0x20);Cycles -= 2;R[P] = 0x0039;R[0]--; /* 0038 "dec r0" */
+    if (R[P] != 0x0039) goto staticDispatch;
+    STATIC_FETCH(0xa0);Cycles -= 2;R[P] = 0x003a;R[0] = (R[0] & 0xFF00) | D; /* 0039 "plo r0" */
+    if (R[P] != 0x003a) goto staticDispatch;
+    STATIC_FETCH(0x3c);Cycles -= 2;R[P] = 0x003c;_temp = 0x2f; if (!((READEFLAG(1) != 0))) SHORT(_temp); /* 003a "bn1 .1" */
+    if (R[P] == 0x002f) goto _s002f;
+    goto _s003c;
+_s003c:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0x20);Cycles -= 2;R[P] = 0x003d;R[0]--; /* 003c "dec r0" */
+    if (R[P] != 0x003d) goto staticDispatch;
+    STATIC_FETCH(0xa0);Cycles -= 2;R[P] = 0x003e;R[0] = (R[0] & 0xFF00) | D; /* 003d "plo r0" */
+    if (R[P] != 0x003e) goto staticDispatch;
+    STATIC_FETCH(0x38);Cycles -= 2;R[P] = 0x0040;_temp = 0x3c; /* 003e "skp" */
+    goto _s0040;
+_s0040:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0x28);Cycles -= 2;R[P] = 0x0041;R[8]--; /* 0040 "dec r8" */
+    if (R[P] != 0x0041) goto staticDispatch;
+    STATIC_FETCH(0x08);Cycles -= 2;R[P] = 0x0042;D = READ(R[8]); /* 0041 "ldn r8" */
+    STATIC_FETCH(0x32);Cycles -= 2;R[P] = 0x0044;_temp = 0x47; if ((D == 0)) SHORT(_temp); /* 0042 "bz .1" */
+    if (R[P] == 0x0047) goto _s0047;
+    goto _s0044;
+_s0044:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0xff);Cycles -= 2;R[P] = 0x0046;SUB(D,0x01,1); /* 0044 "smi .1" */
+    STATIC_FETCH(0x58);Cycles -= 2;R[P] = 0x0047;WRITE(R[8],D); /* 0046 "str r8" */
+    goto _s0047;
+_s0047:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0x88);Cycles -= 2;R[P] = 0x0048;D = R[8] & 0xFF; /* 0047 "glo r8" */
+    STATIC_FETCH(0xfb);Cycles -= 2;R[P] = 0x004a;D = D ^ 0xcd; /* 0048 "xri .1" */
+    STATIC_FETCH(0x3a);Cycles -= 2;R[P] = 0x004c;_temp = 0x40; if (!((D == 0))) SHORT(_temp); /* 004a "bnz .1" */
+    if (R[P] == 0x0040) goto _s0040;
+    goto _s004c;
+_s004c:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0x08);Cycles -= 2;R[P] = 0x004d;D = READ(R[8]); /* 004c "ldn r8" */
+    STATIC_FETCH(0x32);Cycles -= 2;R[P] = 0x004f;_temp = 0x17; if ((D == 0)) SHORT(_temp); /* 004d "bz .1" */
+    if (R[P] == 0x0017) goto _s0017;
+    goto _s004f;
+_s004f:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0x7b);Cycles -= 2;R[P] = 0x0050;Q = 1;UPDATEIO(0,1); /* 004f "seq" */
+    STATIC_FETCH(0x30);Cycles -= 2;R[P] = 0x0052;_temp = 0x18;SHORT(_temp); /* 0050 "br .1" */
+    goto _s0018;
+_s0052:
+    if (Cycles - 36 < limit) goto staticLeave;
+    STATIC_FETCH(0x19);Cycles -= 2;R[P] = 0x0053;R[9]++; /* 0052 "inc r9" */
+    if (R[P] != 0x0053) goto staticDispatch;
+    STATIC_FETCH(0x89);Cycles -= 2;R[P] = 0x0054;D = R[9] & 0xFF; /* 0053 "glo r9" */
+    STATIC_FETCH(0xae);Cycles -= 2;R[P] = 0x0055;R[14] = (R[14] & 0xFF00) | D; /* 0054 "plo re" */
+    if (R[P] != 0x0055) goto staticDispatch;
+    STATIC_FETCH(0x93);Cycles -= 2;R[P] = 0x0056;D = (R[3] >> 8) & 0xFF; /* 0055 "ghi r3" */
+    STATIC_FETCH(0xbe);Cycles -= 2;R[P] = 0x0057;R[14] = (R[14] & 0x00FF) | (((WORD16)D) << 8); /* 0056 "phi re" */
+    if (R[P] != 0x0057) goto staticDispatch;
+    STATIC_FETCH(0x99);Cycles -= 2;R[P] = 0x0058;D = (R[9] >> 8) & 0xFF; /* 0057 "ghi r9" */
+    STATIC_FETCH(0xee);Cycles -= 2;R[P] = 0x0059;X = 14; /* 0058 "sex re" */
+    STATIC_FETCH(0xf4);Cycles -= 2;R[P] = 0x005a;ADD(D,READ(R[X]),0); /* 0059 "add" */
+    STATIC_FETCH(0x56);Cycles -= 2;R[P] = 0x005b;WRITE(R[6],D); /* 005a "str r6" */
+    STATIC_FETCH(0xf6);Cycles -= 2;R[P] = 0x005c;DF = D & 1;D = (D >> 1) & 0x7F; /* 005b "shr" */
+    STATIC_FETCH(0xe6);Cycles -= 2;R[P] = 0x005d;X = 6; /* 005c "sex r6" */
+    STATIC_FETCH(0xf4);Cycles -= 2;R[P] = 0x005e;ADD(D,READ(R[X]),0); /* 005d "add" */
+    STATIC_FETCH(0xb9);Cycles -= 2;R[P] = 0x005f;R[9] = (R[9] & 0x00FF) | (((WORD16)D) << 8); /* 005e "phi r9" */
+    if (R[P] != 0x005f) goto staticDispatch;
+    STATIC_FETCH(0x56);Cycles -= 2;R[P] = 0x0060;WRITE(R[6],D); /* 005f "str r6" */
+    STATIC_FETCH(0x45);Cycles -= 2;R[P] = 0x0061;D = READ(R[5]);R[5]++; /* 0060 "lda r5" */
+    if (R[P] != 0x0061) goto staticDispatch;
+    STATIC_FETCH(0xf2);Cycles -= 2;R[P] = 0x0062;D = D & READ(R[X]); /* 0061 "and" */
+    STATIC_FETCH(0x56);Cycles -= 2;R[P] = 0x0063;WRITE(R[6],D); /* 0062 "str r6" */
+    STATIC_FETCH(0xd4);Cycles -= 2;R[P] = 0x0064;P = 4; /* 0063 "sep r4" */
+    goto staticDispatch;
+_s0064:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0x00);Cycles -= 2;R[P] = 0x0065;R[P]--;IDLE(2); /* 0064 "idl" */
+    goto _s0064;
+_s006b:
+    STATIC_HOOK();
+    if (Cycles - 24 < limit) goto staticLeave;
+    STATIC_FETCH(0x96);Cycles -= 2;R[P] = 0x006c;D = (R[6] >> 8) & 0xFF; /* 006b "ghi r6" */
+    STATIC_FETCH(0xb7);Cycles -= 2;R[P] = 0x006d;R[7] = (R[7] & 0x00FF) | (((WORD16)D) << 8); /* 006c "phi r7" */
+    if (R[P] != 0x006d) goto staticDispatch;
+    STATIC_FETCH(0x94);Cycles -= 2;R[P] = 0x006e;D = (R[4] >> 8) & 0xFF; /* 006d "ghi r4" */
+    STATIC_FETCH(0xbc);Cycles -= 2;R[P] = 0x006f;R[12] = (R[12] & 0x00FF) | (((WORD16)D) << 8); /* 006e "phi rc" */
+    if (R[P] != 0x006f) goto staticDispatch;
+    STATIC_FETCH(0x45);Cycles -= 2;R[P] = 0x0070;D = READ(R[5]);R[5]++; /* 006f "lda r5" */
+    if (R[P] != 0x0070) goto staticDispatch;
+    STATIC_FETCH(0xac);Cycles -= 2;R[P] = 0x0071;R[12] = (R[12] & 0xFF00) | D; /* 0070 "plo rc" */
+    if (R[P] != 0x0071) goto staticDispatch;
+    STATIC_FETCH(0xaf);Cycles -= 2;R[P] = 0x0072;R[15] = (R[15] & 0xFF00) | D; /* 0071 "plo rf" */
+    if (R[P] != 0x0072) goto staticDispatch;
+    STATIC_FETCH(0xf6);Cycles -= 2;R[P] = 0x0073;DF = D & 1;D = (D >> 1) & 0x7F; /* 0072 "shr" */
+    STATIC_FETCH(0xf6);Cycles -= 2;R[P] = 0x0074;DF = D & 1;D = (D >> 1) & 0x7F; /* 0073 "shr" */
+    STATIC_FETCH(0xf6);Cycles -= 2;R[P] = 0x0075;DF = D & 1;D = (D >> 1) & 0x7F; /* 0074 "shr" */
+    STATIC_FETCH(0xf6);Cycles -= 2;R[P] = 0x0076;DF = D & 1;D = (D >> 1) & 0x7F; /* 0075 "shr" */
+    STATIC_FETCH(0x32);Cycles -= 2;R[P] = 0x0078;_temp = 0x94; if ((D == 0)) SHORT(_temp); /* 0076 "bz .1" */
+    if (R[P] == 0x0094) goto _s0094;
+    goto _s0078;
+_s0078:
+    if (Cycles - 38 < limit) goto staticLeave;
+    STATIC_FETCH(0xf9);Cycles -= 2;R[P] = 0x007a;D = D | 0xe0; /* 0078 "ori .1" */
+    STATIC_FETCH(0xac);Cycles -= 2;R[P] = 0x007b;R[12] = (R[12] & 0xFF00) | D; /* 007a "plo rc" */
+    if (R[P] != 0x007b) goto staticDispatch;
+    STATIC_FETCH(0x8f);Cycles -= 2;R[P] = 0x007c;D = R[15] & 0xFF; /* 007b "glo rf" */
+    STATIC_FETCH(0xfa);Cycles -= 2;R[P] = 0x007e;D = D & 0x0f; /* 007c "ani .1" */
+    STATIC_FETCH(0xf9);Cycles -= 2;R[P] = 0x0080;D = D | 0xc0; /* 007e "ori .1" */
+    STATIC_FETCH(0xa6);Cycles -= 2;R[P] = 0x0081;R[6] = (R[6] & 0xFF00) | D; /* 0080 "plo r6" */
+    if (R[P] != 0x0081) goto staticDispatch;
+    STATIC_FETCH(0x05);Cycles -= 2;R[P] = 0x0082;D = READ(R[5]); /* 0081 "ldn r5" */
+    STATIC_FETCH(0xf6);Cycles -= 2;R[P] = 0x0083;DF = D & 1;D = (D >> 1) & 0x7F; /* 0082 "shr" */
+    STATIC_FETCH(0xf6);Cycles -= 2;R[P] = 0x0084;DF = D & 1;D = (D >> 1) & 0x7F; /* 0083 "shr" */
+    STATIC_FETCH(0xf6);Cycles -= 2;R[P] = 0x0085;DF = D & 1;D = (D >> 1) & 0x7F; /* 0084 "shr" */
+    STATIC_FETCH(0xf6);Cycles -= 2;R[P] = 0x0086;DF = D & 1;D = (D >> 1) & 0x7F; /* 0085 "shr" */
+    STATIC_FETCH(0xf9);Cycles -= 2;R[P] = 0x0088;D = D | 0xc0; /* 0086 "ori .1" */
+    STATIC_FETCH(0xa7);Cycles -= 2;R[P] = 0x0089;R[7] = (R[7] & 0xFF00) | D; /* 0088 "plo r7" */
+    if (R[P] != 0x0089) goto staticDispatch;
+    STATIC_FETCH(0x4c);Cycles -= 2;R[P] = 0x008a;D = READ(R[12]);R[12]++; /* 0089 "lda rc" */
+    if (R[P] != 0x008a) goto staticDispatch;
+    STATIC_FETCH(0xb3);Cycles -= 2;R[P] = 0x008b;R[3] = (R[3] & 0x00FF) | (((WORD16)D) << 8); /* 008a "phi r3" */
+    if (R[P] != 0x008b) goto staticDispatch;
+    STATIC_FETCH(0x8c);Cycles -= 2;R[P] = 0x008c;D = R[12] & 0xFF; /* 008b "glo rc" */
+    STATIC_FETCH(0xfc);Cycles -= 2;R[P] = 0x008e;ADD(D,0x0f,0); /* 008c "adi .1" */
+    STATIC_FETCH(0xac);Cycles -= 2;R[P] = 0x008f;R[12] = (R[12] & 0xFF00) | D; /* 008e "plo rc" */
+    if (R[P] != 0x008f) goto staticDispatch;
+    STATIC_FETCH(0x4c);Cycles -= 2;R[P] = 0x0090;D = READ(R[12]);R[12]++; /* 008f "lda rc" */
+    if (R[P] != 0x0090) goto staticDispatch;
+    goto _s0090;
+_s0090:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0xa3);Cycles -= 2;R[P] = 0x0091;R[3] = (R[3] & 0xFF00) | D; /* 0090 "plo r3" */
+    if (R[P] != 0x0091) goto staticDispatch;
+    STATIC_FETCH(0xd3);Cycles -= 2;R[P] = 0x0092;P = 3; /* 0091 "sep r3" */
+    goto staticDispatch;
+_s0092:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0x30);Cycles -= 2;R[P] = 0x0094;_temp = 0x6b;SHORT(_temp); /* 0092 "br .1" */
+    goto _s006b;
+_s0094:
+    if (Cycles - 10 < limit) goto staticLeave;
+    STATIC_FETCH(0x8f);Cycles -= 2;R[P] = 0x0095;D = R[15] & 0xFF; /* 0094 "glo rf" */
+    STATIC_FETCH(0xfa);Cycles -= 2;R[P] = 0x0097;D = D & 0x0f; /* 0095 "ani .1" */
+    STATIC_FETCH(0xb3);Cycles -= 2;R[P] = 0x0098;R[3] = (R[3] & 0x00FF) | (((WORD16)D) << 8); /* 0097 "phi r3" */
+    if (R[P] != 0x0098) goto staticDispatch;
+    STATIC_FETCH(0x45);Cycles -= 2;R[P] = 0x0099;D = READ(R[5]);R[5]++; /* 0098 "lda r5" */
+    if (R[P] != 0x0099) goto staticDispatch;
+    STATIC_FETCH(0x30);Cycles -= 2;R[P] = 0x009b;_temp = 0x90;SHORT(_temp); /* 0099 "br .1" */
+    goto _s0090;
+_s009b:
+    if (Cycles - 20 < limit) goto staticLeave;
+    STATIC_FETCH(0x22);Cycles -= 2;R[P] = 0x009c;R[2]--; /* 009b "dec r2" */
+    if (R[P] != 0x009c) goto staticDispatch;
+    STATIC_FETCH(0xe2);Cycles -= 2;R[P] = 0x009d;X = 2; /* 009c "sex r2" */
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x009f;D = 0xd3; /* 009d "ldi .1" */
+    STATIC_FETCH(0x73);Cycles -= 2;R[P] = 0x00a0;WRITE(R[X],D);R[X]--; /* 009f "stxd" */
+    if (R[P] != 0x00a0) goto staticDispatch;
+    STATIC_FETCH(0x45);Cycles -= 2;R[P] = 0x00a1;D = READ(R[5]);R[5]++; /* 00a0 "lda r5" */
+    if (R[P] != 0x00a1) goto staticDispatch;
+    STATIC_FETCH(0xf9);Cycles -= 2;R[P] = 0x00a3;D = D | 0xf0; /* 00a1 "ori .1" */
+    STATIC_FETCH(0x52);Cycles -= 2;R[P] = 0x00a4;WRITE(R[2],D); /* 00a3 "str r2" */
+    STATIC_FETCH(0xe6);Cycles -= 2;R[P] = 0x00a5;X = 6; /* 00a4 "sex r6" */
+    STATIC_FETCH(0x47);Cycles -= 2;R[P] = 0x00a6;D = READ(R[7]);R[7]++; /* 00a5 "lda r7" */
+    if (R[P] != 0x00a6) goto staticDispatch;
+    STATIC_FETCH(0xd2);Cycles -= 2;R[P] = 0x00a7;P = 2; /* 00a6 "sep r2" */
+    goto staticDispatch;
+_s00a7:
+    if (Cycles - 14 < limit) goto staticLeave;
+    STATIC_FETCH(0x56);Cycles -= 2;R[P] = 0x00a8;WRITE(R[6],D); /* 00a7 "str r6" */
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x00aa;D = 0xcb; /* 00a8 "ldi .1" */
+    STATIC_FETCH(0xa6);Cycles -= 2;R[P] = 0x00ab;R[6] = (R[6] & 0xFF00) | D; /* 00aa "plo r6" */
+    if (R[P] != 0x00ab) goto staticDispatch;
+    STATIC_FETCH(0x91);Cycles -= 2;R[P] = 0x00ac;D = (R[1] >> 8) & 0xFF; /* 00ab "ghi r1" */
+    STATIC_FETCH(0x7e);Cycles -= 2;R[P] = 0x00ad;_temp = D;D = (D << 1) | DF;DF = (_temp >> 7) & 1; /* 00ac "rshl" */
+    STATIC_FETCH(0x56);Cycles -= 2;R[P] = 0x00ae;WRITE(R[6],D); /* 00ad "str r6" */
+    STATIC_FETCH(0xd4);Cycles -= 2;R[P] = 0x00af;P = 4; /* 00ae "sep r4" */
+    goto staticDispatch;
+_s00af:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0x86);Cycles -= 2;R[P] = 0x00b0;D = R[6] & 0xFF; /* 00af "glo r6" */
+    STATIC_FETCH(0xfb);Cycles -= 2;R[P] = 0x00b2;D = D ^ 0xc0; /* 00b0 "xri .1" */
+    STATIC_FETCH(0x3a);Cycles -= 2;R[P] = 0x00b4;_temp = 0x52; if (!((D == 0))) SHORT(_temp); /* 00b2 "bnz .1" */
+    if (R[P] == 0x0052) goto _s0052;
+    goto _s00b4;
+_s00b4:
+    if (Cycles - 10 < limit) goto staticLeave;
+    STATIC_FETCH(0x42);Cycles -= 2;R[P] = 0x00b5;D = READ(R[2]);R[2]++; /* 00b4 "lda r2" */
+    if (R[P] != 0x00b5) goto staticDispatch;
+    STATIC_FETCH(0xb5);Cycles -= 2;R[P] = 0x00b6;R[5] = (R[5] & 0x00FF) | (((WORD16)D) << 8); /* 00b5 "phi r5" */
+    if (R[P] != 0x00b6) goto staticDispatch;
+    STATIC_FETCH(0x42);Cycles -= 2;R[P] = 0x00b7;D = READ(R[2]);R[2]++; /* 00b6 "lda r2" */
+    if (R[P] != 0x00b7) goto staticDispatch;
+    STATIC_FETCH(0xa5);Cycles -= 2;R[P] = 0x00b8;R[5] = (R[5] & 0xFF00) | D; /* 00b7 "plo r5" */
+    if (R[P] != 0x00b8) goto staticDispatch;
+    STATIC_FETCH(0xd4);Cycles -= 2;R[P] = 0x00b9;P = 4; /* 00b8 "sep r4" */
+    goto staticDispatch;
+_s00b9:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0x45);Cycles -= 2;R[P] = 0x00ba;D = READ(R[5]);R[5]++; /* 00b9 "lda r5" */
+    if (R[P] != 0x00ba) goto staticDispatch;
+    STATIC_FETCH(0x56);Cycles -= 2;R[P] = 0x00bb;WRITE(R[6],D); /* 00ba "str r6" */
+    STATIC_FETCH(0xd4);Cycles -= 2;R[P] = 0x00bc;P = 4; /* 00bb "sep r4" */
+    goto staticDispatch;
+_s00bc:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0x64);Cycles -= 2;R[P] = 0x00bd;UPDATEIO(4,READ(R[X]));R[X]++; /* 00bc "out 4" */
+    if (R[P] != 0x00bd) goto staticDispatch;
+    STATIC_FETCH(0x0a);Cycles -= 2;R[P] = 0x00be;D = READ(R[10]); /* 00bd "ldn ra" */
+    STATIC_FETCH(0x01);Cycles -= 2;R[P] = 0x00bf;D = READ(R[1]); /* 00be "ldn r1" */
+    goto _s00bf;
+_s00bf:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0x06);Cycles -= 2;R[P] = 0x00c0;D = READ(R[6]); /* 00bf "ldn r6" */
+    STATIC_FETCH(0x3a);Cycles -= 2;R[P] = 0x00c2;_temp = 0xc7; if (!((D == 0))) SHORT(_temp); /* 00c0 "bnz .1" */
+    if (R[P] == 0x00c7) goto _s00c7;
+    goto _s00c2;
+_s00c2:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0x15);Cycles -= 2;R[P] = 0x00c3;R[5]++; /* 00c2 "inc r5" */
+    if (R[P] != 0x00c3) goto staticDispatch;
+    STATIC_FETCH(0xd4);Cycles -= 2;R[P] = 0x00c4;P = 4; /* 00c3 "sep r4" */
+    goto staticDispatch;
+_s00c4:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0x06);Cycles -= 2;R[P] = 0x00c5;D = READ(R[6]); /* 00c4 "ldn r6" */
+    STATIC_FETCH(0x3a);Cycles -= 2;R[P] = 0x00c7;_temp = 0xc2; if (!((D == 0))) SHORT(_temp); /* 00c5 "bnz .1" */
+    if (R[P] == 0x00c2) goto _s00c2;
+    goto _s00c7;
+_s00c7:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0x05);Cycles -= 2;R[P] = 0x00c8;D = READ(R[5]); /* 00c7 "ldn r5" */
+    STATIC_FETCH(0xa5);Cycles -= 2;R[P] = 0x00c9;R[5] = (R[5] & 0xFF00) | D; /* 00c8 "plo r5" */
+    if (R[P] != 0x00c9) goto staticDispatch;
+    STATIC_FETCH(0xd4);Cycles -= 2;R[P] = 0x00ca;P = 4; /* 00c9 "sep r4" */
+    goto staticDispatch;
+_s00ca:
+    if (Cycles - 16 < limit) goto staticLeave;
+    STATIC_FETCH(0x15);Cycles -= 2;R[P] = 0x00cb;R[5]++; /* 00ca "inc r5" */
+    if (R[P] != 0x00cb) goto staticDispatch;
+    STATIC_FETCH(0x85);Cycles -= 2;R[P] = 0x00cc;D = R[5] & 0xFF; /* 00cb "glo r5" */
+    STATIC_FETCH(0x22);Cycles -= 2;R[P] = 0x00cd;R[2]--; /* 00cc "dec r2" */
+    if (R[P] != 0x00cd) goto staticDispatch;
+    STATIC_FETCH(0x52);Cycles -= 2;R[P] = 0x00ce;WRITE(R[2],D); /* 00cd "str r2" */
+    STATIC_FETCH(0x95);Cycles -= 2;R[P] = 0x00cf;D = (R[5] >> 8) & 0xFF; /* 00ce "ghi r5" */
+    STATIC_FETCH(0x22);Cycles -= 2;R[P] = 0x00d0;R[2]--; /* 00cf "dec r2" */
+    if (R[P] != 0x00d0) goto staticDispatch;
+    STATIC_FETCH(0x52);Cycles -= 2;R[P] = 0x00d1;WRITE(R[2],D); /* 00d0 "str r2" */
+    STATIC_FETCH(0x25);Cycles -= 2;R[P] = 0x00d2;R[5]--; /* 00d1 "dec r5" */
+    if (R[P] != 0x00d2) goto staticDispatch;
+    goto _s00d2;
+_s00d2:
+    if (Cycles - 12 < limit) goto staticLeave;
+    STATIC_FETCH(0x45);Cycles -= 2;R[P] = 0x00d3;D = READ(R[5]);R[5]++; /* 00d2 "lda r5" */
+    if (R[P] != 0x00d3) goto staticDispatch;
+    STATIC_FETCH(0xa5);Cycles -= 2;R[P] = 0x00d4;R[5] = (R[5] & 0xFF00) | D; /* 00d3 "plo r5" */
+    if (R[P] != 0x00d4) goto staticDispatch;
+    STATIC_FETCH(0x86);Cycles -= 2;R[P] = 0x00d5;D = R[6] & 0xFF; /* 00d4 "glo r6" */
+    STATIC_FETCH(0xfa);Cycles -= 2;R[P] = 0x00d7;D = D & 0x0f; /* 00d5 "ani .1" */
+    STATIC_FETCH(0xb5);Cycles -= 2;R[P] = 0x00d8;R[5] = (R[5] & 0x00FF) | (((WORD16)D) << 8); /* 00d7 "phi r5" */
+    if (R[P] != 0x00d8) goto staticDispatch;
+    STATIC_FETCH(0xd4);Cycles -= 2;R[P] = 0x00d9;P = 4; /* 00d8 "sep r4" */
+    goto staticDispatch;
+_s00d9:
+    if (Cycles - 12 < limit) goto staticLeave;
+    STATIC_FETCH(0x86);Cycles -= 2;R[P] = 0x00da;D = R[6] & 0xFF; /* 00d9 "glo r6" */
+    STATIC_FETCH(0xfa);Cycles -= 2;R[P] = 0x00dc;D = D & 0x0f; /* 00da "ani .1" */
+    STATIC_FETCH(0xba);Cycles -= 2;R[P] = 0x00dd;R[10] = (R[10] & 0x00FF) | (((WORD16)D) << 8); /* 00dc "phi ra" */
+    if (R[P] != 0x00dd) goto staticDispatch;
+    STATIC_FETCH(0x45);Cycles -= 2;R[P] = 0x00de;D = READ(R[5]);R[5]++; /* 00dd "lda r5" */
+    if (R[P] != 0x00de) goto staticDispatch;
+    STATIC_FETCH(0xaa);Cycles -= 2;R[P] = 0x00df;R[10] = (R[10] & 0xFF00) | D; /* 00de "plo ra" */
+    if (R[P] != 0x00df) goto staticDispatch;
+    STATIC_FETCH(0xd4);Cycles -= 2;R[P] = 0x00e0;P = 4; /* 00df "sep r4" */
+    goto staticDispatch;
+_s00e0:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0x00);Cycles -= 2;R[P] = 0x00e1;R[P]--;IDLE(2); /* 00e0 "idl" */
+    goto _s00e0;
+_s0100:
+    STATIC_ROUTINE();
+    if (Cycles - 34 < limit) goto staticLeave;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x0102;D = 0xc9; /* 0100 "ldi .1" */
+    STATIC_FETCH(0xa7);Cycles -= 2;R[P] = 0x0103;R[7] = (R[7] & 0xFF00) | D; /* 0102 "plo r7" */
+    if (R[P] != 0x0103) goto staticDispatch;
+    STATIC_FETCH(0x07);Cycles -= 2;R[P] = 0x0104;D = READ(R[7]); /* 0103 "ldn r7" */
+    STATIC_FETCH(0xfe);Cycles -= 2;R[P] = 0x0105;DF = (D >> 7); D = D << 1; /* 0104 "shl" */
+    STATIC_FETCH(0xfe);Cycles -= 2;R[P] = 0x0106;DF = (D >> 7); D = D << 1; /* 0105 "shl" */
+    STATIC_FETCH(0xfe);Cycles -= 2;R[P] = 0x0107;DF = (D >> 7); D = D << 1; /* 0106 "shl" */
+    STATIC_FETCH(0xfe);Cycles -= 2;R[P] = 0x0108;DF = (D >> 7); D = D << 1; /* 0107 "shl" */
+    STATIC_FETCH(0xa6);Cycles -= 2;R[P] = 0x0109;R[6] = (R[6] & 0xFF00) | D; /* 0108 "plo r6" */
+    if (R[P] != 0x0109) goto staticDispatch;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x010b;D = 0xd0; /* 0109 "ldi .1" */
+    STATIC_FETCH(0xe7);Cycles -= 2;R[P] = 0x010c;X = 7; /* 010b "sex r7" */
+    STATIC_FETCH(0xf4);Cycles -= 2;R[P] = 0x010d;ADD(D,READ(R[X]),0); /* 010c "add" */
+    STATIC_FETCH(0xa7);Cycles -= 2;R[P] = 0x010e;R[7] = (R[7] & 0xFF00) | D; /* 010d "plo r7" */
+    if (R[P] != 0x010e) goto staticDispatch;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x0110;D = 0x02; /* 010e "ldi .1" */
+    STATIC_FETCH(0xbc);Cycles -= 2;R[P] = 0x0111;R[12] = (R[12] & 0x00FF) | (((WORD16)D) << 8); /* 0110 "phi rc" */
+    if (R[P] != 0x0111) goto staticDispatch;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x0113;D = 0x92; /* 0111 "ldi .1" */
+    STATIC_FETCH(0xac);Cycles -= 2;R[P] = 0x0114;R[12] = (R[12] & 0xFF00) | D; /* 0113 "plo rc" */
+    if (R[P] != 0x0114) goto staticDispatch;
+    STATIC_FETCH(0xdc);Cycles -= 2;R[P] = 0x0115;P = 12; /* 0114 "sep rc" */
+    goto staticDispatch;
+_s0115:
+    if (Cycles - 8 < limit) goto staticLeave;
+    STATIC_FETCH(0x10);Cycles -= 2;R[P] = 0x0116;R[0]++; /* 0115 "inc r0" */
+    if (R[P] != 0x0116) goto staticDispatch;
+    STATIC_FETCH(0x0f);Cycles -= 2;R[P] = 0x0117;D = READ(R[15]); /* 0116 "ldn rf" */
+    STATIC_FETCH(0xbd);Cycles -= 2;R[P] = 0x0118;R[13] = (R[13] & 0x00FF) | (((WORD16)D) << 8); /* 0117 "phi rd" */
+    if (R[P] != 0x0118) goto staticDispatch;
+    STATIC_FETCH(0xdc);Cycles -= 2;R[P] = 0x0119;P = 12; /* 0118 "sep rc" */
+    goto staticDispatch;
+_s0119:
+    if (Cycles - 26 < limit) goto staticLeave;
+    STATIC_FETCH(0x08);Cycles -= 2;R[P] = 0x011a;D = READ(R[8]); /* 0119 "ldn r8" */
+    STATIC_FETCH(0x0f);Cycles -= 2;R[P] = 0x011b;D = READ(R[15]); /* 011a "ldn rf" */
+    STATIC_FETCH(0xfa);Cycles -= 2;R[P] = 0x011d;D = D & 0x0f; /* 011b "ani .1" */
+    STATIC_FETCH(0xae);Cycles -= 2;R[P] = 0x011e;R[14] = (R[14] & 0xFF00) | D; /* 011d "plo re" */
+    if (R[P] != 0x011e) goto staticDispatch;
+    STATIC_FETCH(0x0f);Cycles -= 2;R[P] = 0x011f;D = READ(R[15]); /* 011e "ldn rf" */
+    STATIC_FETCH(0xfa);Cycles -= 2;R[P] = 0x0121;D = D & 0x80; /* 011f "ani .1" */
+    STATIC_FETCH(0xbe);Cycles -= 2;R[P] = 0x0122;R[14] = (R[14] & 0x00FF) | (((WORD16)D) << 8); /* 0121 "phi re" */
+    if (R[P] != 0x0122) goto staticDispatch;
+    STATIC_FETCH(0x07);Cycles -= 2;R[P] = 0x0123;D = READ(R[7]); /* 0122 "ldn r7" */
+    STATIC_FETCH(0xad);Cycles -= 2;R[P] = 0x0124;R[13] = (R[13] & 0xFF00) | D; /* 0123 "plo rd" */
+    if (R[P] != 0x0124) goto staticDispatch;
+    STATIC_FETCH(0x25);Cycles -= 2;R[P] = 0x0125;R[5]--; /* 0124 "dec r5" */
+    if (R[P] != 0x0125) goto staticDispatch;
+    STATIC_FETCH(0x45);Cycles -= 2;R[P] = 0x0126;D = READ(R[5]);R[5]++; /* 0125 "lda r5" */
+    if (R[P] != 0x0126) goto staticDispatch;
+    STATIC_FETCH(0xf6);Cycles -= 2;R[P] = 0x0127;DF = D & 1;D = (D >> 1) & 0x7F; /* 0126 "shr" */
+    STATIC_FETCH(0x33);Cycles -= 2;R[P] = 0x0129;_temp = 0x4e; if ((DF != 0)) SHORT(_temp); /* 0127 "bdf .1" */
+    if (R[P] == 0x014e) goto _s014e;
+    goto _s0129;
+_s0129:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0xf6);Cycles -= 2;R[P] = 0x012a;DF = D & 1;D = (D >> 1) & 0x7F; /* 0129 "shr" */
+    STATIC_FETCH(0x33);Cycles -= 2;R[P] = 0x012c;_temp = 0x49; if ((DF != 0)) SHORT(_temp); /* 012a "bdf .1" */
+    if (R[P] == 0x0149) goto _s0149;
+    goto _s012c;
+_s012c:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0xf6);Cycles -= 2;R[P] = 0x012d;DF = D & 1;D = (D >> 1) & 0x7F; /* 012c "shr" */
+    STATIC_FETCH(0x33);Cycles -= 2;R[P] = 0x012f;_temp = 0x3d; if ((DF != 0)) SHORT(_temp); /* 012d "bdf .1" */
+    if (R[P] == 0x013d) goto _s013d;
+    goto _s012f;
+_s012f:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0xf6);Cycles -= 2;R[P] = 0x0130;DF = D & 1;D = (D >> 1) & 0x7F; /* 012f "shr" */
+    STATIC_FETCH(0x33);Cycles -= 2;R[P] = 0x0132;_temp = 0xbc; if ((DF != 0)) SHORT(_temp); /* 0130 "bdf .1" */
+    if (R[P] == 0x01bc) goto _s01bc;
+    goto _s0132;
+_s0132:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x0134;D = 0x10; /* 0132 "ldi .1" */
+    STATIC_FETCH(0xaf);Cycles -= 2;R[P] = 0x0135;R[15] = (R[15] & 0xFF00) | D; /* 0134 "plo rf" */
+    if (R[P] != 0x0135) goto staticDispatch;
+    goto _s0135;
+_s0135:
+    if (Cycles - 12 < limit) goto staticLeave;
+    STATIC_FETCH(0x91);Cycles -= 2;R[P] = 0x0136;D = (R[1] >> 8) & 0xFF; /* 0135 "ghi r1" */
+    STATIC_FETCH(0x56);Cycles -= 2;R[P] = 0x0137;WRITE(R[6],D); /* 0136 "str r6" */
+    STATIC_FETCH(0x16);Cycles -= 2;R[P] = 0x0138;R[6]++; /* 0137 "inc r6" */
+    if (R[P] != 0x0138) goto staticDispatch;
+    STATIC_FETCH(0x2f);Cycles -= 2;R[P] = 0x0139;R[15]--; /* 0138 "dec rf" */
+    if (R[P] != 0x0139) goto staticDispatch;
+    STATIC_FETCH(0x8f);Cycles -= 2;R[P] = 0x013a;D = R[15] & 0xFF; /* 0139 "glo rf" */
+    STATIC_FETCH(0x3a);Cycles -= 2;R[P] = 0x013c;_temp = 0x35; if (!((D == 0))) SHORT(_temp); /* 013a "bnz .1" */
+    if (R[P] == 0x0135) goto _s0135;
+    goto _s013c;
+_s013c:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0xd4);Cycles -= 2;R[P] = 0x013d;P = 4; /* 013c "sep r4" */
+    goto staticDispatch;
+_s013d:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0xe6);Cycles -= 2;R[P] = 0x013e;X = 6; /* 013d "sex r6" */
+    goto _s013e;
+_s013e:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0x8e);Cycles -= 2;R[P] = 0x013f;D = R[14] & 0xFF; /* 013e "glo re" */
+    STATIC_FETCH(0x32);Cycles -= 2;R[P] = 0x0141;_temp = 0x3c; if ((D == 0)) SHORT(_temp); /* 013f "bz .1" */
+    if (R[P] == 0x013c) goto _s013c;
+    goto _s0141;
+_s0141:
+    if (Cycles - 14 < limit) goto staticLeave;
+    STATIC_FETCH(0x4a);Cycles -= 2;R[P] = 0x0142;D = READ(R[10]);R[10]++; /* 0141 "lda ra" */
+    if (R[P] != 0x0142) goto staticDispatch;
+    STATIC_FETCH(0xf3);Cycles -= 2;R[P] = 0x0143;D = D ^ READ(R[X]); /* 0142 "xor" */
+    STATIC_FETCH(0x56);Cycles -= 2;R[P] = 0x0144;WRITE(R[6],D); /* 0143 "str r6" */
+    STATIC_FETCH(0x16);Cycles -= 2;R[P] = 0x0145;R[6]++; /* 0144 "inc r6" */
+    if (R[P] != 0x0145) goto staticDispatch;
+    STATIC_FETCH(0x16);Cycles -= 2;R[P] = 0x0146;R[6]++; /* 0145 "inc r6" */
+    if (R[P] != 0x0146) goto staticDispatch;
+    STATIC_FETCH(0x2e);Cycles -= 2;R[P] = 0x0147;R[14]--; /* 0146 "dec re" */
+    if (R[P] != 0x0147) goto staticDispatch;
+    STATIC_FETCH(0x30);Cycles -= 2;R[P] = 0x0149;_temp = 0x3e;SHORT(_temp); /* 0147 "br .1" */
+    goto _s013e;
+_s0149:
+    if (Cycles - 8 < limit) goto staticLeave;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x014b;D = 0xcc; /* 0149 "ldi .1" */
+    STATIC_FETCH(0xaf);Cycles -= 2;R[P] = 0x014c;R[15] = (R[15] & 0xFF00) | D; /* 014b "plo rf" */
+    if (R[P] != 0x014c) goto staticDispatch;
+    STATIC_FETCH(0x0f);Cycles -= 2;R[P] = 0x014d;D = READ(R[15]); /* 014c "ldn rf" */
+    STATIC_FETCH(0xbd);Cycles -= 2;R[P] = 0x014e;R[13] = (R[13] & 0x00FF) | (((WORD16)D) << 8); /* 014d "phi rd" */
+    if (R[P] != 0x014e) goto staticDispatch;
+    goto _s014e;
+_s014e:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0x9d);Cycles -= 2;R[P] = 0x014f;D = (R[13] >> 8) & 0xFF; /* 014e "ghi rd" */
+    STATIC_FETCH(0xfb);Cycles -= 2;R[P] = 0x0151;D = D ^ 0x02; /* 014f "xri .1" */
+    STATIC_FETCH(0x32);Cycles -= 2;R[P] = 0x0153;_temp = 0x63; if ((D == 0)) SHORT(_temp); /* 0151 "bz .1" */
+    if (R[P] == 0x0163) goto _s0163;
+    goto _s0153;
+_s0153:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0x9d);Cycles -= 2;R[P] = 0x0154;D = (R[13] >> 8) & 0xFF; /* 0153 "ghi rd" */
+    STATIC_FETCH(0xfb);Cycles -= 2;R[P] = 0x0156;D = D ^ 0x08; /* 0154 "xri .1" */
+    STATIC_FETCH(0x32);Cycles -= 2;R[P] = 0x0158;_temp = 0x6d; if ((D == 0)) SHORT(_temp); /* 0156 "bz .1" */
+    if (R[P] == 0x016d) goto _s016d;
+    goto _s0158;
+_s0158:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0x9d);Cycles -= 2;R[P] = 0x0159;D = (R[13] >> 8) & 0xFF; /* 0158 "ghi rd" */
+    STATIC_FETCH(0xfb);Cycles -= 2;R[P] = 0x015b;D = D ^ 0x04; /* 0159 "xri .1" */
+    STATIC_FETCH(0x32);Cycles -= 2;R[P] = 0x015d;_temp = 0x97; if ((D == 0)) SHORT(_temp); /* 015b "bz .1" */
+    if (R[P] == 0x0197) goto _s0197;
+    goto _s015d;
+_s015d:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0x9d);Cycles -= 2;R[P] = 0x015e;D = (R[13] >> 8) & 0xFF; /* 015d "ghi rd" */
+    STATIC_FETCH(0xfb);Cycles -= 2;R[P] = 0x0160;D = D ^ 0x06; /* 015e "xri .1" */
+    STATIC_FETCH(0x32);Cycles -= 2;R[P] = 0x0162;_temp = 0x72; if ((D == 0)) SHORT(_temp); /* 0160 "bz .1" */
+    if (R[P] == 0x0172) goto _s0172;
+    goto _s0162;
+_s0162:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0xd4);Cycles -= 2;R[P] = 0x0163;P = 4; /* 0162 "sep r4" */
+    goto staticDispatch;
+_s0163:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0x07);Cycles -= 2;R[P] = 0x0164;D = READ(R[7]); /* 0163 "ldn r7" */
+    STATIC_FETCH(0xff);Cycles -= 2;R[P] = 0x0166;SUB(D,0x08,1); /* 0164 "smi .1" */
+    goto _s0166;
+_s0166:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0x57);Cycles -= 2;R[P] = 0x0167;WRITE(R[7],D); /* 0166 "str r7" */
+    STATIC_FETCH(0xdc);Cycles -= 2;R[P] = 0x0168;P = 12; /* 0167 "sep rc" */
+    goto staticDispatch;
+_s0168:
+    if (Cycles - 10 < limit) goto staticLeave;
+    STATIC_FETCH(0x18);Cycles -= 2;R[P] = 0x0169;R[8]++; /* 0168 "inc r8" */
+    if (R[P] != 0x0169) goto staticDispatch;
+    STATIC_FETCH(0x93);Cycles -= 2;R[P] = 0x016a;D = (R[3] >> 8) & 0xFF; /* 0169 "ghi r3" */
+    STATIC_FETCH(0xf5);Cycles -= 2;R[P] = 0x016b;SUB(READ(R[X]),D,1); /* 016a "sd" */
+    STATIC_FETCH(0x5f);Cycles -= 2;R[P] = 0x016c;WRITE(R[15],D); /* 016b "str rf" */
+    STATIC_FETCH(0xd4);Cycles -= 2;R[P] = 0x016d;P = 4; /* 016c "sep r4" */
+    goto staticDispatch;
+_s016d:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0x07);Cycles -= 2;R[P] = 0x016e;D = READ(R[7]); /* 016d "ldn r7" */
+    STATIC_FETCH(0xfc);Cycles -= 2;R[P] = 0x0170;ADD(D,0x08,0); /* 016e "adi .1" */
+    STATIC_FETCH(0x30);Cycles -= 2;R[P] = 0x0172;_temp = 0x66;SHORT(_temp); /* 0170 "br .1" */
+    goto _s0166;
+_s0172:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0x8e);Cycles -= 2;R[P] = 0x0173;D = R[14] & 0xFF; /* 0172 "glo re" */
+    STATIC_FETCH(0x32);Cycles -= 2;R[P] = 0x0175;_temp = 0xf9; if ((D == 0)) SHORT(_temp); /* 0173 "bz .1" */
+    if (R[P] == 0x01f9) goto _s01f9;
+    goto _s0175;
+_s0175:
+    if (Cycles - 8 < limit) goto staticLeave;
+    STATIC_FETCH(0x06);Cycles -= 2;R[P] = 0x0176;D = READ(R[6]); /* 0175 "ldn r6" */
+    STATIC_FETCH(0xf6);Cycles -= 2;R[P] = 0x0177;DF = D & 1;D = (D >> 1) & 0x7F; /* 0176 "shr" */
+    STATIC_FETCH(0x56);Cycles -= 2;R[P] = 0x0178;WRITE(R[6],D); /* 0177 "str r6" */
+    STATIC_FETCH(0x3b);Cycles -= 2;R[P] = 0x017a;_temp = 0x81; if (!((DF != 0))) SHORT(_temp); /* 0178 "bnf .1" */
+    if (R[P] == 0x0181) goto _s0181;
+    goto _s017a;
+_s017a:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0x9e);Cycles -= 2;R[P] = 0x017b;D = (R[14] >> 8) & 0xFF; /* 017a "ghi re" */
+    STATIC_FETCH(0x3a);Cycles -= 2;R[P] = 0x017d;_temp = 0x81; if (!((D == 0))) SHORT(_temp); /* 017b "bnz .1" */
+    if (R[P] == 0x0181) goto _s0181;
+    goto _s017d;
+_s017d:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x017f;D = 0x80; /* 017d "ldi .1" */
+    STATIC_FETCH(0xbe);Cycles -= 2;R[P] = 0x0180;R[14] = (R[14] & 0x00FF) | (((WORD16)D) << 8); /* 017f "phi re" */
+    if (R[P] != 0x0180) goto staticDispatch;
+    STATIC_FETCH(0x1d);Cycles -= 2;R[P] = 0x0181;R[13]++; /* 0180 "inc rd" */
+    if (R[P] != 0x0181) goto staticDispatch;
+    goto _s0181;
+_s0181:
+    if (Cycles - 10 < limit) goto staticLeave;
+    STATIC_FETCH(0x16);Cycles -= 2;R[P] = 0x0182;R[6]++; /* 0181 "inc r6" */
+    if (R[P] != 0x0182) goto staticDispatch;
+    STATIC_FETCH(0x06);Cycles -= 2;R[P] = 0x0183;D = READ(R[6]); /* 0182 "ldn r6" */
+    STATIC_FETCH(0x76);Cycles -= 2;R[P] = 0x0184;_temp = D & 1;D = ((D >> 1) & 0x7F) | (DF << 7);DF = _temp; /* 0183 "rshr" */
+    STATIC_FETCH(0x56);Cycles -= 2;R[P] = 0x0185;WRITE(R[6],D); /* 0184 "str r6" */
+    STATIC_FETCH(0x3b);Cycles -= 2;R[P] = 0x0187;_temp = 0x93; if (!((DF != 0))) SHORT(_temp); /* 0185 "bnf .1" */
+    if (R[P] == 0x0193) goto _s0193;
+    goto _s0187;
+_s0187:
+    if (Cycles - 14 < limit) goto staticLeave;
+    STATIC_FETCH(0x26);Cycles -= 2;R[P] = 0x0188;R[6]--; /* 0187 "dec r6" */
+    if (R[P] != 0x0188) goto staticDispatch;
+    STATIC_FETCH(0x06);Cycles -= 2;R[P] = 0x0189;D = READ(R[6]); /* 0188 "ldn r6" */
+    STATIC_FETCH(0xf9);Cycles -= 2;R[P] = 0x018b;D = D | 0x80; /* 0189 "ori .1" */
+    STATIC_FETCH(0x56);Cycles -= 2;R[P] = 0x018c;WRITE(R[6],D); /* 018b "str r6" */
+    STATIC_FETCH(0x16);Cycles -= 2;R[P] = 0x018d;R[6]++; /* 018c "inc r6" */
+    if (R[P] != 0x018d) goto staticDispatch;
+    STATIC_FETCH(0x9e);Cycles -= 2;R[P] = 0x018e;D = (R[14] >> 8) & 0xFF; /* 018d "ghi re" */
+    STATIC_FETCH(0x32);Cycles -= 2;R[P] = 0x0190;_temp = 0x93; if ((D == 0)) SHORT(_temp); /* 018e "bz .1" */
+    if (R[P] == 0x0193) goto _s0193;
+    goto _s0190;
+_s0190:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0x91);Cycles -= 2;R[P] = 0x0191;D = (R[1] >> 8) & 0xFF; /* 0190 "ghi r1" */
+    STATIC_FETCH(0xbe);Cycles -= 2;R[P] = 0x0192;R[14] = (R[14] & 0x00FF) | (((WORD16)D) << 8); /* 0191 "phi re" */
+    if (R[P] != 0x0192) goto staticDispatch;
+    STATIC_FETCH(0x1d);Cycles -= 2;R[P] = 0x0193;R[13]++; /* 0192 "inc rd" */
+    if (R[P] != 0x0193) goto staticDispatch;
+    goto _s0193;
+_s0193:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0x16);Cycles -= 2;R[P] = 0x0194;R[6]++; /* 0193 "inc r6" */
+    if (R[P] != 0x0194) goto staticDispatch;
+    STATIC_FETCH(0x2e);Cycles -= 2;R[P] = 0x0195;R[14]--; /* 0194 "dec re" */
+    if (R[P] != 0x0195) goto staticDispatch;
+    STATIC_FETCH(0x30);Cycles -= 2;R[P] = 0x0197;_temp = 0x72;SHORT(_temp); /* 0195 "br .1" */
+    goto _s0172;
+_s0197:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0x8e);Cycles -= 2;R[P] = 0x0198;D = R[14] & 0xFF; /* 0197 "glo re" */
+    STATIC_FETCH(0x32);Cycles -= 2;R[P] = 0x019a;_temp = 0xf9; if ((D == 0)) SHORT(_temp); /* 0198 "bz .1" */
+    if (R[P] == 0x01f9) goto _s01f9;
+    goto _s019a;
+_s019a:
+    if (Cycles - 8 < limit) goto staticLeave;
+    STATIC_FETCH(0x06);Cycles -= 2;R[P] = 0x019b;D = READ(R[6]); /* 019a "ldn r6" */
+    STATIC_FETCH(0xfe);Cycles -= 2;R[P] = 0x019c;DF = (D >> 7); D = D << 1; /* 019b "shl" */
+    STATIC_FETCH(0x56);Cycles -= 2;R[P] = 0x019d;WRITE(R[6],D); /* 019c "str r6" */
+    STATIC_FETCH(0x3b);Cycles -= 2;R[P] = 0x019f;_temp = 0xa5; if (!((DF != 0))) SHORT(_temp); /* 019d "bnf .1" */
+    if (R[P] == 0x01a5) goto _s01a5;
+    goto _s019f;
+_s019f:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0x9e);Cycles -= 2;R[P] = 0x01a0;D = (R[14] >> 8) & 0xFF; /* 019f "ghi re" */
+    STATIC_FETCH(0x32);Cycles -= 2;R[P] = 0x01a2;_temp = 0xa5; if ((D == 0)) SHORT(_temp); /* 01a0 "bz .1" */
+    if (R[P] == 0x01a5) goto _s01a5;
+    goto _s01a2;
+_s01a2:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0x91);Cycles -= 2;R[P] = 0x01a3;D = (R[1] >> 8) & 0xFF; /* 01a2 "ghi r1" */
+    STATIC_FETCH(0xbe);Cycles -= 2;R[P] = 0x01a4;R[14] = (R[14] & 0x00FF) | (((WORD16)D) << 8); /* 01a3 "phi re" */
+    if (R[P] != 0x01a4) goto staticDispatch;
+    STATIC_FETCH(0x2d);Cycles -= 2;R[P] = 0x01a5;R[13]--; /* 01a4 "dec rd" */
+    if (R[P] != 0x01a5) goto staticDispatch;
+    goto _s01a5;
+_s01a5:
+    if (Cycles - 10 < limit) goto staticLeave;
+    STATIC_FETCH(0x16);Cycles -= 2;R[P] = 0x01a6;R[6]++; /* 01a5 "inc r6" */
+    if (R[P] != 0x01a6) goto staticDispatch;
+    STATIC_FETCH(0x06);Cycles -= 2;R[P] = 0x01a7;D = READ(R[6]); /* 01a6 "ldn r6" */
+    STATIC_FETCH(0x7e);Cycles -= 2;R[P] = 0x01a8;_temp = D;D = (D << 1) | DF;DF = (_temp >> 7) & 1; /* 01a7 "rshl" */
+    STATIC_FETCH(0x56);Cycles -= 2;R[P] = 0x01a9;WRITE(R[6],D); /* 01a8 "str r6" */
+    STATIC_FETCH(0x3b);Cycles -= 2;R[P] = 0x01ab;_temp = 0xb8; if (!((DF != 0))) SHORT(_temp); /* 01a9 "bnf .1" */
+    if (R[P] == 0x01b8) goto _s01b8;
+    goto _s01ab;
+_s01ab:
+    if (Cycles - 14 < limit) goto staticLeave;
+    STATIC_FETCH(0x26);Cycles -= 2;R[P] = 0x01ac;R[6]--; /* 01ab "dec r6" */
+    if (R[P] != 0x01ac) goto staticDispatch;
+    STATIC_FETCH(0x06);Cycles -= 2;R[P] = 0x01ad;D = READ(R[6]); /* 01ac "ldn r6" */
+    STATIC_FETCH(0xf9);Cycles -= 2;R[P] = 0x01af;D = D | 0x01; /* 01ad "ori .1" */
+    STATIC_FETCH(0x56);Cycles -= 2;R[P] = 0x01b0;WRITE(R[6],D); /* 01af "str r6" */
+    STATIC_FETCH(0x16);Cycles -= 2;R[P] = 0x01b1;R[6]++; /* 01b0 "inc r6" */
+    if (R[P] != 0x01b1) goto staticDispatch;
+    STATIC_FETCH(0x9e);Cycles -= 2;R[P] = 0x01b2;D = (R[14] >> 8) & 0xFF; /* 01b1 "ghi re" */
+    STATIC_FETCH(0x3a);Cycles -= 2;R[P] = 0x01b4;_temp = 0xb8; if (!((D == 0))) SHORT(_temp); /* 01b2 "bnz .1" */
+    if (R[P] == 0x01b8) goto _s01b8;
+    goto _s01b4;
+_s01b4:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x01b6;D = 0x80; /* 01b4 "ldi .1" */
+    STATIC_FETCH(0xbe);Cycles -= 2;R[P] = 0x01b7;R[14] = (R[14] & 0x00FF) | (((WORD16)D) << 8); /* 01b6 "phi re" */
+    if (R[P] != 0x01b7) goto staticDispatch;
+    STATIC_FETCH(0x2d);Cycles -= 2;R[P] = 0x01b8;R[13]--; /* 01b7 "dec rd" */
+    if (R[P] != 0x01b8) goto staticDispatch;
+    goto _s01b8;
+_s01b8:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0x16);Cycles -= 2;R[P] = 0x01b9;R[6]++; /* 01b8 "inc r6" */
+    if (R[P] != 0x01b9) goto staticDispatch;
+    STATIC_FETCH(0x2e);Cycles -= 2;R[P] = 0x01ba;R[14]--; /* 01b9 "dec re" */
+    if (R[P] != 0x01ba) goto staticDispatch;
+    STATIC_FETCH(0x30);Cycles -= 2;R[P] = 0x01bc;_temp = 0x97;SHORT(_temp); /* 01ba "br .1" */
+    goto _s0197;
+_s01bc:
+    if (Cycles - 16 < limit) goto staticLeave;
+    STATIC_FETCH(0x93);Cycles -= 2;R[P] = 0x01bd;D = (R[3] >> 8) & 0xFF; /* 01bc "ghi r3" */
+    STATIC_FETCH(0xbc);Cycles -= 2;R[P] = 0x01be;R[12] = (R[12] & 0x00FF) | (((WORD16)D) << 8); /* 01bd "phi rc" */
+    if (R[P] != 0x01be) goto staticDispatch;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x01c0;D = 0xeb; /* 01be "ldi .1" */
+    STATIC_FETCH(0xac);Cycles -= 2;R[P] = 0x01c1;R[12] = (R[12] & 0xFF00) | D; /* 01c0 "plo rc" */
+    if (R[P] != 0x01c1) goto staticDispatch;
+    STATIC_FETCH(0x91);Cycles -= 2;R[P] = 0x01c2;D = (R[1] >> 8) & 0xFF; /* 01c1 "ghi r1" */
+    STATIC_FETCH(0xaf);Cycles -= 2;R[P] = 0x01c3;R[15] = (R[15] & 0xFF00) | D; /* 01c2 "plo rf" */
+    if (R[P] != 0x01c3) goto staticDispatch;
+    STATIC_FETCH(0x9e);Cycles -= 2;R[P] = 0x01c4;D = (R[14] >> 8) & 0xFF; /* 01c3 "ghi re" */
+    STATIC_FETCH(0x32);Cycles -= 2;R[P] = 0x01c6;_temp = 0xd4; if ((D == 0)) SHORT(_temp); /* 01c4 "bz .1" */
+    if (R[P] == 0x01d4) goto _s01d4;
+    goto _s01c6;
+_s01c6:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0x2d);Cycles -= 2;R[P] = 0x01c7;R[13]--; /* 01c6 "dec rd" */
+    if (R[P] != 0x01c7) goto staticDispatch;
+    goto _s01c7;
+_s01c7:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0x8e);Cycles -= 2;R[P] = 0x01c8;D = R[14] & 0xFF; /* 01c7 "glo re" */
+    STATIC_FETCH(0x32);Cycles -= 2;R[P] = 0x01ca;_temp = 0xe1; if ((D == 0)) SHORT(_temp); /* 01c8 "bz .1" */
+    if (R[P] == 0x01e1) goto _s01e1;
+    goto _s01ca;
+_s01ca:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0xdc);Cycles -= 2;R[P] = 0x01cb;P = 12; /* 01ca "sep rc" */
+    goto staticDispatch;
+_s01cb:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0x1d);Cycles -= 2;R[P] = 0x01cc;R[13]++; /* 01cb "inc rd" */
+    if (R[P] != 0x01cc) goto staticDispatch;
+    STATIC_FETCH(0xdc);Cycles -= 2;R[P] = 0x01cd;P = 12; /* 01cc "sep rc" */
+    goto staticDispatch;
+_s01cd:
+    if (Cycles - 10 < limit) goto staticLeave;
+    STATIC_FETCH(0x8d);Cycles -= 2;R[P] = 0x01ce;D = R[13] & 0xFF; /* 01cd "glo rd" */
+    STATIC_FETCH(0xfc);Cycles -= 2;R[P] = 0x01d0;ADD(D,0x07,0); /* 01ce "adi .1" */
+    STATIC_FETCH(0xad);Cycles -= 2;R[P] = 0x01d1;R[13] = (R[13] & 0xFF00) | D; /* 01d0 "plo rd" */
+    if (R[P] != 0x01d1) goto staticDispatch;
+    STATIC_FETCH(0x2e);Cycles -= 2;R[P] = 0x01d2;R[14]--; /* 01d1 "dec re" */
+    if (R[P] != 0x01d2) goto staticDispatch;
+    STATIC_FETCH(0x30);Cycles -= 2;R[P] = 0x01d4;_temp = 0xc7;SHORT(_temp); /* 01d2 "br .1" */
+    goto _s01c7;
+_s01d4:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0x8e);Cycles -= 2;R[P] = 0x01d5;D = R[14] & 0xFF; /* 01d4 "glo re" */
+    STATIC_FETCH(0x32);Cycles -= 2;R[P] = 0x01d7;_temp = 0xe1; if ((D == 0)) SHORT(_temp); /* 01d5 "bz .1" */
+    if (R[P] == 0x01e1) goto _s01e1;
+    goto _s01d7;
+_s01d7:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0xdc);Cycles -= 2;R[P] = 0x01d8;P = 12; /* 01d7 "sep rc" */
+    goto staticDispatch;
+_s01d8:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0x2d);Cycles -= 2;R[P] = 0x01d9;R[13]--; /* 01d8 "dec rd" */
+    if (R[P] != 0x01d9) goto staticDispatch;
+    STATIC_FETCH(0xdc);Cycles -= 2;R[P] = 0x01da;P = 12; /* 01d9 "sep rc" */
+    goto staticDispatch;
+_s01da:
+    if (Cycles - 10 < limit) goto staticLeave;
+    STATIC_FETCH(0x8d);Cycles -= 2;R[P] = 0x01db;D = R[13] & 0xFF; /* 01da "glo rd" */
+    STATIC_FETCH(0xfc);Cycles -= 2;R[P] = 0x01dd;ADD(D,0x09,0); /* 01db "adi .1" */
+    STATIC_FETCH(0xad);Cycles -= 2;R[P] = 0x01de;R[13] = (R[13] & 0xFF00) | D; /* 01dd "plo rd" */
+    if (R[P] != 0x01de) goto staticDispatch;
+    STATIC_FETCH(0x2e);Cycles -= 2;R[P] = 0x01df;R[14]--; /* 01de "dec re" */
+    if (R[P] != 0x01df) goto staticDispatch;
+    STATIC_FETCH(0x30);Cycles -= 2;R[P] = 0x01e1;_temp = 0xd4;SHORT(_temp); /* 01df "br .1" */
+    goto _s01d4;
+_s01e1:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0x8f);Cycles -= 2;R[P] = 0x01e2;D = R[15] & 0xFF; /* 01e1 "glo rf" */
+    STATIC_FETCH(0x3a);Cycles -= 2;R[P] = 0x01e4;_temp = 0xe6; if (!((D == 0))) SHORT(_temp); /* 01e2 "bnz .1" */
+    if (R[P] == 0x01e6) goto _s01e6;
+    goto _s01e4;
+_s01e4:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0x15);Cycles -= 2;R[P] = 0x01e5;R[5]++; /* 01e4 "inc r5" */
+    if (R[P] != 0x01e5) goto staticDispatch;
+    STATIC_FETCH(0xd4);Cycles -= 2;R[P] = 0x01e6;P = 4; /* 01e5 "sep r4" */
+    goto staticDispatch;
+_s01e6:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0x05);Cycles -= 2;R[P] = 0x01e7;D = READ(R[5]); /* 01e6 "ldn r5" */
+    STATIC_FETCH(0xa5);Cycles -= 2;R[P] = 0x01e8;R[5] = (R[5] & 0xFF00) | D; /* 01e7 "plo r5" */
+    if (R[P] != 0x01e8) goto staticDispatch;
+    STATIC_FETCH(0xd4);Cycles -= 2;R[P] = 0x01e9;P = 4; /* 01e8 "sep r4" */
+    goto staticDispatch;
+_s01e9:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0x16);Cycles -= 2;R[P] = 0x01ea;R[6]++; /* 01e9 "inc r6" */
+    if (R[P] != 0x01ea) goto staticDispatch;
+    STATIC_FETCH(0xd3);Cycles -= 2;R[P] = 0x01eb;P = 3; /* 01ea "sep r3" */
+    goto staticDispatch;
+_s01eb:
+    if (Cycles - 12 < limit) goto staticLeave;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x01ed;D = 0x09; /* 01eb "ldi .1" */
+    STATIC_FETCH(0xbd);Cycles -= 2;R[P] = 0x01ee;R[13] = (R[13] & 0x00FF) | (((WORD16)D) << 8); /* 01ed "phi rd" */
+    if (R[P] != 0x01ee) goto staticDispatch;
+    STATIC_FETCH(0xed);Cycles -= 2;R[P] = 0x01ef;X = 13; /* 01ee "sex rd" */
+    STATIC_FETCH(0x06);Cycles -= 2;R[P] = 0x01f0;D = READ(R[6]); /* 01ef "ldn r6" */
+    STATIC_FETCH(0xf2);Cycles -= 2;R[P] = 0x01f1;D = D & READ(R[X]); /* 01f0 "and" */
+    STATIC_FETCH(0x32);Cycles -= 2;R[P] = 0x01f3;_temp = 0xf4; if ((D == 0)) SHORT(_temp); /* 01f1 "bz .1" */
+    if (R[P] == 0x01f4) goto _s01f4;
+    goto _s01f3;
+_s01f3:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0xaf);Cycles -= 2;R[P] = 0x01f4;R[15] = (R[15] & 0xFF00) | D; /* 01f3 "plo rf" */
+    if (R[P] != 0x01f4) goto staticDispatch;
+    goto _s01f4;
+_s01f4:
+    if (Cycles - 8 < limit) goto staticLeave;
+    STATIC_FETCH(0x06);Cycles -= 2;R[P] = 0x01f5;D = READ(R[6]); /* 01f4 "ldn r6" */
+    STATIC_FETCH(0xf3);Cycles -= 2;R[P] = 0x01f6;D = D ^ READ(R[X]); /* 01f5 "xor" */
+    STATIC_FETCH(0x5d);Cycles -= 2;R[P] = 0x01f7;WRITE(R[13],D); /* 01f6 "str rd" */
+    STATIC_FETCH(0x30);Cycles -= 2;R[P] = 0x01f9;_temp = 0xe9;SHORT(_temp); /* 01f7 "br .1" */
+    goto _s01e9;
+_s01f9:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0xdc);Cycles -= 2;R[P] = 0x01fa;P = 12; /* 01f9 "sep rc" */
+    goto staticDispatch;
+_s01fa:
+    if (Cycles - 10 < limit) goto staticLeave;
+    STATIC_FETCH(0x20);Cycles -= 2;R[P] = 0x01fb;R[0]--; /* 01fa "dec r0" */
+    if (R[P] != 0x01fb) goto staticDispatch;
+    STATIC_FETCH(0x0f);Cycles -= 2;R[P] = 0x01fc;D = READ(R[15]); /* 01fb "ldn rf" */
+    STATIC_FETCH(0xff);Cycles -= 2;R[P] = 0x01fe;SUB(D,0x01,1); /* 01fc "smi .1" */
+    STATIC_FETCH(0x5f);Cycles -= 2;R[P] = 0x01ff;WRITE(R[15],D); /* 01fe "str rf" */
+    STATIC_FETCH(0xdc);Cycles -= 2;R[P] = 0x0200;P = 12; /* 01ff "sep rc" */
+    goto staticDispatch;
+_s0200:
+    if (Cycles - 20 < limit) goto staticLeave;
+    STATIC_FETCH(0x08);Cycles -= 2;R[P] = 0x0201;D = READ(R[8]); /* 0200 "ldn r8" */
+    STATIC_FETCH(0x0f);Cycles -= 2;R[P] = 0x0202;D = READ(R[15]); /* 0201 "ldn rf" */
+    STATIC_FETCH(0xfa);Cycles -= 2;R[P] = 0x0204;D = D & 0x0f; /* 0202 "ani .1" */
+    STATIC_FETCH(0x5f);Cycles -= 2;R[P] = 0x0205;WRITE(R[15],D); /* 0204 "str rf" */
+    STATIC_FETCH(0x9e);Cycles -= 2;R[P] = 0x0206;D = (R[14] >> 8) & 0xFF; /* 0205 "ghi re" */
+    STATIC_FETCH(0xf1);Cycles -= 2;R[P] = 0x0207;D = D | READ(R[X]); /* 0206 "or" */
+    STATIC_FETCH(0x5f);Cycles -= 2;R[P] = 0x0208;WRITE(R[15],D); /* 0207 "str rf" */
+    STATIC_FETCH(0x8d);Cycles -= 2;R[P] = 0x0209;D = R[13] & 0xFF; /* 0208 "glo rd" */
+    STATIC_FETCH(0x57);Cycles -= 2;R[P] = 0x020a;WRITE(R[7],D); /* 0209 "str r7" */
+    STATIC_FETCH(0xd4);Cycles -= 2;R[P] = 0x020b;P = 4; /* 020a "sep r4" */
+    goto staticDispatch;
+_s020b:
+    if (Cycles - 7 < limit) goto staticLeave;
+    STATIC_FETCH(0x22);Cycles -= 2;R[P] = 0x020c;R[2]--; /* 020b "dec r2" */
+    if (R[P] != 0x020c) goto staticDispatch;
+    STATIC_FETCH(0xf9);Cycles -= 2;R[P] = 0x020e;D = D | 0x23; /* 020c "ori .1" */
+    STATIC_FETCH(0xc3);Cycles -= 2;R[P] = 0x0211;Cycles--;{ _temp = 0xc02f; };if ((DF != 0)) LONG(_temp); /* 020e "lbdf .2" */
+    if (R[P] == 0xc02f) goto staticDispatch;
+    goto _s0211;
+_s0211:
+    if (Cycles - 8 < limit) goto staticLeave;
+    STATIC_FETCH(0x1a);Cycles -= 2;R[P] = 0x0212;R[10]++; /* 0211 "inc ra" */
+    if (R[P] != 0x0212) goto staticDispatch;
+    STATIC_FETCH(0x25);Cycles -= 2;R[P] = 0x0213;R[5]--; /* 0212 "dec r5" */
+    if (R[P] != 0x0213) goto staticDispatch;
+    STATIC_FETCH(0x1f);Cycles -= 2;R[P] = 0x0214;R[15]++; /* 0213 "inc rf" */
+    if (R[P] != 0x0214) goto staticDispatch;
+    STATIC_FETCH(0x38);Cycles -= 2;R[P] = 0x0216;_temp = 0x23; /* 0214 "skp" */
+    goto _s0216;
+_s0216:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0x27);Cycles -= 2;R[P] = 0x0217;R[7]--; /* 0216 "dec r7" */
+    if (R[P] != 0x0217) goto staticDispatch;
+    STATIC_FETCH(0x33);Cycles -= 2;R[P] = 0x0219;_temp = 0x29; if ((DF != 0)) SHORT(_temp); /* 0217 "bdf .1" */
+    if (R[P] == 0x0229) goto _s0229;
+    goto _s0219;
+_s0219:
+    if (Cycles - 12 < limit) goto staticLeave;
+    STATIC_FETCH(0x2b);Cycles -= 2;R[P] = 0x021a;R[11]--; /* 0219 "dec rb" */
+    if (R[P] != 0x021a) goto staticDispatch;
+    STATIC_FETCH(0x60);Cycles -= 2;R[P] = 0x021b;R[X]++; /* 021a "irx" */
+    if (R[P] != 0x021b) goto staticDispatch;
+    STATIC_FETCH(0x20);Cycles -= 2;R[P] = 0x021c;R[0]--; /* 021b "dec r0" */
+    if (R[P] != 0x021c) goto staticDispatch;
+    STATIC_FETCH(0x20);Cycles -= 2;R[P] = 0x021d;R[0]--; /* 021c "dec r0" */
+    if (R[P] != 0x021d) goto staticDispatch;
+    STATIC_FETCH(0x20);Cycles -= 2;R[P] = 0x021e;R[0]--; /* 021d "dec r0" */
+    if (R[P] != 0x021e) goto staticDispatch;
+    STATIC_FETCH(0x70);Cycles -= 2;R[P] = 0x021f;RETURN();IE = 1; /* 021e "ret" */
+    goto staticDispatch;
+_s021f:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0xf0);Cycles -= 2;R[P] = 0x0220;D = READ(R[X]); /* 021f "ldx" */
+    STATIC_FETCH(0x10);Cycles -= 2;R[P] = 0x0221;R[0]++; /* 0220 "inc r0" */
+    if (R[P] != 0x0221) goto staticDispatch;
+    STATIC_FETCH(0x70);Cycles -= 2;R[P] = 0x0222;RETURN();IE = 1; /* 0221 "ret" */
+    goto staticDispatch;
+_s0222:
+    if (Cycles - 14 < limit) goto staticLeave;
+    STATIC_FETCH(0x10);Cycles -= 2;R[P] = 0x0223;R[0]++; /* 0222 "inc r0" */
+    if (R[P] != 0x0223) goto staticDispatch;
+    STATIC_FETCH(0xf0);Cycles -= 2;R[P] = 0x0224;D = READ(R[X]); /* 0223 "ldx" */
+    STATIC_FETCH(0x80);Cycles -= 2;R[P] = 0x0225;D = R[0] & 0xFF; /* 0224 "glo r0" */
+    STATIC_FETCH(0xf0);Cycles -= 2;R[P] = 0x0226;D = READ(R[X]); /* 0225 "ldx" */
+    STATIC_FETCH(0x10);Cycles -= 2;R[P] = 0x0227;R[0]++; /* 0226 "inc r0" */
+    if (R[P] != 0x0227) goto staticDispatch;
+    STATIC_FETCH(0xf0);Cycles -= 2;R[P] = 0x0228;D = READ(R[X]); /* 0227 "ldx" */
+    STATIC_FETCH(0x80);Cycles -= 2;R[P] = 0x0229;D = R[0] & 0xFF; /* 0228 "glo r0" */
+    goto _s0229;
+_s0229:
+    if (Cycles - 40 < limit) goto staticLeave;
+    STATIC_FETCH(0xf0);Cycles -= 2;R[P] = 0x022a;D = READ(R[X]); /* 0229 "ldx" */
+    STATIC_FETCH(0x90);Cycles -= 2;R[P] = 0x022b;D = (R[0] >> 8) & 0xFF; /* 022a "ghi r0" */
+    STATIC_FETCH(0xf0);Cycles -= 2;R[P] = 0x022c;D = READ(R[X]); /* 022b "ldx" */
+    STATIC_FETCH(0x90);Cycles -= 2;R[P] = 0x022d;D = (R[0] >> 8) & 0xFF; /* 022c "ghi r0" */
+    STATIC_FETCH(0xf0);Cycles -= 2;R[P] = 0x022e;D = READ(R[X]); /* 022d "ldx" */
+    STATIC_FETCH(0x10);Cycles -= 2;R[P] = 0x022f;R[0]++; /* 022e "inc r0" */
+    if (R[P] != 0x022f) goto staticDispatch;
+    STATIC_FETCH(0xf0);Cycles -= 2;R[P] = 0x0230;D = READ(R[X]); /* 022f "ldx" */
+    STATIC_FETCH(0x90);Cycles -= 2;R[P] = 0x0231;D = (R[0] >> 8) & 0xFF; /* 0230 "ghi r0" */
+    STATIC_FETCH(0x90);Cycles -= 2;R[P] = 0x0232;D = (R[0] >> 8) & 0xFF; /* 0231 "ghi r0" */
+    STATIC_FETCH(0x90);Cycles -= 2;R[P] = 0x0233;D = (R[0] >> 8) & 0xFF; /* 0232 "ghi r0" */
+    STATIC_FETCH(0xf0);Cycles -= 2;R[P] = 0x0234;D = READ(R[X]); /* 0233 "ldx" */
+    STATIC_FETCH(0x10);Cycles -= 2;R[P] = 0x0235;R[0]++; /* 0234 "inc r0" */
+    if (R[P] != 0x0235) goto staticDispatch;
+    STATIC_FETCH(0x10);Cycles -= 2;R[P] = 0x0236;R[0]++; /* 0235 "inc r0" */
+    if (R[P] != 0x0236) goto staticDispatch;
+    STATIC_FETCH(0x10);Cycles -= 2;R[P] = 0x0237;R[0]++; /* 0236 "inc r0" */
+    if (R[P] != 0x0237) goto staticDispatch;
+    STATIC_FETCH(0x10);Cycles -= 2;R[P] = 0x0238;R[0]++; /* 0237 "inc r0" */
+    if (R[P] != 0x0238) goto staticDispatch;
+    STATIC_FETCH(0xa0);Cycles -= 2;R[P] = 0x0239;R[0] = (R[0] & 0xFF00) | D; /* 0238 "plo r0" */
+    if (R[P] != 0x0239) goto staticDispatch;
+    STATIC_FETCH(0xa0);Cycles -= 2;R[P] = 0x023a;R[0] = (R[0] & 0xFF00) | D; /* 0239 "plo r0" */
+    if (R[P] != 0x023a) goto staticDispatch;
+    STATIC_FETCH(0xf0);Cycles -= 2;R[P] = 0x023b;D = READ(R[X]); /* 023a "ldx" */
+    STATIC_FETCH(0x20);Cycles -= 2;R[P] = 0x023c;R[0]--; /* 023b "dec r0" */
+    if (R[P] != 0x023c) goto staticDispatch;
+    STATIC_FETCH(0x20);Cycles -= 2;R[P] = 0x023d;R[0]--; /* 023c "dec r0" */
+    if (R[P] != 0x023d) goto staticDispatch;
+    goto _s023d;
+_s023d:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0x86);Cycles -= 2;R[P] = 0x023e;D = R[6] & 0xFF; /* 023d "glo r6" */
+    STATIC_FETCH(0xfa);Cycles -= 2;R[P] = 0x0240;D = D & 0x0f; /* 023e "ani .1" */
+    STATIC_FETCH(0x32);Cycles -= 2;R[P] = 0x0242;_temp = 0x47; if ((D == 0)) SHORT(_temp); /* 0240 "bz .1" */
+    if (R[P] == 0x0247) goto _s0247;
+    goto _s0242;
+_s0242:
+    if (Cycles - 10 < limit) goto staticLeave;
+    STATIC_FETCH(0xe6);Cycles -= 2;R[P] = 0x0243;X = 6; /* 0242 "sex r6" */
+    STATIC_FETCH(0x45);Cycles -= 2;R[P] = 0x0244;D = READ(R[5]);R[5]++; /* 0243 "lda r5" */
+    if (R[P] != 0x0244) goto staticDispatch;
+    STATIC_FETCH(0xf4);Cycles -= 2;R[P] = 0x0245;ADD(D,READ(R[X]),0); /* 0244 "add" */
+    STATIC_FETCH(0x56);Cycles -= 2;R[P] = 0x0246;WRITE(R[6],D); /* 0245 "str r6" */
+    STATIC_FETCH(0xd4);Cycles -= 2;R[P] = 0x0247;P = 4; /* 0246 "sep r4" */
+    goto staticDispatch;
+_s0247:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0x06);Cycles -= 2;R[P] = 0x0248;D = READ(R[6]); /* 0247 "ldn r6" */
+    STATIC_FETCH(0xff);Cycles -= 2;R[P] = 0x024a;SUB(D,0x01,1); /* 0248 "smi .1" */
+    STATIC_FETCH(0x3a);Cycles -= 2;R[P] = 0x024c;_temp = 0xe1; if (!((D == 0))) SHORT(_temp); /* 024a "bnz .1" */
+    if (R[P] == 0x02e1) goto _s02e1;
+    goto _s024c;
+_s024c:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0x15);Cycles -= 2;R[P] = 0x024d;R[5]++; /* 024c "inc r5" */
+    if (R[P] != 0x024d) goto staticDispatch;
+    goto _s024d;
+_s024d:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0xd4);Cycles -= 2;R[P] = 0x024e;P = 4; /* 024d "sep r4" */
+    goto staticDispatch;
+_s024e:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0x45);Cycles -= 2;R[P] = 0x024f;D = READ(R[5]);R[5]++; /* 024e "lda r5" */
+    if (R[P] != 0x024f) goto staticDispatch;
+    goto _s024f;
+_s024f:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0xe6);Cycles -= 2;R[P] = 0x0250;X = 6; /* 024f "sex r6" */
+    STATIC_FETCH(0xf3);Cycles -= 2;R[P] = 0x0251;D = D ^ READ(R[X]); /* 0250 "xor" */
+    STATIC_FETCH(0x32);Cycles -= 2;R[P] = 0x0253;_temp = 0x4d; if ((D == 0)) SHORT(_temp); /* 0251 "bz .1" */
+    if (R[P] == 0x024d) goto _s024d;
+    goto _s0253;
+_s0253:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0x15);Cycles -= 2;R[P] = 0x0254;R[5]++; /* 0253 "inc r5" */
+    if (R[P] != 0x0254) goto staticDispatch;
+    STATIC_FETCH(0x15);Cycles -= 2;R[P] = 0x0255;R[5]++; /* 0254 "inc r5" */
+    if (R[P] != 0x0255) goto staticDispatch;
+    STATIC_FETCH(0xd4);Cycles -= 2;R[P] = 0x0256;P = 4; /* 0255 "sep r4" */
+    goto staticDispatch;
+_s0256:
+    if (Cycles - 14 < limit) goto staticLeave;
+    STATIC_FETCH(0x96);Cycles -= 2;R[P] = 0x0257;D = (R[6] >> 8) & 0xFF; /* 0256 "ghi r6" */
+    STATIC_FETCH(0xbc);Cycles -= 2;R[P] = 0x0258;R[12] = (R[12] & 0x00FF) | (((WORD16)D) << 8); /* 0257 "phi rc" */
+    if (R[P] != 0x0258) goto staticDispatch;
+    STATIC_FETCH(0x07);Cycles -= 2;R[P] = 0x0259;D = READ(R[7]); /* 0258 "ldn r7" */
+    STATIC_FETCH(0xac);Cycles -= 2;R[P] = 0x025a;R[12] = (R[12] & 0xFF00) | D; /* 0259 "plo rc" */
+    if (R[P] != 0x025a) goto staticDispatch;
+    STATIC_FETCH(0x45);Cycles -= 2;R[P] = 0x025b;D = READ(R[5]);R[5]++; /* 025a "lda r5" */
+    if (R[P] != 0x025b) goto staticDispatch;
+    STATIC_FETCH(0xf6);Cycles -= 2;R[P] = 0x025c;DF = D & 1;D = (D >> 1) & 0x7F; /* 025b "shr" */
+    STATIC_FETCH(0x33);Cycles -= 2;R[P] = 0x025e;_temp = 0x9b; if ((DF != 0)) SHORT(_temp); /* 025c "bdf .1" */
+    if (R[P] == 0x029b) goto _s029b;
+    goto _s025e;
+_s025e:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0xf6);Cycles -= 2;R[P] = 0x025f;DF = D & 1;D = (D >> 1) & 0x7F; /* 025e "shr" */
+    STATIC_FETCH(0x33);Cycles -= 2;R[P] = 0x0261;_temp = 0x6a; if ((DF != 0)) SHORT(_temp); /* 025f "bdf .1" */
+    if (R[P] == 0x026a) goto _s026a;
+    goto _s0261;
+_s0261:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0xf6);Cycles -= 2;R[P] = 0x0262;DF = D & 1;D = (D >> 1) & 0x7F; /* 0261 "shr" */
+    STATIC_FETCH(0x33);Cycles -= 2;R[P] = 0x0264;_temp = 0x6d; if ((DF != 0)) SHORT(_temp); /* 0262 "bdf .1" */
+    if (R[P] == 0x026d) goto _s026d;
+    goto _s0264;
+_s0264:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0xf6);Cycles -= 2;R[P] = 0x0265;DF = D & 1;D = (D >> 1) & 0x7F; /* 0264 "shr" */
+    STATIC_FETCH(0x33);Cycles -= 2;R[P] = 0x0267;_temp = 0x70; if ((DF != 0)) SHORT(_temp); /* 0265 "bdf .1" */
+    if (R[P] == 0x0270) goto _s0270;
+    goto _s0267;
+_s0267:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0x07);Cycles -= 2;R[P] = 0x0268;D = READ(R[7]); /* 0267 "ldn r7" */
+    STATIC_FETCH(0x30);Cycles -= 2;R[P] = 0x026a;_temp = 0x4f;SHORT(_temp); /* 0268 "br .1" */
+    goto _s024f;
+_s026a:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0x0c);Cycles -= 2;R[P] = 0x026b;D = READ(R[12]); /* 026a "ldn rc" */
+    STATIC_FETCH(0x56);Cycles -= 2;R[P] = 0x026c;WRITE(R[6],D); /* 026b "str r6" */
+    STATIC_FETCH(0xd4);Cycles -= 2;R[P] = 0x026d;P = 4; /* 026c "sep r4" */
+    goto staticDispatch;
+_s026d:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0x06);Cycles -= 2;R[P] = 0x026e;D = READ(R[6]); /* 026d "ldn r6" */
+    STATIC_FETCH(0x5c);Cycles -= 2;R[P] = 0x026f;WRITE(R[12],D); /* 026e "str rc" */
+    STATIC_FETCH(0xd4);Cycles -= 2;R[P] = 0x0270;P = 4; /* 026f "sep r4" */
+    goto staticDispatch;
+_s0270:
+    if (Cycles - 16 < limit) goto staticLeave;
+    STATIC_FETCH(0xe6);Cycles -= 2;R[P] = 0x0271;X = 6; /* 0270 "sex r6" */
+    STATIC_FETCH(0x06);Cycles -= 2;R[P] = 0x0272;D = READ(R[6]); /* 0271 "ldn r6" */
+    STATIC_FETCH(0xbf);Cycles -= 2;R[P] = 0x0273;R[15] = (R[15] & 0x00FF) | (((WORD16)D) << 8); /* 0272 "phi rf" */
+    if (R[P] != 0x0273) goto staticDispatch;
+    STATIC_FETCH(0x91);Cycles -= 2;R[P] = 0x0274;D = (R[1] >> 8) & 0xFF; /* 0273 "ghi r1" */
+    STATIC_FETCH(0xbe);Cycles -= 2;R[P] = 0x0275;R[14] = (R[14] & 0x00FF) | (((WORD16)D) << 8); /* 0274 "phi re" */
+    if (R[P] != 0x0275) goto staticDispatch;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x0277;D = 0xbc; /* 0275 "ldi .1" */
+    STATIC_FETCH(0xae);Cycles -= 2;R[P] = 0x0278;R[14] = (R[14] & 0xFF00) | D; /* 0277 "plo re" */
+    if (R[P] != 0x0278) goto staticDispatch;
+    STATIC_FETCH(0x2c);Cycles -= 2;R[P] = 0x0279;R[12]--; /* 0278 "dec rc" */
+    if (R[P] != 0x0279) goto staticDispatch;
+    goto _s0279;
+_s0279:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0x1c);Cycles -= 2;R[P] = 0x027a;R[12]++; /* 0279 "inc rc" */
+    if (R[P] != 0x027a) goto staticDispatch;
+    STATIC_FETCH(0x91);Cycles -= 2;R[P] = 0x027b;D = (R[1] >> 8) & 0xFF; /* 027a "ghi r1" */
+    STATIC_FETCH(0x5c);Cycles -= 2;R[P] = 0x027c;WRITE(R[12],D); /* 027b "str rc" */
+    goto _s027c;
+_s027c:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0x0e);Cycles -= 2;R[P] = 0x027d;D = READ(R[14]); /* 027c "ldn re" */
+    STATIC_FETCH(0xf5);Cycles -= 2;R[P] = 0x027e;SUB(READ(R[X]),D,1); /* 027d "sd" */
+    STATIC_FETCH(0x3b);Cycles -= 2;R[P] = 0x0280;_temp = 0x87; if (!((DF != 0))) SHORT(_temp); /* 027e "bnf .1" */
+    if (R[P] == 0x0287) goto _s0287;
+    goto _s0280;
+_s0280:
+    if (Cycles - 10 < limit) goto staticLeave;
+    STATIC_FETCH(0x56);Cycles -= 2;R[P] = 0x0281;WRITE(R[6],D); /* 0280 "str r6" */
+    STATIC_FETCH(0x0c);Cycles -= 2;R[P] = 0x0282;D = READ(R[12]); /* 0281 "ldn rc" */
+    STATIC_FETCH(0xfc);Cycles -= 2;R[P] = 0x0284;ADD(D,0x01,0); /* 0282 "adi .1" */
+    STATIC_FETCH(0x5c);Cycles -= 2;R[P] = 0x0285;WRITE(R[12],D); /* 0284 "str rc" */
+    STATIC_FETCH(0x30);Cycles -= 2;R[P] = 0x0287;_temp = 0x7c;SHORT(_temp); /* 0285 "br .1" */
+    goto _s027c;
+_s0287:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0x4e);Cycles -= 2;R[P] = 0x0288;D = READ(R[14]);R[14]++; /* 0287 "lda re" */
+    if (R[P] != 0x0288) goto staticDispatch;
+    STATIC_FETCH(0xf6);Cycles -= 2;R[P] = 0x0289;DF = D & 1;D = (D >> 1) & 0x7F; /* 0288 "shr" */
+    STATIC_FETCH(0x3b);Cycles -= 2;R[P] = 0x028b;_temp = 0x79; if (!((DF != 0))) SHORT(_temp); /* 0289 "bnf .1" */
+    if (R[P] == 0x0279) goto _s0279;
+    goto _s028b;
+_s028b:
+    if (Cycles - 10 < limit) goto staticLeave;
+    STATIC_FETCH(0x9f);Cycles -= 2;R[P] = 0x028c;D = (R[15] >> 8) & 0xFF; /* 028b "ghi rf" */
+    STATIC_FETCH(0x56);Cycles -= 2;R[P] = 0x028d;WRITE(R[6],D); /* 028c "str r6" */
+    STATIC_FETCH(0x8c);Cycles -= 2;R[P] = 0x028e;D = R[12] & 0xFF; /* 028d "glo rc" */
+    STATIC_FETCH(0x57);Cycles -= 2;R[P] = 0x028f;WRITE(R[7],D); /* 028e "str r7" */
+    STATIC_FETCH(0xd4);Cycles -= 2;R[P] = 0x0290;P = 4; /* 028f "sep r4" */
+    goto staticDispatch;
+_s0290:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0xef);Cycles -= 2;R[P] = 0x0291;X = 15; /* 0290 "sex rf" */
+    STATIC_FETCH(0xd3);Cycles -= 2;R[P] = 0x0292;P = 3; /* 0291 "sep r3" */
+    goto staticDispatch;
+_s0292:
+    if (Cycles - 16 < limit) goto staticLeave;
+    STATIC_FETCH(0x96);Cycles -= 2;R[P] = 0x0293;D = (R[6] >> 8) & 0xFF; /* 0292 "ghi r6" */
+    STATIC_FETCH(0xbf);Cycles -= 2;R[P] = 0x0294;R[15] = (R[15] & 0x00FF) | (((WORD16)D) << 8); /* 0293 "phi rf" */
+    if (R[P] != 0x0294) goto staticDispatch;
+    STATIC_FETCH(0x87);Cycles -= 2;R[P] = 0x0295;D = R[7] & 0xFF; /* 0294 "glo r7" */
+    STATIC_FETCH(0xe3);Cycles -= 2;R[P] = 0x0296;X = 3; /* 0295 "sex r3" */
+    STATIC_FETCH(0xf4);Cycles -= 2;R[P] = 0x0297;ADD(D,READ(R[X]),0); /* 0296 "add" */
+    STATIC_FETCH(0xaf);Cycles -= 2;R[P] = 0x0298;R[15] = (R[15] & 0xFF00) | D; /* 0297 "plo rf" */
+    if (R[P] != 0x0298) goto staticDispatch;
+    STATIC_FETCH(0x13);Cycles -= 2;R[P] = 0x0299;R[3]++; /* 0298 "inc r3" */
+    if (R[P] != 0x0299) goto staticDispatch;
+    STATIC_FETCH(0x30);Cycles -= 2;R[P] = 0x029b;_temp = 0x90;SHORT(_temp); /* 0299 "br .1" */
+    goto _s0290;
+_s029b:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0x06);Cycles -= 2;R[P] = 0x029c;D = READ(R[6]); /* 029b "ldn r6" */
+    STATIC_FETCH(0x57);Cycles -= 2;R[P] = 0x029d;WRITE(R[7],D); /* 029c "str r7" */
+    STATIC_FETCH(0xd4);Cycles -= 2;R[P] = 0x029e;P = 4; /* 029d "sep r4" */
+    goto staticDispatch;
+_s029e:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0x23);Cycles -= 2;R[P] = 0x029f;R[3]--; /* 029e "dec r3" */
+    if (R[P] != 0x029f) goto staticDispatch;
+    STATIC_FETCH(0x36);Cycles -= 2;R[P] = 0x02a1;_temp = 0xe2; if ((READEFLAG(3) != 0)) SHORT(_temp); /* 029f "b3 .1" */
+    if (R[P] == 0x02e2) goto _s02e2;
+    goto _s02a1;
+_s02a1:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0x70);Cycles -= 2;R[P] = 0x02a2;RETURN();IE = 1; /* 02a1 "ret" */
+    goto staticDispatch;
+_s02a2:
+    if (Cycles - 5 < limit) goto staticLeave;
+    STATIC_FETCH(0x9e);Cycles -= 2;R[P] = 0x02a3;D = (R[14] >> 8) & 0xFF; /* 02a2 "ghi re" */
+    STATIC_FETCH(0xc0);Cycles -= 2;R[P] = 0x02a6;Cycles--;{ _temp = 0x45a3; };LONG(_temp); /* 02a3 "lbr .2" */
+    goto staticDispatch;
+_s02a4:
+    if (Cycles - 10 < limit) goto staticLeave;
+    STATIC_FETCH(0x45);Cycles -= 2;R[P] = 0x02a5;D = READ(R[5]);R[5]++; /* 02a4 "lda r5" */
+    if (R[P] != 0x02a5) goto staticDispatch;
+    STATIC_FETCH(0xa3);Cycles -= 2;R[P] = 0x02a6;R[3] = (R[3] & 0xFF00) | D; /* 02a5 "plo r3" */
+    if (R[P] != 0x02a6) goto staticDispatch;
+    STATIC_FETCH(0x0a);Cycles -= 2;R[P] = 0x02a7;D = READ(R[10]); /* 02a6 "ldn ra" */
+    STATIC_FETCH(0x56);Cycles -= 2;R[P] = 0x02a8;WRITE(R[6],D); /* 02a7 "str r6" */
+    STATIC_FETCH(0xd4);Cycles -= 2;R[P] = 0x02a9;P = 4; /* 02a8 "sep r4" */
+    goto staticDispatch;
+_s02a9:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0x06);Cycles -= 2;R[P] = 0x02aa;D = READ(R[6]); /* 02a9 "ldn r6" */
+    STATIC_FETCH(0x5a);Cycles -= 2;R[P] = 0x02ab;WRITE(R[10],D); /* 02aa "str ra" */
+    STATIC_FETCH(0xd4);Cycles -= 2;R[P] = 0x02ac;P = 4; /* 02ab "sep r4" */
+    goto staticDispatch;
+_s02ac:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0x4a);Cycles -= 2;R[P] = 0x02ad;D = READ(R[10]);R[10]++; /* 02ac "lda ra" */
+    if (R[P] != 0x02ad) goto staticDispatch;
+    STATIC_FETCH(0x56);Cycles -= 2;R[P] = 0x02ae;WRITE(R[6],D); /* 02ad "str r6" */
+    STATIC_FETCH(0xd4);Cycles -= 2;R[P] = 0x02af;P = 4; /* 02ae "sep r4" */
+    goto staticDispatch;
+_s02af:
+    if (Cycles - 8 < limit) goto staticLeave;
+    STATIC_FETCH(0x06);Cycles -= 2;R[P] = 0x02b0;D = READ(R[6]); /* 02af "ldn r6" */
+    STATIC_FETCH(0x5a);Cycles -= 2;R[P] = 0x02b1;WRITE(R[10],D); /* 02b0 "str ra" */
+    STATIC_FETCH(0x1a);Cycles -= 2;R[P] = 0x02b2;R[10]++; /* 02b1 "inc ra" */
+    if (R[P] != 0x02b2) goto staticDispatch;
+    STATIC_FETCH(0xd4);Cycles -= 2;R[P] = 0x02b3;P = 4; /* 02b2 "sep r4" */
+    goto staticDispatch;
+_s02b3:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0x06);Cycles -= 2;R[P] = 0x02b4;D = READ(R[6]); /* 02b3 "ldn r6" */
+    STATIC_FETCH(0xaa);Cycles -= 2;R[P] = 0x02b5;R[10] = (R[10] & 0xFF00) | D; /* 02b4 "plo ra" */
+    if (R[P] != 0x02b5) goto staticDispatch;
+    STATIC_FETCH(0xd4);Cycles -= 2;R[P] = 0x02b6;P = 4; /* 02b5 "sep r4" */
+    goto staticDispatch;
+_s02b6:
+    if (Cycles - 16 < limit) goto staticLeave;
+    STATIC_FETCH(0x06);Cycles -= 2;R[P] = 0x02b7;D = READ(R[6]); /* 02b6 "ldn r6" */
+    STATIC_FETCH(0xfa);Cycles -= 2;R[P] = 0x02b9;D = D & 0x0f; /* 02b7 "ani .1" */
+    STATIC_FETCH(0x56);Cycles -= 2;R[P] = 0x02ba;WRITE(R[6],D); /* 02b9 "str r6" */
+    STATIC_FETCH(0xe6);Cycles -= 2;R[P] = 0x02bb;X = 6; /* 02ba "sex r6" */
+    STATIC_FETCH(0x8a);Cycles -= 2;R[P] = 0x02bc;D = R[10] & 0xFF; /* 02bb "glo ra" */
+    STATIC_FETCH(0xf1);Cycles -= 2;R[P] = 0x02bd;D = D | READ(R[X]); /* 02bc "or" */
+    STATIC_FETCH(0xaa);Cycles -= 2;R[P] = 0x02be;R[10] = (R[10] & 0xFF00) | D; /* 02bd "plo ra" */
+    if (R[P] != 0x02be) goto staticDispatch;
+    STATIC_FETCH(0xd4);Cycles -= 2;R[P] = 0x02bf;P = 4; /* 02be "sep r4" */
+    goto staticDispatch;
+_s02bf:
+    if (Cycles - 14 < limit) goto staticLeave;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x02c1;D = 0xcb; /* 02bf "ldi .1" */
+    STATIC_FETCH(0xa7);Cycles -= 2;R[P] = 0x02c2;R[7] = (R[7] & 0xFF00) | D; /* 02c1 "plo r7" */
+    if (R[P] != 0x02c2) goto staticDispatch;
+    STATIC_FETCH(0x86);Cycles -= 2;R[P] = 0x02c3;D = R[6] & 0xFF; /* 02c2 "glo r6" */
+    STATIC_FETCH(0xfa);Cycles -= 2;R[P] = 0x02c5;D = D & 0x0f; /* 02c3 "ani .1" */
+    STATIC_FETCH(0xaf);Cycles -= 2;R[P] = 0x02c6;R[15] = (R[15] & 0xFF00) | D; /* 02c5 "plo rf" */
+    if (R[P] != 0x02c6) goto staticDispatch;
+    STATIC_FETCH(0xfb);Cycles -= 2;R[P] = 0x02c8;D = D ^ 0x0f; /* 02c6 "xri .1" */
+    STATIC_FETCH(0x3a);Cycles -= 2;R[P] = 0x02ca;_temp = 0xcc; if (!((D == 0))) SHORT(_temp); /* 02c8 "bnz .1" */
+    if (R[P] == 0x02cc) goto _s02cc;
+    goto _s02ca;
+_s02ca:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0x07);Cycles -= 2;R[P] = 0x02cb;D = READ(R[7]); /* 02ca "ldn r7" */
+    STATIC_FETCH(0xaf);Cycles -= 2;R[P] = 0x02cc;R[15] = (R[15] & 0xFF00) | D; /* 02cb "plo rf" */
+    if (R[P] != 0x02cc) goto staticDispatch;
+    goto _s02cc;
+_s02cc:
+    if (Cycles - 18 < limit) goto staticLeave;
+    STATIC_FETCH(0xe2);Cycles -= 2;R[P] = 0x02cd;X = 2; /* 02cc "sex r2" */
+    STATIC_FETCH(0x22);Cycles -= 2;R[P] = 0x02ce;R[2]--; /* 02cd "dec r2" */
+    if (R[P] != 0x02ce) goto staticDispatch;
+    STATIC_FETCH(0x8f);Cycles -= 2;R[P] = 0x02cf;D = R[15] & 0xFF; /* 02ce "glo rf" */
+    STATIC_FETCH(0x52);Cycles -= 2;R[P] = 0x02d0;WRITE(R[2],D); /* 02cf "str r2" */
+    STATIC_FETCH(0x62);Cycles -= 2;R[P] = 0x02d1;UPDATEIO(2,READ(R[X]));R[X]++; /* 02d0 "out 2" */
+    if (R[P] != 0x02d1) goto staticDispatch;
+    STATIC_FETCH(0xf8);Cycles -= 2;R[P] = 0x02d3;D = 0xca; /* 02d1 "ldi .1" */
+    STATIC_FETCH(0xa6);Cycles -= 2;R[P] = 0x02d4;R[6] = (R[6] & 0xFF00) | D; /* 02d3 "plo r6" */
+    if (R[P] != 0x02d4) goto staticDispatch;
+    STATIC_FETCH(0x06);Cycles -= 2;R[P] = 0x02d5;D = READ(R[6]); /* 02d4 "ldn r6" */
+    STATIC_FETCH(0x32);Cycles -= 2;R[P] = 0x02d7;_temp = 0xdb; if ((D == 0)) SHORT(_temp); /* 02d5 "bz .1" */
+    if (R[P] == 0x02db) goto _s02db;
+    goto _s02d7;
+_s02d7:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0x36);Cycles -= 2;R[P] = 0x02d9;_temp = 0xdd; if ((READEFLAG(3) != 0)) SHORT(_temp); /* 02d7 "b3 .1" */
+    if (R[P] == 0x02dd) goto _s02dd;
+    goto _s02d9;
+_s02d9:
+    if (Cycles - 4 < limit) goto staticLeave;
+    STATIC_FETCH(0x15);Cycles -= 2;R[P] = 0x02da;R[5]++; /* 02d9 "inc r5" */
+    if (R[P] != 0x02da) goto staticDispatch;
+    STATIC_FETCH(0xd4);Cycles -= 2;R[P] = 0x02db;P = 4; /* 02da "sep r4" */
+    goto staticDispatch;
+_s02db:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0x3f);Cycles -= 2;R[P] = 0x02dd;_temp = 0xd9; if (!((READEFLAG(4) != 0))) SHORT(_temp); /* 02db "bn4 .1" */
+    if (R[P] == 0x02d9) goto _s02d9;
+    goto _s02dd;
+_s02dd:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0x8f);Cycles -= 2;R[P] = 0x02de;D = R[15] & 0xFF; /* 02dd "glo rf" */
+    STATIC_FETCH(0x57);Cycles -= 2;R[P] = 0x02df;WRITE(R[7],D); /* 02de "str r7" */
+    STATIC_FETCH(0x30);Cycles -= 2;R[P] = 0x02e1;_temp = 0xe2;SHORT(_temp); /* 02df "br .1" */
+    goto _s02e2;
+_s02e1:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0x56);Cycles -= 2;R[P] = 0x02e2;WRITE(R[6],D); /* 02e1 "str r6" */
+    goto _s02e2;
+_s02e2:
+    if (Cycles - 6 < limit) goto staticLeave;
+    STATIC_FETCH(0x05);Cycles -= 2;R[P] = 0x02e3;D = READ(R[5]); /* 02e2 "ldn r5" */
+    STATIC_FETCH(0xa5);Cycles -= 2;R[P] = 0x02e4;R[5] = (R[5] & 0xFF00) | D; /* 02e3 "plo r5" */
+    if (R[P] != 0x02e4) goto staticDispatch;
+    STATIC_FETCH(0xd4);Cycles -= 2;R[P] = 0x02e5;P = 4; /* 02e4 "sep r4" */
+    goto staticDispatch;
+_s02e5:
+    if (Cycles - 24 < limit) goto staticLeave;
+    STATIC_FETCH(0x45);Cycles -= 2;R[P] = 0x02e6;D = READ(R[5]);R[5]++; /* 02e5 "lda r5" */
+    if (R[P] != 0x02e6) goto staticDispatch;
+    STATIC_FETCH(0x5a);Cycles -= 2;R[P] = 0x02e7;WRITE(R[10],D); /* 02e6 "str ra" */
+    STATIC_FETCH(0x22);Cycles -= 2;R[P] = 0x02e8;R[2]--; /* 02e7 "dec r2" */
+    if (R[P] != 0x02e8) goto staticDispatch;
+    STATIC_FETCH(0xe2);Cycles -= 2;R[P] = 0x02e9;X = 2; /* 02e8 "sex r2" */
+    STATIC_FETCH(0x86);Cycles -= 2;R[P] = 0x02ea;D = R[6] & 0xFF; /* 02e9 "glo r6" */
+    STATIC_FETCH(0xfa);Cycles -= 2;R[P] = 0x02ec;D = D & 0x0f; /* 02ea "ani .1" */
+    STATIC_FETCH(0x52);Cycles -= 2;R[P] = 0x02ed;WRITE(R[2],D); /* 02ec "str r2" */
+    STATIC_FETCH(0x8a);Cycles -= 2;R[P] = 0x02ee;D = R[10] & 0xFF; /* 02ed "glo ra" */
+    STATIC_FETCH(0xf4);Cycles -= 2;R[P] = 0x02ef;ADD(D,READ(R[X]),0); /* 02ee "add" */
+    STATIC_FETCH(0xaa);Cycles -= 2;R[P] = 0x02f0;R[10] = (R[10] & 0xFF00) | D; /* 02ef "plo ra" */
+    if (R[P] != 0x02f0) goto staticDispatch;
+    STATIC_FETCH(0x12);Cycles -= 2;R[P] = 0x02f1;R[2]++; /* 02f0 "inc r2" */
+    if (R[P] != 0x02f1) goto staticDispatch;
+    STATIC_FETCH(0xd4);Cycles -= 2;R[P] = 0x02f2;P = 4; /* 02f1 "sep r4" */
+    goto staticDispatch;
+_s02f2:
+    if (Cycles - 10 < limit) goto staticLeave;
+    STATIC_FETCH(0x91);Cycles -= 2;R[P] = 0x02f3;D = (R[1] >> 8) & 0xFF; /* 02f2 "ghi r1" */
+    STATIC_FETCH(0x5a);Cycles -= 2;R[P] = 0x02f4;WRITE(R[10],D); /* 02f3 "str ra" */
+    STATIC_FETCH(0x8a);Cycles -= 2;R[P] = 0x02f5;D = R[10] & 0xFF; /* 02f4 "glo ra" */
+    STATIC_FETCH(0x2a);Cycles -= 2;R[P] = 0x02f6;R[10]--; /* 02f5 "dec ra" */
+    if (R[P] != 0x02f6) goto staticDispatch;
+    STATIC_FETCH(0x3a);Cycles -= 2;R[P] = 0x02f8;_temp = 0xf2; if (!((D == 0))) SHORT(_temp); /* 02f6 "bnz .1" */
+    if (R[P] == 0x02f2) goto _s02f2;
+    goto _s02f8;
+_s02f8:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0xd4);Cycles -= 2;R[P] = 0x02f9;P = 4; /* 02f8 "sep r4" */
+    goto staticDispatch;
+_s02f9:
+    if (Cycles - 8 < limit) goto staticLeave;
+    STATIC_FETCH(0x6d);Cycles -= 2;R[P] = 0x02fa;D = INPUTIO(5);WRITE(R[X],D); /* 02f9 "inp 5" */
+    STATIC_FETCH(0x02);Cycles -= 2;R[P] = 0x02fb;D = READ(R[2]); /* 02fa "ldn r2" */
+    STATIC_FETCH(0x6e);Cycles -= 2;R[P] = 0x02fc;D = INPUTIO(6);WRITE(R[X],D); /* 02fb "inp 6" */
+    STATIC_FETCH(0x0a);Cycles -= 2;R[P] = 0x02fd;D = READ(R[10]); /* 02fc "ldn ra" */
+    goto _s02fd;
+_s02fd:
+    if (Cycles - 2 < limit) goto staticLeave;
+    STATIC_FETCH(0x3e);Cycles -= 2;R[P] = 0x02ff;_temp = 0xfd; if (!((READEFLAG(3) != 0))) SHORT(_temp); /* 02fd "bn3 .1" */
+    if (R[P] == 0x02fd) goto _s02fd;
+    goto _s02ff;
+_s02ff:
+    if (Cycles - 3 < limit) goto staticLeave;
+    STATIC_FETCH(0xc0);Cycles -= 2;R[P] = 0x0302;Cycles--;{ _temp = 0x6d04; };LONG(_temp); /* 02ff "lbr .2" */
+    goto staticDispatch;
+#endif
+
@@ -0,0 +1,770 @@
+/* GENERATED */
+
+_op00: /* "idl" */
+    R[P]--;IDLE(2);
+    DISPATCH();
+_op01: /* "ldn r1" */
+    D = READ(R[1]);
+    DISPATCH();
+_op02: /* "ldn r2" */
+    D = READ(R[2]);
+    DISPATCH();
+_op03: /* "ldn r3" */
+    D = READ(R[3]);
+    DISPATCH();
+_op04: /* "ldn r4" */
+    D = READ(R[4]);
+    DISPATCH();
+_op05: /* "ldn r5" */
+    D = READ(R[5]);
+    DISPATCH();
+_op06: /* "ldn r6" */
+    D = READ(R[6]);
+    DISPATCH();
+_op07: /* "ldn r7" */
+    D = READ(R[7]);
+    DISPATCH();
+_op08: /* "ldn r8" */
+    D = READ(R[8]);
+    DISPATCH();
+_op09: /* "ldn r9" */
+    D = READ(R[9]);
+    DISPATCH();
+_op0a: /* "ldn ra" */
+    D = READ(R[10]);
+    DISPATCH();
+_op0b: /* "ldn rb" */
+    D = READ(R[11]);
+    DISPATCH();
+_op0c: /* "ldn rc" */
+    D = READ(R[12]);
+    DISPATCH();
+_op0d: /* "ldn rd" */
+    D = READ(R[13]);
+    DISPATCH();
+_op0e: /* "ldn re" */
+    D = READ(R[14]);
+    DISPATCH();
+_op0f: /* "ldn rf" */
+    D = READ(R[15]);
+    DISPATCH();
+_op10: /* "inc r0" */
+    R[0]++;
+    DISPATCH();
+_op11: /* "inc r1" */
+    R[1]++;
+    DISPATCH();
+_op12: /* "inc r2" */
+    R[2]++;
+    DISPATCH();
+_op13: /* "inc r3" */
+    R[3]++;
+    DISPATCH();
+_op14: /* "inc r4" */
+    R[4]++;
+    DISPATCH();
+_op15: /* "inc r5" */
+    R[5]++;
+    DISPATCH();
+_op16: /* "inc r6" */
+    R[6]++;
+    DISPATCH();
+_op17: /* "inc r7" */
+    R[7]++;
+    DISPATCH();
+_op18: /* "inc r8" */
+    R[8]++;
+    DISPATCH();
+_op19: /* "inc r9" */
+    R[9]++;
+    DISPATCH();
+_op1a: /* "inc ra" */
+    R[10]++;
+    DISPATCH();
+_op1b: /* "inc rb" */
+    R[11]++;
+    DISPATCH();
+_op1c: /* "inc rc" */
+    R[12]++;
+    DISPATCH();
+_op1d: /* "inc rd" */
+    R[13]++;
+    DISPATCH();
+_op1e: /* "inc re" */
+    R[14]++;
+    DISPATCH();
+_op1f: /* "inc rf" */
+    R[15]++;
+    DISPATCH();
+_op20: /* "dec r0" */
+    R[0]--;
+    DISPATCH();
+_op21: /* "dec r1" */
+    R[1]--;
+    DISPATCH();
+_op22: /* "dec r2" */
+    R[2]--;
+    DISPATCH();
+_op23: /* "dec r3" */
+    R[3]--;
+    DISPATCH();
+_op24: /* "dec r4" */
+    R[4]--;
+    DISPATCH();
+_op25: /* "dec r5" */
+    R[5]--;
+    DISPATCH();
+_op26: /* "dec r6" */
+    R[6]--;
+    DISPATCH();
+_op27: /* "dec r7" */
+    R[7]--;
+    DISPATCH();
+_op28: /* "dec r8" */
+    R[8]--;
+    DISPATCH();
+_op29: /* "dec r9" */
+    R[9]--;
+    DISPATCH();
+_op2a: /* "dec ra" */
+    R[10]--;
+    DISPATCH();
+_op2b: /* "dec rb" */
+    R[11]--;
+    DISPATCH();
+_op2c: /* "dec rc" */
+    R[12]--;
+    DISPATCH();
+_op2d: /* "dec rd" */
+    R[13]--;
+    DISPATCH();
+_op2e: /* "dec re" */
+    R[14]--;
+    DISPATCH();
+_op2f: /* "dec rf" */
+    R[15]--;
+    DISPATCH();
+_op30: /* "br .1" */
+    _temp = FETCH2();SHORT(_temp);
+    DISPATCH();
+_op31: /* "bq .1" */
+    _temp = FETCH2(); if ((Q != 0)) SHORT(_temp);
+    DISPATCH();
+_op32: /* "bz .1" */
+    _temp = FETCH2(); if ((D == 0)) SHORT(_temp);
+    DISPATCH();
+_op33: /* "bdf .1" */
+    _temp = FETCH2(); if ((DF != 0)) SHORT(_temp);
+    DISPATCH();
+_op34: /* "b1 .1" */
+    _temp = FETCH2(); if ((READEFLAG(1) != 0)) SHORT(_temp);
+    DISPATCH();
+_op35: /* "b2 .1" */
+    _temp = FETCH2(); if ((READEFLAG(2) != 0)) SHORT(_temp);
+    DISPATCH();
+_op36: /* "b3 .1" */
+    _temp = FETCH2(); if ((READEFLAG(3) != 0)) SHORT(_temp);
+    DISPATCH();
+_op37: /* "b4 .1" */
+    _temp = FETCH2(); if ((READEFLAG(4) != 0)) SHORT(_temp);
+    DISPATCH();
+_op38: /* "skp" */
+    _temp = FETCH2();
+    DISPATCH();
+_op39: /* "bnq .1" */
+    _temp = FETCH2(); if (!((Q != 0))) SHORT(_temp);
+    DISPATCH();
+_op3a: /* "bnz .1" */
+    _temp = FETCH2(); if (!((D == 0))) SHORT(_temp);
+    DISPATCH();
+_op3b: /* "bnf .1" */
+    _temp = FETCH2(); if (!((DF != 0))) SHORT(_temp);
+    DISPATCH();
+_op3c: /* "bn1 .1" */
+    _temp = FETCH2(); if (!((READEFLAG(1) != 0))) SHORT(_temp);
+    DISPATCH();
+_op3d: /* "bn2 .1" */
+    _temp = FETCH2(); if (!((READEFLAG(2) != 0))) SHORT(_temp);
+    DISPATCH();
+_op3e: /* "bn3 .1" */
+    _temp = FETCH2(); if (!((READEFLAG(3) != 0))) SHORT(_temp);
+    DISPATCH();
+_op3f: /* "bn4 .1" */
+    _temp = FETCH2(); if (!((READEFLAG(4) != 0))) SHORT(_temp);
+    DISPATCH();
+_op40: /* "lda r0" */
+    D = READ(R[0]);R[0]++;
+    DISPATCH();
+_op41: /* "lda r1" */
+    D = READ(R[1]);R[1]++;
+    DISPATCH();
+_op42: /* "lda r2" */
+    D = READ(R[2]);R[2]++;
+    DISPATCH();
+_op43: /* "lda r3" */
+    D = READ(R[3]);R[3]++;
+    DISPATCH();
+_op44: /* "lda r4" */
+    D = READ(R[4]);R[4]++;
+    DISPATCH();
+_op45: /* "lda r5" */
+    D = READ(R[5]);R[5]++;
+    DISPATCH();
+_op46: /* "lda r6" */
+    D = READ(R[6]);R[6]++;
+    DISPATCH();
+_op47: /* "lda r7" */
+    D = READ(R[7]);R[7]++;
+    DISPATCH();
+_op48: /* "lda r8" */
+    D = READ(R[8]);R[8]++;
+    DISPATCH();
+_op49: /* "lda r9" */
+    D = READ(R[9]);R[9]++;
+    DISPATCH();
+_op4a: /* "lda ra" */
+    D = READ(R[10]);R[10]++;
+    DISPATCH();
+_op4b: /* "lda rb" */
+    D = READ(R[11]);R[11]++;
+    DISPATCH();
+_op4c: /* "lda rc" */
+    D = READ(R[12]);R[12]++;
+    DISPATCH();
+_op4d: /* "lda rd" */
+    D = READ(R[13]);R[13]++;
+    DISPATCH();
+_op4e: /* "lda re" */
+    D = READ(R[14]);R[14]++;
+    DISPATCH();
+_op4f: /* "lda rf" */
+    D = READ(R[15]);R[15]++;
+    DISPATCH();
+_op50: /* "str r0" */
+    WRITE(R[0],D);
+    DISPATCH();
+_op51: /* "str r1" */
+    WRITE(R[1],D);
+    DISPATCH();
+_op52: /* "str r2" */
+    WRITE(R[2],D);
+    DISPATCH();
+_op53: /* "str r3" */
+    WRITE(R[3],D);
+    DISPATCH();
+_op54: /* "str r4" */
+    WRITE(R[4],D);
+    DISPATCH();
+_op55: /* "str r5" */
+    WRITE(R[5],D);
+    DISPATCH();
+_op56: /* "str r6" */
+    WRITE(R[6],D);
+    DISPATCH();
+_op57: /* "str r7" */
+    WRITE(R[7],D);
+    DISPATCH();
+_op58: /* "str r8" */
+    WRITE(R[8],D);
+    DISPATCH();
+_op59: /* "str r9" */
+    WRITE(R[9],D);
+    DISPATCH();
+_op5a: /* "str ra" */
+    WRITE(R[10],D);
+    DISPATCH();
+_op5b: /* "str rb" */
+    WRITE(R[11],D);
+    DISPATCH();
+_op5c: /* "str rc" */
+    WRITE(R[12],D);
+    DISPATCH();
+_op5d: /* "str rd" */
+    WRITE(R[13],D);
+    DISPATCH();
+_op5e: /* "str re" */
+    WRITE(R[14],D);
+    DISPATCH();
+_op5f: /* "str rf" */
+    WRITE(R[15],D);
+    DISPATCH();
+_op60: /* "irx" */
+    R[X]++;
+    DISPATCH();
+_op61: /* "out 1" */
+    UPDATEIO(1,READ(R[X]));R[X]++;
+    DISPATCH();
+_op62: /* "out 2" */
+    UPDATEIO(2,READ(R[X]));R[X]++;
+    DISPATCH();
+_op63: /* "out 3" */
+    UPDATEIO(3,READ(R[X]));R[X]++;
+    DISPATCH();
+_op64: /* "out 4" */
+    UPDATEIO(4,READ(R[X]));R[X]++;
+    DISPATCH();
+_op65: /* "out 5" */
+    UPDATEIO(5,READ(R[X]));R[X]++;
+    DISPATCH();
+_op66: /* "out 6" */
+    UPDATEIO(6,READ(R[X]));R[X]++;
+    DISPATCH();
+_op67: /* "out 7" */
+    UPDATEIO(7,READ(R[X]));R[X]++;
+    DISPATCH();
+_op68: /* "nop68" */
+    Cycles--;
+    DISPATCH();
+_op69: /* "inp 1" */
+    D = INPUTIO(1);WRITE(R[X],D);
+    DISPATCH();
+_op6a: /* "inp 2" */
+    D = INPUTIO(2);WRITE(R[X],D);
+    DISPATCH();
+_op6b: /* "inp 3" */
+    D = INPUTIO(3);WRITE(R[X],D);
+    DISPATCH();
+_op6c: /* "inp 4" */
+    D = INPUTIO(4);WRITE(R[X],D);
+    DISPATCH();
+_op6d: /* "inp 5" */
+    D = INPUTIO(5);WRITE(R[X],D);
+    DISPATCH();
+_op6e: /* "inp 6" */
+    D = INPUTIO(6);WRITE(R[X],D);
+    DISPATCH();
+_op6f: /* "inp 7" */
+    D = INPUTIO(7);WRITE(R[X],D);
+    DISPATCH();
+_op70: /* "ret" */
+    RETURN();IE = 1;
+    DISPATCH();
+_op71: /* "dis" */
+    RETURN();IE = 0;
+    DISPATCH();
+_op72: /* "ldxa" */
+    D = READ(R[X]);R[X]++;
+    DISPATCH();
+_op73: /* "stxd" */
+    WRITE(R[X],D);R[X]--;
+    DISPATCH();
+_op74: /* "adc" */
+    ADD(D,READ(R[X]),DF);
+    DISPATCH();
+_op75: /* "sdb" */
+    SUB(READ(R[X]),D,DF);
+    DISPATCH();
+_op76: /* "rshr" */
+    _temp = D & 1;D = ((D >> 1) & 0x7F) | (DF << 7);DF = _temp;
+    DISPATCH();
+_op77: /* "smb" */
+    SUB(D,READ(R[X]),DF);
+    DISPATCH();
+_op78: /* "sav" */
+    WRITE(R[X],T);
+    DISPATCH();
+_op79: /* "mark" */
+    T = (X << 4) | P;WRITE(R[2],T);X = P;R[2]--;
+    DISPATCH();
+_op7a: /* "req" */
+    Q = 0;UPDATEIO(0,0);
+    DISPATCH();
+_op7b: /* "seq" */
+    Q = 1;UPDATEIO(0,1);
+    DISPATCH();
+_op7c: /* "adci .1" */
+    ADD(D,FETCH2(),DF);
+    DISPATCH();
+_op7d: /* "sdbi .1" */
+    SUB(FETCH2(),D,DF);
+    DISPATCH();
+_op7e: /* "rshl" */
+    _temp = D;D = (D << 1) | DF;DF = (_temp >> 7) & 1;
+    DISPATCH();
+_op7f: /* "smbi .1" */
+    SUB(D,FETCH2(),DF);
+    DISPATCH();
+_op80: /* "glo r0" */
+    D = R[0] & 0xFF;
+    DISPATCH();
+_op81: /* "glo r1" */
+    D = R[1] & 0xFF;
+    DISPATCH();
+_op82: /* "glo r2" */
+    D = R[2] & 0xFF;
+    DISPATCH();
+_op83: /* "glo r3" */
+    D = R[3] & 0xFF;
+    DISPATCH();
+_op84: /* "glo r4" */
+    D = R[4] & 0xFF;
+    DISPATCH();
+_op85: /* "glo r5" */
+    D = R[5] & 0xFF;
+    DISPATCH();
+_op86: /* "glo r6" */
+    D = R[6] & 0xFF;
+    DISPATCH();
+_op87: /* "glo r7" */
+    D = R[7] & 0xFF;
+    DISPATCH();
+_op88: /* "glo r8" */
+    D = R[8] & 0xFF;
+    DISPATCH();
+_op89: /* "glo r9" */
+    D = R[9] & 0xFF;
+    DISPATCH();
+_op8a: /* "glo ra" */
+    D = R[10] & 0xFF;
+    DISPATCH();
+_op8b: /* "glo rb" */
+    D = R[11] & 0xFF;
+    DISPATCH();
+_op8c: /* "glo rc" */
+    D = R[12] & 0xFF;
+    DISPATCH();
+_op8d: /* "glo rd" */
+    D = R[13] & 0xFF;
+    DISPATCH();
+_op8e: /* "glo re" */
+    D = R[14] & 0xFF;
+    DISPATCH();
+_op8f: /* "glo rf" */
+    D = R[15] & 0xFF;
+    DISPATCH();
+_op90: /* "ghi r0" */
+    D = (R[0] >> 8) & 0xFF;
+    DISPATCH();
+_op91: /* "ghi r1" */
+    D = (R[1] >> 8) & 0xFF;
+    DISPATCH();
+_op92: /* "ghi r2" */
+    D = (R[2] >> 8) & 0xFF;
+    DISPATCH();
+_op93: /* "ghi r3" */
+    D = (R[3] >> 8) & 0xFF;
+    DISPATCH();
+_op94: /* "ghi r4" */
+    D = (R[4] >> 8) & 0xFF;
+    DISPATCH();
+_op95: /* "ghi r5" */
+    D = (R[5] >> 8) & 0xFF;
+    DISPATCH();
+_op96: /* "ghi r6" */
+    D = (R[6] >> 8) & 0xFF;
+    DISPATCH();
+_op97: /* "ghi r7" */
+    D = (R[7] >> 8) & 0xFF;
+    DISPATCH();
+_op98: /* "ghi r8" */
+    D = (R[8] >> 8) & 0xFF;
+    DISPATCH();
+_op99: /* "ghi r9" */
+    D = (R[9] >> 8) & 0xFF;
+    DISPATCH();
+_op9a: /* "ghi ra" */
+    D = (R[10] >> 8) & 0xFF;
+    DISPATCH();
+_op9b: /* "ghi rb" */
+    D = (R[11] >> 8) & 0xFF;
+    DISPATCH();
+_op9c: /* "ghi rc" */
+    D = (R[12] >> 8) & 0xFF;
+    DISPATCH();
+_op9d: /* "ghi rd" */
+    D = (R[13] >> 8) & 0xFF;
+    DISPATCH();
+_op9e: /* "ghi re" */
+    D = (R[14] >> 8) & 0xFF;
+    DISPATCH();
+_op9f: /* "ghi rf" */
+    D = (R[15] >> 8) & 0xFF;
+    DISPATCH();
+_opa0: /* "plo r0" */
+    R[0] = (R[0] & 0xFF00) | D;
+    DISPATCH();
+_opa1: /* "plo r1" */
+    R[1] = (R[1] & 0xFF00) | D;
+    DISPATCH();
+_opa2: /* "plo r2" */
+    R[2] = (R[2] & 0xFF00) | D;
+    DISPATCH();
+_opa3: /* "plo r3" */
+    R[3] = (R[3] & 0xFF00) | D;
+    DISPATCH();
+_opa4: /* "plo r4" */
+    R[4] = (R[4] & 0xFF00) | D;
+    DISPATCH();
+_opa5: /* "plo r5" */
+    R[5] = (R[5] & 0xFF00) | D;
+    DISPATCH();
+_opa6: /* "plo r6" */
+    R[6] = (R[6] & 0xFF00) | D;
+    DISPATCH();
+_opa7: /* "plo r7" */
+    R[7] = (R[7] & 0xFF00) | D;
+    DISPATCH();
+_opa8: /* "plo r8" */
+    R[8] = (R[8] & 0xFF00) | D;
+    DISPATCH();
+_opa9: /* "plo r9" */
+    R[9] = (R[9] & 0xFF00) | D;
+    DISPATCH();
+_opaa: /* "plo ra" */
+    R[10] = (R[10] & 0xFF00) | D;
+    DISPATCH();
+_opab: /* "plo rb" */
+    R[11] = (R[11] & 0xFF00) | D;
+    DISPATCH();
+_opac: /* "plo rc" */
+    R[12] = (R[12] & 0xFF00) | D;
+    DISPATCH();
+_opad: /* "plo rd" */
+    R[13] = (R[13] & 0xFF00) | D;
+    DISPATCH();
+_opae: /* "plo re" */
+    R[14] = (R[14] & 0xFF00) | D;
+    DISPATCH();
+_opaf: /* "plo rf" */
+    R[15] = (R[15] & 0xFF00) | D;
+    DISPATCH();
+_opb0: /* "phi r0" */
+    R[0] = (R[0] & 0x00FF) | (((WORD16)D) << 8);
+    DISPATCH();
+_opb1: /* "phi r1" */
+    R[1] = (R[1] & 0x00FF) | (((WORD16)D) << 8);
+    DISPATCH();
+_opb2: /* "phi r2" */
+    R[2] = (R[2] & 0x00FF) | (((WORD16)D) << 8);
+    DISPATCH();
+_opb3: /* "phi r3" */
+    R[3] = (R[3] & 0x00FF) | (((WORD16)D) << 8);
+    DISPATCH();
+_opb4: /* "phi r4" */
+    R[4] = (R[4] & 0x00FF) | (((WORD16)D) << 8);
+    DISPATCH();
+_opb5: /* "phi r5" */
+    R[5] = (R[5] & 0x00FF) | (((WORD16)D) << 8);
+    DISPATCH();
+_opb6: /* "phi r6" */
+    R[6] = (R[6] & 0x00FF) | (((WORD16)D) << 8);
+    DISPATCH();
+_opb7: /* "phi r7" */
+    R[7] = (R[7] & 0x00FF) | (((WORD16)D) << 8);
+    DISPATCH();
+_opb8: /* "phi r8" */
+    R[8] = (R[8] & 0x00FF) | (((WORD16)D) << 8);
+    DISPATCH();
+_opb9: /* "phi r9" */
+    R[9] = (R[9] & 0x00FF) | (((WORD16)D) << 8);
+    DISPATCH();
+_opba: /* "phi ra" */
+    R[10] = (R[10] & 0x00FF) | (((WORD16)D) << 8);
+    DISPATCH();
+_opbb: /* "phi rb" */
+    R[11] = (R[11] & 0x00FF) | (((WORD16)D) << 8);
+    DISPATCH();
+_opbc: /* "phi rc" */
+    R[12] = (R[12] & 0x00FF) | (((WORD16)D) << 8);
+    DISPATCH();
+_opbd: /* "phi rd" */
+    R[13] = (R[13] & 0x00FF) | (((WORD16)D) << 8);
+    DISPATCH();
+_opbe: /* "phi re" */
+    R[14] = (R[14] & 0x00FF) | (((WORD16)D) << 8);
+    DISPATCH();
+_opbf: /* "phi rf" */
+    R[15] = (R[15] & 0x00FF) | (((WORD16)D) << 8);
+    DISPATCH();
+_opc0: /* "lbr .2" */
+    Cycles--;FETCH3();LONG(_temp);
+    DISPATCH();
+_opc1: /* "lbq .2" */
+    Cycles--;FETCH3();if ((Q != 0)) LONG(_temp);
+    DISPATCH();
+_opc2: /* "lbz .2" */
+    Cycles--;FETCH3();if ((D == 0)) LONG(_temp);
+    DISPATCH();
+_opc3: /* "lbdf .2" */
+    Cycles--;FETCH3();if ((DF != 0)) LONG(_temp);
+    DISPATCH();
+_opc4: /* "nop" */
+    Cycles--;
+    DISPATCH();
+_opc5: /* "lsnq" */
+    Cycles--;if (!(Q != 0)) LONGSKIP();
+    DISPATCH();
+_opc6: /* "lsnz" */
+    Cycles--;if (!(D == 0)) LONGSKIP();
+    DISPATCH();
+_opc7: /* "lsnf" */
+    Cycles--;if (!(DF != 0)) LONGSKIP();
+    DISPATCH();
+_opc8: /* "lskp" */
+    Cycles--;FETCH3();
+    DISPATCH();
+_opc9: /* "lbnq .2" */
+    Cycles--;FETCH3();if (!((Q != 0))) LONG(_temp);
+    DISPATCH();
+_opca: /* "lbnz .2" */
+    Cycles--;FETCH3();if (!((D == 0))) LONG(_temp);
+    DISPATCH();
+_opcb: /* "lbnf .2" */
+    Cycles--;FETCH3();if (!((DF != 0))) LONG(_temp);
+    DISPATCH();
+_opcc: /* "lsie" */
+    Cycles--;if (IE != 0) LONGSKIP();
+    DISPATCH();
+_opcd: /* "lsq" */
+    Cycles--;if (((Q != 0))) LONGSKIP();
+    DISPATCH();
+_opce: /* "lsz" */
+    Cycles--;if (((D == 0))) LONGSKIP();
+    DISPATCH();
+_opcf: /* "lsdf" */
+    Cycles--;if (((DF != 0))) LONGSKIP();
+    DISPATCH();
+_opd0: /* "sep r0" */
+    P = 0;
+    DISPATCH();
+_opd1: /* "sep r1" */
+    P = 1;
+    DISPATCH();
+_opd2: /* "sep r2" */
+    P = 2;
+    DISPATCH();
+_opd3: /* "sep r3" */
+    P = 3;
+    DISPATCH();
+_opd4: /* "sep r4" */
+    P = 4;
+    DISPATCH();
+_opd5: /* "sep r5" */
+    P = 5;
+    DISPATCH();
+_opd6: /* "sep r6" */
+    P = 6;
+    DISPATCH();
+_opd7: /* "sep r7" */
+    P = 7;
+    DISPATCH();
+_opd8: /* "sep r8" */
+    P = 8;
+    DISPATCH();
+_opd9: /* "sep r9" */
+    P = 9;
+    DISPATCH();
+_opda: /* "sep ra" */
+    P = 10;
+    DISPATCH();
+_opdb: /* "sep rb" */
+    P = 11;
+    DISPATCH();
+_opdc: /* "sep rc" */
+    P = 12;
+    DISPATCH();
+_opdd: /* "sep rd" */
+    P = 13;
+    DISPATCH();
+_opde: /* "sep re" */
+    P = 14;
+    DISPATCH();
+_opdf: /* "sep rf" */
+    P = 15;
+    DISPATCH();
+_ope0: /* "sex r0" */
+    X = 0;
+    DISPATCH();
+_ope1: /* "sex r1" */
+    X = 1;
+    DISPATCH();
+_ope2: /* "sex r2" */
+    X = 2;
+    DISPATCH();
+_ope3: /* "sex r3" */
+    X = 3;
+    DISPATCH();
+_ope4: /* "sex r4" */
+    X = 4;
+    DISPATCH();
+_ope5: /* "sex r5" */
+    X = 5;
+    DISPATCH();
+_ope6: /* "sex r6" */
+    X = 6;
+    DISPATCH();
+_ope7: /* "sex r7" */
+    X = 7;
+    DISPATCH();
+_ope8: /* "sex r8" */
+    X = 8;
+    DISPATCH();
+_ope9: /* "sex r9" */
+    X = 9;
+    DISPATCH();
+_opea: /* "sex ra" */
+    X = 10;
+    DISPATCH();
+_opeb: /* "sex rb" */
+    X = 11;
+    DISPATCH();
+_opec: /* "sex rc" */
+    X = 12;
+    DISPATCH();
+_oped: /* "sex rd" */
+    X = 13;
+    DISPATCH();
+_opee: /* "sex re" */
+    X = 14;
+    DISPATCH();
+_opef: /* "sex rf" */
+    X = 15;
+    DISPATCH();
+_opf0: /* "ldx" */
+    D = READ(R[X]);
+    DISPATCH();
+_opf1: /* "or" */
+    D = D | READ(R[X]);
+    DISPATCH();
+_opf2: /* "and" */
+    D = D & READ(R[X]);
+    DISPATCH();
+_opf3: /* "xor" */
+    D = D ^ READ(R[X]);
+    DISPATCH();
+_opf4: /* "add" */
+    ADD(D,READ(R[X]),0);
+    DISPATCH();
+_opf5: /* "sd" */
+    SUB(READ(R[X]),D,1);
+    DISPATCH();
+_opf6: /* "shr" */
+    DF = D & 1;D = (D >> 1) & 0x7F;
+    DISPATCH();
+_opf7: /* "sm" */
+    SUB(D,READ(R[X]),1);
+    DISPATCH();
+_opf8: /* "ldi .1" */
+    D = FETCH2();
+    DISPATCH();
+_opf9: /* "ori .1" */
+    D = D | FETCH2();
+    DISPATCH();
+_opfa: /* "ani .1" */
+    D = D & FETCH2();
+    DISPATCH();
+_opfb: /* "xri .1" */
+    D = D ^ FETCH2();
+    DISPATCH();
+_opfc: /* "adi .1" */
+    ADD(D,FETCH2(),0);
+    DISPATCH();
+_opfd: /* "sdi .1" */
+    SUB(FETCH2(),D,1);
+    DISPATCH();
+_opfe: /* "shl" */
+    DF = (D >> 7); D = D << 1;
+    DISPATCH();
+_opff: /* "smi .1" */
+    SUB(D,FETCH2(),1);
+    DISPATCH();
@@ -0,0 +1,484 @@
+//*******************************************************************************************************
+//*******************************************************************************************************
+//
+//      Name:       CpuChip8.H
+//      Purpose:    High level emulation of the VIP CHIP-8 interpreter (included by cpumachine.h)
+//      Date:       17th October 2026
+//
+//*******************************************************************************************************
+//*******************************************************************************************************
+
+// The VIP CHIP-8 interpreter (chip8.rom, at $0000) fetches each instruction in a loop at $001B with
+// P = 4, looks up its handler in the tables at $0050/$0060 and runs it with P = 3, the handler going
+// back with SEP R4 to $0042, a BR to $001B. CHIP-8 PC is R5, I is RA, the stack is R2 and V0-VF are the
+// top 16 bytes of the page in R6.1, the timers are R8.1 and R8.0, updated by the interrupt routine.
+//
+// When it is turned on, the interpreter in RAM matches (by checksum) and the run loop reaches $001B,
+// each instruction is run here instead. It leaves every register and every byte of memory just as
+// the interpreter would, and takes the same number of cycles, so the interpreter can carry on from
+// any instruction. An instruction is only run here if all of it fits in the cycles left, so the
+// interrupt never comes in the middle of one. Anything not known here (0NNN machine code, FX0A, the
+// undocumented 8XYN, or a write that would change the interpreter or its workspace under it) and
+// 00E0, which takes longer than a frame, is left to the interpreter.
+//
+// DXYN works out the shifted sprite, then waits at IDL ($00AC) for the interrupt before drawing it.
+// The part before is run here, the interpreter idles, and the drawing is done here when the interrupt
+// routine returns to $00AD.
+
+#define CHIP8_FETCH         (0x001B)                                                // Fetch loop (P = 4)
+#define CHIP8_DRAW          (0x00AD)                                                // DXYN after the interrupt (P = 3)
+#define CHIP8_TABLE         (0x0050)                                                // Handler high bytes, low bytes at +$10
+#define CHIP8_SIZE          (0x0200)                                                // Bytes of interpreter
+#define CHIP8_CHECKSUM      (0x7E347140L)                                           // of chip8.rom (see CPU_Chip8Verify())
+
+#define CHIP8_AT(p,pc)      (((p) == 4 && (pc) == CHIP8_FETCH) || ((p) == 3 && (pc) == CHIP8_DRAW))
+
+#define CHIP8_FITS(n)       (Cycles - (n) * 2 >= limit)                             // n instructions fit in the cycles left
+#define CHIP8_PLO(r,d)      R[r] = (R[r] & 0xFF00) | (BYTE8)(d)                     // PLO / PHI
+#define CHIP8_PHI(r,d)      R[r] = (R[r] & 0x00FF) | ((WORD16)(BYTE8)(d) << 8)
+#define CHIP8_OVERLAPS(a,n,b)   ((WORD16)((b) - (a)) < (n))                         // b in the n bytes from a
+
+//*******************************************************************************************************
+//      Check the interpreter is in RAM. If it is its bytes are marked as code, so changing them
+//      comes to CPU_InvalidatePage() and it is checked again. If not, not until the next frame.
+//*******************************************************************************************************
+
+static BYTE8 CPU_Chip8Verify(CPU1802MACHINE *cpu)
+{
+    WORD16 address;
+    unsigned long sum = 0;
+    cpu->chip8Code = CHIP8_STALE;
+    for (address = 0;address < CHIP8_SIZE;address++)
+        sum = (sum * 31 + CPU_Read(cpu,address)) & 0xFFFFFFFFL;
+    if (sum != CHIP8_CHECKSUM) return FALSE;
+    for (address = 0;address < CHIP8_SIZE;address++)
+    {
+        cpu->codeMap[address >> 8][(address >> 3) & 31] |= (1 << (address & 7));
+        CPU_MarkCodePage(cpu,address >> 8);
+    }
+    cpu->chip8Code = CHIP8_VALID;
+    return TRUE;
+}
+
+//*******************************************************************************************************
+//      What the fetch loop leaves behind, from $001B up to the handler. b1 and b2 are the instruction,
+//      handler where it goes. 0NNN goes to NNN itself, the rest through the tables.
+//*******************************************************************************************************
+
+static void CPU_Chip8Fetch(CPU1802MACHINE *cpu,BYTE8 b1,BYTE8 b2,WORD16 handler)
+{
+    CHIP8_PHI(7,R[6] >> 8);                                                         // GHI R6 PHI R7
+    X = 2;                                                                          // SEX R2
+    CHIP8_PHI(12,R[4] >> 8);                                                        // GHI R4 PHI RC
+    R[5]++;                                                                         // LDA R5 PLO RF
+    CHIP8_PLO(15,b1);
+    if (b1 >= 0x10)
+    {
+        CHIP8_PLO(6,0xF0 | (b1 & 0x0F));                                            // R6 to VX, R7 to VY
+        CHIP8_PLO(7,0xF0 | (b2 >> 4));
+        CHIP8_PLO(12,0x60 + (b1 >> 4));                                             // RC left on the low byte
+        D = handler & 0xFF;
+        DF = 0;                                                                     // from ADI $0F
+    }
+    else
+    {
+        R[5]++;                                                                     // LDA R5 for the low byte
+        D = b2;
+        DF = (b1 >> 3) & 1;                                                         // last bit out of the SHRs
+    }
+    R[3] = handler;
+    P = 3;
+}
+
+//*******************************************************************************************************
+//      Run one instruction from the fetch loop, returning FALSE (having changed nothing) if it is
+//      left to the interpreter. count is the 1802 instructions it takes, fetch, handler and BR $1B.
+//*******************************************************************************************************
+
+static BYTE8 CPU_Chip8Instruction(CPU1802MACHINE *cpu,INT16 limit)
+{
+    BYTE8 b1 = CPU_Read(cpu,R[5]),b2 = CPU_Read(cpu,R[5]+1);
+    BYTE8 x = b1 & 0x0F,n = b2 & 0x0F,v,flag;
+    WORD16 handler,vx,vy,next,address,stack;
+    int count,i,s;
+    if (b1 >= 0x10)
+    {
+        handler = (CPU_Read(cpu,CHIP8_TABLE+(b1 >> 4)) << 8) | CPU_Read(cpu,CHIP8_TABLE+0x10+(b1 >> 4));
+        count = 33+1;
+    }
+    else
+    {
+        handler = (x << 8) | b2;
+        count = 19+1;
+        if (handler != 0x00EE) return FALSE;                                        // Machine code, or 00E0
+    }
+    vx = (R[6] & 0xFF00) | 0xF0 | x;                                                // Where VX and VY are
+    vy = (R[6] & 0xFF00) | 0xF0 | (b2 >> 4);
+    stack = R[2];
+    switch(handler)
+    {
+        case 0x00EE:                                                                // 00EE return
+            if (!CHIP8_FITS(count+5)) return FALSE;
+            CPU_Chip8Fetch(cpu,b1,b2,handler);
+            CHIP8_PHI(5,CPU_Read(cpu,R[2]++));
+            D = CPU_Read(cpu,R[2]++);
+            CHIP8_PLO(5,D);
+            count += 5;next = 0x00F3;
+            break;
+
+        case 0x0175:                                                                // 2NNN call, then as 1NNN
+        case 0x017C:                                                                // 1NNN jump
+            count += (handler == 0x0175) ? 13 : 6;
+            if (!CHIP8_FITS(count)) return FALSE;
+            CPU_Chip8Fetch(cpu,b1,b2,handler);
+            if (handler == 0x0175)
+            {
+                address = R[5]+1;
+                CPU_Write(cpu,--R[2],address & 0xFF);
+                CPU_Write(cpu,--R[2],address >> 8);
+            }
+            R[5] = (x << 8) | b2;
+            D = x;
+            next = 0x0183;
+            break;
+
+        case 0x0183:                                                                // 3XNN skip if VX == NN
+        case 0x018B:                                                                // 4XNN skip if VX != NN
+        case 0x0195:                                                                // 5XY0 skip if VX == VY
+        case 0x0191:                                                                // 9XY0 skip if VX != VY
+            D = (handler == 0x0183 || handler == 0x018B) ? b2 : CPU_Read(cpu,vy);
+            flag = (D ^ CPU_Read(cpu,vx)) != 0;                                     // TRUE if different
+            if (handler == 0x0183 || handler == 0x0195) flag = !flag;               // TRUE if skipping
+            count += (flag ? 7 : 5) + (handler == 0x0195 || handler == 0x0191 ? 2 : 0);
+            if (!CHIP8_FITS(count)) return FALSE;
+            CPU_Chip8Fetch(cpu,b1,b2,handler);
+            D = (handler == 0x0183 || handler == 0x018B) ? b2 : CPU_Read(cpu,vy);
+            D = D ^ CPU_Read(cpu,vx);
+            X = 6;
+            R[5] += flag ? 3 : 1;
+            next = flag ? 0x018B : (handler == 0x0183 || handler == 0x0195) ? 0x0183 : 0x0191;
+            break;
+
+        case 0x01B4:                                                                // 6XNN VX = NN
+            if (!CHIP8_FITS(count+3)) return FALSE;
+            CPU_Chip8Fetch(cpu,b1,b2,handler);
+            R[5]++;D = b2;
+            CPU_Write(cpu,vx,D);
+            count += 3;next = 0x01B7;
+            break;
+
+        case 0x01B7:                                                                // 7XNN VX += NN, VF unchanged
+            if (!CHIP8_FITS(count+5)) return FALSE;
+            CPU_Chip8Fetch(cpu,b1,b2,handler);
+            R[5]++;X = 6;
+            i = b2 + CPU_Read(cpu,vx);DF = i >> 8;D = i;
+            CPU_Write(cpu,vx,D);
+            count += 5;next = 0x01BC;
+            break;
+
+        case 0x01BC:                                                                // 8XYN arithmetic
+            if (n == 0)                                                             // 8XY0 VX = VY
+            {
+                if (!CHIP8_FITS(count+6)) return FALSE;
+                CPU_Chip8Fetch(cpu,b1,b2,handler);
+                R[5]++;
+                D = CPU_Read(cpu,vy);
+                CPU_Write(cpu,vx,D);
+                count += 6;next = 0x01C4;
+                break;
+            }
+            if ((n > 7 && n != 0x0E) ||                                             // Run as an op on the stack, only
+                    CHIP8_OVERLAPS(stack-2,2,vx) || CHIP8_OVERLAPS(stack-2,2,vy))   // these are CHIP-8 ones.
+                return FALSE;
+            if (!CHIP8_FITS(count+22)) return FALSE;
+            CPU_Chip8Fetch(cpu,b1,b2,handler);
+            R[5]++;
+            CHIP8_PLO(15,n);
+            CPU_Write(cpu,stack-1,0xD3);                                            // SEP R3 after it
+            CPU_Write(cpu,stack-2,0xF0 | n);
+            X = 6;
+            D = CPU_Read(cpu,vy);
+            v = CPU_Read(cpu,vx);
+            switch(n)
+            {
+                case 0x1:   D = D | v;break;                                        // 8XY1 OR, 8XY2 AND, 8XY3 XOR
+                case 0x2:   D = D & v;break;
+                case 0x3:   D = D ^ v;break;
+                case 0x4:   i = D + v;DF = i >> 8;D = i;break;                      // 8XY4 VX = VX + VY
+                case 0x5:   i = v + (D ^ 0xFF) + 1;DF = i >> 8;D = i;break;         // 8XY5 VX = VX - VY
+                case 0x6:   DF = D & 1;D = D >> 1;break;                            // 8XY6 VX = VY >> 1
+                case 0x7:   i = D + (v ^ 0xFF) + 1;DF = i >> 8;D = i;break;         // 8XY7 VX = VY - VX
+                case 0xE:   DF = D >> 7;D = D << 1;break;                           // 8XYE VX = VY << 1
+            }
+            CPU_Write(cpu,vx,D);
+            CHIP8_PLO(6,0xFF);                                                      // VF = DF
+            D = DF;DF = 0;
+            CPU_Write(cpu,R[6],D);
+            count += 22;next = 0x01D9;
+            break;
+
+        case 0x01EB:                                                                // ANNN I = NNN
+            if (!CHIP8_FITS(count+6)) return FALSE;
+            CPU_Chip8Fetch(cpu,b1,b2,handler);
+            R[5]++;
+            R[10] = (x << 8) | b2;
+            D = x;
+            count += 6;next = 0x01F2;
+            break;
+
+        case 0x01A4:                                                                // BNNN jump to NNN + V0
+            i = b2 + CPU_Read(cpu,(R[6] & 0xFF00) | 0xF0);
+            count += 11 + (i >> 8);
+            if (!CHIP8_FITS(count)) return FALSE;
+            CPU_Chip8Fetch(cpu,b1,b2,handler);
+            CHIP8_PLO(7,0xF0);X = 7;
+            R[5]++;
+            i = b2 + CPU_Read(cpu,R[7]);
+            D = x + (i >> 8);DF = 0;
+            R[5] = (D << 8) | (i & 0xFF);
+            next = 0x01B4;
+            break;
+
+        case 0x01D9:                                                                // CXNN VX = random & NN
+            if (!CHIP8_FITS(count+18)) return FALSE;
+            CPU_Chip8Fetch(cpu,b1,b2,handler);
+            R[9]++;
+            R[14] = 0x0100 | (R[9] & 0xFF);X = 14;                                  // Random from R9 and the
+            i = (R[9] >> 8) + CPU_Read(cpu,R[14]);DF = i >> 8;D = i;                // interpreter's own code
+            CPU_Write(cpu,vx,D);
+            v = DF;DF = D & 1;D = (D >> 1) | (v << 7);                              // RSHR
+            X = 6;
+            i = D + CPU_Read(cpu,vx);DF = i >> 8;D = i;
+            CHIP8_PHI(9,D);
+            CPU_Write(cpu,vx,D);
+            R[5]++;
+            D = b2 & CPU_Read(cpu,vx);
+            CPU_Write(cpu,vx,D);
+            count += 18;next = 0x01EB;
+            break;
+
+        case 0x0199:                                                                // EX9E / EXA1 skip on key
+            if (b2 != 0x9E && b2 != 0xA1) return FALSE;
+            if (!CHIP8_FITS(count+9)) return FALSE;
+            CPU_Chip8Fetch(cpu,b1,b2,handler);
+            X = 6;
+            CPU_OutputHandler(cpu,2,CPU_Read(cpu,vx));                              // OUT 2 selects the key
+            R[5]++;D = b2;
+            flag = CPU_ReadEFlag(cpu,3,b2 == 0x9E ? 0x01A0 : 0x01A3);               // EF3 if it is down
+            if (b2 == 0xA1) flag = !flag;                                           // TRUE if skipping
+            R[5] += flag ? 2 : 0;
+            count += flag ? 9 : 7;
+            next = flag ? 0x018B : (b2 == 0x9E) ? 0x01A1 : 0x01A4;
+            break;
+
+        case 0x0105:                                                                // FXNN
+            count += 2;                                                             // LDA R5 PLO R3 to $01NN
+            switch(b2)
+            {
+                case 0x07:                                                          // FX07 VX = delay
+                case 0x15:                                                          // FX15 delay = VX
+                case 0x18:                                                          // FX18 sound = VX
+                    if (!CHIP8_FITS(count+3)) return FALSE;
+                    CPU_Chip8Fetch(cpu,b1,b2,handler);
+                    R[5]++;
+                    if (b2 == 0x07) { D = R[8] >> 8;CPU_Write(cpu,vx,D); }
+                    if (b2 == 0x15) { D = CPU_Read(cpu,vx);CHIP8_PHI(8,D); }
+                    if (b2 == 0x18) { D = CPU_Read(cpu,vx);CHIP8_PLO(8,D); }
+                    count += 3;next = 0x0103 + b2;
+                    break;
+
+                case 0x1E:                                                          // FX1E I += VX
+                    i = (R[10] & 0xFF) + CPU_Read(cpu,vx);
+                    count += (i > 0xFF) ? 9 : 6;
+                    if (!CHIP8_FITS(count)) return FALSE;
+                    CPU_Chip8Fetch(cpu,b1,b2,handler);
+                    R[5]++;X = 6;
+                    i = (R[10] & 0xFF) + CPU_Read(cpu,vx);DF = i >> 8;D = i;
+                    CHIP8_PLO(10,D);
+                    if (DF) { i = (R[10] >> 8) + 1;DF = i >> 8;D = i;CHIP8_PHI(10,D); }
+                    next = 0x0129;
+                    break;
+
+                case 0x29:                                                          // FX29 I = font for VX
+                    if (!CHIP8_FITS(count+8)) return FALSE;
+                    CPU_Chip8Fetch(cpu,b1,b2,handler);
+                    R[5]++;
+                    R[10] = 0x8100 | (CPU_Read(cpu,vx) & 0x0F);                     // from the monitor's table
+                    D = CPU_Read(cpu,R[10]);
+                    CHIP8_PLO(10,D);
+                    count += 8;next = 0x0133;
+                    break;
+
+                case 0x33:                                                          // FX33 BCD of VX at I
+                    v = CPU_Read(cpu,vx);
+                    if (CHIP8_OVERLAPS(R[10],3,vx) || R[10] < CHIP8_SIZE || R[10] > 0xFFFD) return FALSE;
+                    count += 40 + 8 * (v / 100 + v / 10 % 10 + v % 10);
+                    if (!CHIP8_FITS(count)) return FALSE;
+                    CPU_Chip8Fetch(cpu,b1,b2,handler);
+                    R[5]++;X = 6;
+                    CHIP8_PHI(15,v);
+                    CPU_Write(cpu,R[10],v / 100);
+                    CPU_Write(cpu,R[10]+1,v / 10 % 10);
+                    CPU_Write(cpu,R[10]+2,v % 10);
+                    CPU_Write(cpu,vx,v);                                            // Changed as it goes
+                    R[14] = 0x011E;                                                 // past the 100,10,1 table
+                    D = v;DF = 1;
+                    next = 0x0154;
+                    break;
+
+                case 0x55:                                                          // FX55 store V0-VX at I
+                case 0x65:                                                          // FX65 load V0-VX from I
+                    if (CHIP8_OVERLAPS(R[10],x+1,stack-1) || R[10] < CHIP8_SIZE ||
+                        (WORD16)(R[10]+x) < CHIP8_SIZE || CHIP8_OVERLAPS((R[6] & 0xFF00) | 0xF0,x+1,stack-1))
+                        return FALSE;
+                    count += 7 + 7 * (x + 1);
+                    if (!CHIP8_FITS(count)) return FALSE;
+                    CPU_Chip8Fetch(cpu,b1,b2,handler);
+                    R[5]++;
+                    CPU_Write(cpu,stack-1,R[6] & 0xFF);                             // VX low byte, to stop at
+                    CHIP8_PLO(7,0xF0);
+                    for (i = 0;i <= x;i++)                                          // in the order the 1802 does it
+                    {
+                        if (b2 == 0x55)
+                            CPU_Write(cpu,R[10],CPU_Read(cpu,R[7]));
+                        else
+                            CPU_Write(cpu,R[7],CPU_Read(cpu,R[10]));
+                        R[7]++;R[10]++;                                             // I is left after them
+                    }
+                    D = 0;
+                    next = (b2 == 0x55) ? 0x0165 : 0x0175;
+                    break;
+
+                default:                                                            // FX0A and the rest
+                    return FALSE;
+            }
+            break;
+
+        case 0x0070:                                                                // DXYN, up to the IDL
+            v = CPU_Read(cpu,vx);
+            s = v & 7;                                                              // Shift right in the byte
+            count += 34 + n * (23 + 10 * s) - 1;                                    // not the BR $1B
+            if (CHIP8_OVERLAPS(stack-1,1,(R[6] & 0xFF00) | 0xD0) ||
+                    CHIP8_OVERLAPS((R[6] & 0xFF00) | 0xD0,n*2,stack-1))             // Row buffer at $D0 in the V page
+                return FALSE;
+            if (!CHIP8_FITS(count)) return FALSE;
+            CPU_Chip8Fetch(cpu,b1,b2,handler);
+            CHIP8_PHI(14,s);
+            CPU_Write(cpu,--R[2],(v & 0x3F) >> 3);                                  // Byte column, for the drawing
+            D = ((CPU_Read(cpu,vy) & 0x1F) << 3) | CPU_Read(cpu,R[2]);
+            DF = 0;
+            CHIP8_PLO(12,D);
+            CHIP8_PHI(12,R[11] >> 8);                                               // RC to the screen
+            R[5]++;
+            CHIP8_PLO(13,n);
+            CHIP8_PLO(6,0xD0);
+            for (i = 0;i < n;i++)                                                   // Each row into two bytes at R6
+            {
+                BYTE8 left = CPU_Read(cpu,R[10]++),right = 0;
+                for (v = s;v > 0;v--)
+                {
+                    DF = left & 1;left = left >> 1;                                 // SHR
+                    flag = right & 1;right = (right >> 1) | (DF << 7);DF = flag;    // RSHR
+                }
+                CHIP8_PHI(13,left);
+                CHIP8_PLO(14,0);
+                CPU_Write(cpu,R[6]++,left);
+                CPU_Write(cpu,R[6]++,right);
+            }
+            CHIP8_PLO(15,0);
+            R[10] -= n;                                                             // I back where it was
+            CHIP8_PLO(7,0);
+            D = 0;
+            Cycles -= count * 2;
+            R[3] = CHIP8_DRAW-1;                                                    // Left at the IDL
+            R[4] = 0x0042;
+            return TRUE;
+
+        default:                                                                    // 00E0, 0NNN and anything else
+            return FALSE;
+    }
+    Cycles -= count * 2;
+    R[3] = next;
+    P = 4;
+    R[4] = CHIP8_FETCH;
+    return TRUE;
+}
+
+//*******************************************************************************************************
+//      Draw the sprite DXYN made, after the interrupt, up to the next fetch. The interrupt routine
+//      has come back to $00AD with RC on the screen, R6 on the rows, RD.0 their count and the byte
+//      column on the stack. Rows stop at the bottom of the screen page, the right byte at its edge.
+//*******************************************************************************************************
+
+static BYTE8 CPU_Chip8Draw(CPU1802MACHINE *cpu,INT16 limit)
+{
+    BYTE8 rows = R[13] & 0xFF,column = CPU_Read(cpu,R[2]),screen,collide = 0;
+    int count = 5+2+6+1 + rows * 29,i;                                              // As if every row hit on both bytes
+    if ((R[12] >> 8) == (R[2] >> 8) || (R[12] >> 8) == (R[6] >> 8)) return FALSE;   // Screen is not the stack or V page
+    if (!CHIP8_FITS(count)) return FALSE;
+    count = 5+6+1;
+    X = 12;
+    CHIP8_PLO(6,0xD0);
+    CHIP8_PLO(7,0);
+    for (;;)
+    {
+        if ((R[13] & 0xFF) == 0) { count += 2;break; }                              // All the rows done
+        R[13]--;
+        screen = CPU_Read(cpu,R[12]);
+        if (CPU_Read(cpu,R[6]) & screen) { collide = 1;count += 2; }
+        D = CPU_Read(cpu,R[6]++) ^ screen;
+        CPU_Write(cpu,R[12],D);
+        count += 2+4+3+3+5;
+        if (column != 7)                                                            // Right byte, if on the screen
+        {
+            screen = CPU_Read(cpu,R[12]+1);
+            if (CPU_Read(cpu,R[6]) & screen) { collide = 1;count += 2; }
+            D = CPU_Read(cpu,R[6]) ^ screen;
+            CPU_Write(cpu,R[12]+1,D);
+            count += 8;
+        }
+        R[6]++;
+        i = (R[12] & 0xFF) + 8;DF = i >> 8;
+        CHIP8_PLO(12,i);
+        if (DF) break;                                                              // Off the bottom
+    }
+    CHIP8_PLO(7,collide);
+    CHIP8_PLO(6,0xFF);
+    D = collide;
+    CPU_Write(cpu,R[6],D);                                                          // VF
+    R[2]++;
+    Cycles -= count * 2;
+    R[3] = 0x00E0;
+    P = 4;
+    R[4] = CHIP8_FETCH;
+    return TRUE;
+}
+
+//*******************************************************************************************************
+//      Run CHIP-8 instructions from R[P] for as long as they are known and fit, returning TRUE if any
+//      were. Registers are in the context, as for CPU_Execute().
+//*******************************************************************************************************
+
+static BYTE8 CPU_Chip8Run(CPU1802MACHINE *cpu,INT16 limit)
+{
+    BYTE8 ran = FALSE;
+    while (cpu->chip8Code == CHIP8_VALID || (cpu->chip8Code == CHIP8_UNCHECKED && CPU_Chip8Verify(cpu)))
+    {
+        if (P == 4 && R[4] == CHIP8_FETCH)
+        {
+            if (!CPU_Chip8Instruction(cpu,limit)) break;
+        }
+        else if (P == 3 && R[3] == CHIP8_DRAW)
+        {
+            if (!CPU_Chip8Draw(cpu,limit)) break;
+        }
+        else break;
+        ran = TRUE;
+    }
+    return ran;
+}
+
+#undef CHIP8_FITS
+#undef CHIP8_PLO
+#undef CHIP8_PHI
+#undef CHIP8_OVERLAPS
@@ -0,0 +1,344 @@
+//*******************************************************************************************************
+//*******************************************************************************************************
+//
+//      Name:       CpuCore.H
+//      Purpose:    1802 Run Loop (included by cpumachine.h once per variant)
+//      Date:       17th October 2026
+//
+//*******************************************************************************************************
+//*******************************************************************************************************
+
+// Before including define RUN_FUNCTION as the name of the function to create, and RUN_BREAKCHECK if
+// it should stop when R[P] reaches the break point. The function executes instructions until Cycles
+// drops below limit, returning TRUE if it stopped at the break point instead.
+//
+// With RUN_DISPLAY it is the loop for while the 1861 is fetching the display. That runs an instruction
+// at a time, never from blocks, and before each one that could tell (DISPLAY_TOUCHES()) it fetches the
+// lines that are due (see CPU_DisplayDMA()). It stops at the break point if one is set. When none is,
+// it runs the compiled ROM code as below, which does the same check in STATIC_FETCH() so only the
+// instructions that could tell pay for it, and it leaves for the interpreter at an IDL.
+//
+// The registers are held in locals for the whole call. As well as saving the indirection this tells
+// the compiler that stores into RAM cannot change them, so they are not reloaded after every write.
+//
+// With BLOCK_CACHE everything runs from predecoded blocks. R[P] is moved past each instruction before
+// it runs and FETCH2() / FETCH3() return the operand. The fetch cycles for the whole block are taken
+// up front and handed back for any ops not run. When R[P] is not where the next op expects, the
+// threaded core goes straight on to the next block if it is cached and will not take Cycles below
+// limit. Otherwise only the part of the block that would have run is copied and run (just one
+// instruction when checking for the break point), so the stopping point is unchanged.
+//
+// With RUN_JIT defined blocks are not chained, every block start goes back to the loop so hot code can
+// be found and run translated (see cpujit.h). The registers are written back to the context for that.
+//
+// Idling (IDL, or a branch to itself) skips straight to the point Cycles drops below limit, counting
+// in the ops whose fetch has already been taken (IDLE_PENDING). The break point loop runs it for real
+// so it stops on it as before, and so does the display loop, as a DMA can end it. Both have IDLE_SKIPS
+// zero, so their branches don't compare the target with their own address at all.
+//
+// With RUN_STATIC defined blocks are not chained either, and each time round the loop R[P] is looked up
+// in the ROM code compiled ahead of time (cpu1802static.h, made by Generate/staticrom.py). That runs on
+// the locals directly, a whole basic block at a time while it fits in the cycles left, and comes back
+// to staticLeave when R[P] leaves it or the next block does not fit, the interpreter then carries on.
+// With CHIP8_HLE the hooked blocks (STATIC_HOOK()) come back there too, and the CHIP-8 instructions
+// are run natively from that point while they can be (see cpuchip8.h). STUDIO2_HLE does the same for
+// the Studio 2 BIOS (see cpustudio2.h). With ROUTINE_HOOKS the STATIC_ROUTINE() blocks come back there
+// when hooks are on, for single ROM routines to be run natively (see cpuhooks.h).
+
+#if defined(BLOCK_CACHE) && !defined(RUN_DISPLAY)
+#define RUN_BLOCKS
+#endif
+
+#undef FETCH2
+#undef FETCH3
+#ifdef RUN_BLOCKS
+#define FETCH2()    ((BYTE8)op->operand)
+#define FETCH3()    { _temp = op->operand; }
+#else
+#define FETCH2()    (READ(R[P]++))
+#define FETCH3()    { _temp = READ(R[P]++);_temp = (_temp << 8) | READ(R[P]++); }
+#endif
+
+#undef IDLE
+#undef IDLE_SKIPS
+#undef IDLE_PENDING
+#if defined(RUN_BREAKCHECK) || defined(RUN_DISPLAY)
+#define IDLE_SKIPS  (0)                                                             // Branches don't look for it
+#define IDLE(n)     ((void)0)
+#else
+#define IDLE_SKIPS  (1)
+#define IDLE(n)     { if (Cycles + IDLE_PENDING >= limit) Cycles -= (Cycles + IDLE_PENDING - limit) / (n) * (n) + (n); }
+#endif
+#ifdef RUN_BLOCKS
+#define IDLE_PENDING    (op[1].refund)
+#else
+#define IDLE_PENDING    (0)
+#endif
+
+#undef STATIC_HOOK
+#undef STATIC_ROUTINE
+#undef STATIC_FETCH
+#ifdef RUN_DISPLAY
+#define STATIC_HOOK()
+#define STATIC_ROUTINE()
+#define STATIC_FETCH(op)    if ((op) == 0x00) goto staticLeave;                             \
+                            if (Cycles <= dmaDue && DISPLAY_TOUCHES(op))                    \
+                            {                                                               \
+                                CPU_DisplayDMA(cpu,&R[0],cpu->eventDeadline - Cycles - 1);  \
+                                dmaDue = DISPLAY_DUE();                                     \
+                            }                                                               \
+                            idling = FALSE
+#else
+#define STATIC_FETCH(op)
+#if defined(CHIP8_HLE)
+#define STATIC_HOOK()   if (cpu->useChip8) goto staticLeave
+#elif defined(STUDIO2_HLE)
+#define STATIC_HOOK()   if (cpu->useStudio2) goto staticLeave
+#else
+#define STATIC_HOOK()
+#endif
+
+#ifdef ROUTINE_HOOKS
+#define STATIC_ROUTINE()    if (cpu->useHooks) goto staticLeave
+#else
+#define STATIC_ROUTINE()
+#endif
+#endif
+
+#ifndef STORE_REGISTERS
+#define STORE_REGISTERS()   cpu->D = D;cpu->X = X;cpu->P = P;cpu->T = T;                \
+                            cpu->DF = DF;cpu->IE = IE;cpu->Q = Q;cpu->Cycles = Cycles;  \
+                            for (opCode = 0;opCode < 16;opCode++) cpu->R[opCode] = R[opCode]
+#define LOAD_REGISTERS()    D = cpu->D;X = cpu->X;P = cpu->P;T = cpu->T;                \
+                            DF = cpu->DF;IE = cpu->IE;Q = cpu->Q;Cycles = cpu->Cycles;  \
+                            for (opCode = 0;opCode < 16;opCode++) R[opCode] = cpu->R[opCode]
+#endif
+
+static BYTE8 RUN_FUNCTION(CPU1802MACHINE *cpu,INT16 limit)
+{
+    BYTE8 D = cpu->D,X = cpu->X,P = cpu->P,T = cpu->T;                              // 1802 8 bit registers
+    BYTE8 DF = cpu->DF,IE = cpu->IE,Q = cpu->Q;                                     // 1802 1 bit registers
+    INT16 Cycles = cpu->Cycles;                                                     // Cycles till the next event
+    WORD16 R[16];                                                                   // 1802 16 bit registers
+    WORD16 _temp;                                                                   // Temporary register
+    BYTE8 opCode,hitBreak = FALSE;
+    #ifdef RUN_BREAKCHECK
+    WORD16 breakPoint = cpu->breakPoint;                                            // Address to stop at
+    #endif
+    #ifdef RUN_DISPLAY
+    long breakPoint = cpu->breakEnabled ? cpu->breakPoint : -1;                     // Address to stop at, if any
+    long dmaDue;                                                                    // Cycles is this or less when a line is due
+    BYTE8 idling = cpu->dmaIdle;                                                    // Last instruction was IDL
+    #endif
+    #ifdef RUN_BLOCKS
+    BLOCK *cache = (BLOCK *)cpu->blockCache;                                        // Block cache
+    BLOCK *block,single;                                                            // Block being run, one instruction block
+    const MICROOP *op;                                                              // Instruction being run
+    #endif
+    #ifdef RUN_JIT
+    BYTE8 *jitCode;                                                                 // Translated code for R[P]
+    #ifdef RUN_STATIC
+    INT16 jitCycles;                                                                // Cycles before it ran
+    #endif
+    #endif
+    #if defined(RUN_STATIC) && !defined(RUN_DISPLAY) && (defined(CHIP8_HLE) || defined(STUDIO2_HLE) || defined(ROUTINE_HOOKS))
+    BYTE8 nativeRan;                                                                // Instructions were run natively
+    #endif
+    for (opCode = 0;opCode < 16;opCode++) R[opCode] = cpu->R[opCode];
+
+    #ifdef RUN_BLOCKS
+    #ifdef THREADED_DISPATCH
+    static void *dispatch[256] = {                                                  // Handler addresses for each opcode
+        #include "cpu1802dispatch.h"
+    };
+    #if defined(RUN_BREAKCHECK) || defined(RUN_JIT) || defined(RUN_STATIC)
+    #define DISPATCH()  op++;                                                           \
+                        if (R[P] != op->address) { Cycles += op->refund;goto blockNext; } \
+                        R[P] += op->length;goto *dispatch[op->opCode]
+    #else
+    #define DISPATCH()  op++;                                                           \
+                        if (R[P] != op->address)                                        \
+                        {                                                               \
+                            Cycles += op->refund;                                       \
+                            block = cache + (R[P] & (BLOCK_CACHE_SIZE-1));              \
+                            if (block->start != R[P] || Cycles - block->cycles < limit) \
+                                goto blockNext;                                         \
+                            op = block->op;                                             \
+                            Cycles -= block->fetchCycles;                               \
+                        }                                                               \
+                        R[P] += op->length;goto *dispatch[op->opCode]
+    #endif
+    #endif
+    for (;;)
+    {
+        #ifdef RUN_STATIC
+        #undef IDLE_PENDING
+        #define IDLE_PENDING    (0)
+        #include "cpu1802static.h"
+        #undef IDLE_PENDING
+        #define IDLE_PENDING    (op[1].refund)
+staticLeave:
+        if (Cycles < limit) break;                                                  // Idled till the end
+        #ifdef CHIP8_HLE
+        if (cpu->useChip8 && CHIP8_AT(P,R[P]))                                      // CHIP-8 instructions run natively
+        {
+            STORE_REGISTERS();
+            nativeRan = CPU_Chip8Run(cpu,limit);
+            LOAD_REGISTERS();
+            if (nativeRan) continue;
+        }
+        #endif
+        #ifdef STUDIO2_HLE
+        if (cpu->useStudio2 && STUDIO2_AT(P,R[P]))                                  // Studio 2 instructions run natively
+        {
+            STORE_REGISTERS();
+            nativeRan = CPU_Studio2Run(cpu,limit);
+            LOAD_REGISTERS();
+            if (nativeRan) continue;
+        }
+        #endif
+        #ifdef ROUTINE_HOOKS
+        if (cpu->useHooks && HOOK_PAGE(cpu,R[P]))                                   // Hooked ROM routines run natively
+        {
+            STORE_REGISTERS();
+            nativeRan = CPU_RunHook(cpu,limit);
+            LOAD_REGISTERS();
+            if (nativeRan) continue;
+        }
+        #endif
+        #endif
+        #ifdef RUN_JIT
+        block = CPU_FindBlock(cache,cpu,R[P]);                                      // If it fits, as translated code
+        jitCode = (Cycles - block->cycles >= limit) ? CPU_JitFind(cpu,R[P],P) : NULL;   // can't stop part way
+        if (jitCode != NULL)                                                        // Hot, run translated code
+        {
+            #ifdef RUN_STATIC
+            jitCycles = Cycles;
+            #endif
+            STORE_REGISTERS();
+            CPU_JitRun(cpu,jitCode,limit);                                          // till it reaches untranslated code
+            LOAD_REGISTERS();
+            if (Cycles < limit) break;
+            #ifdef RUN_STATIC
+            if (Cycles != jitCycles) continue;                                      // which may be compiled
+            #endif
+        }
+        #endif
+        block = CPU_FindBlock(cache,cpu,R[P]);
+        #ifdef RUN_BREAKCHECK
+        block = CPU_PartBlock(block,&single,-1);                                    // One instruction to check the break point
+        #else
+        if (Cycles - block->cycles < limit)                                         // Too long, run as much as will fit
+            block = CPU_PartBlock(block,&single,Cycles - limit);
+        #endif
+        op = block->op;
+        Cycles -= block->fetchCycles;                                               // 2 x 8 clock Cycles - Fetch and Execute.
+        R[P] += op->length;
+        #ifdef THREADED_DISPATCH
+        goto *dispatch[op->opCode];
+
+        #include "cpu1802threaded.h"
+
+blockNext:
+        #else
+        for (;;)
+        {
+            switch(op->opCode)                                                      // Execute dependent on the Operation Code
+            {
+                #include "cpu1802.h"
+            }
+            op++;
+            if (R[P] != op->address)                                                // Branched or ended, refund the ops not run
+            {
+                Cycles += op->refund;
+                break;
+            }
+            R[P] += op->length;
+        }
+        #endif
+        if (Cycles < limit) break;                                                  // Out of cycles
+        #ifdef RUN_BREAKCHECK
+        if (R[P] == breakPoint) { hitBreak = TRUE;break; }                          // Reached the break point
+        #endif
+    }
+    #undef DISPATCH
+    #else
+
+    #ifdef RUN_DISPLAY
+    #define DISPLAY_DUE()   ((cpu->dmaLine < CPU_DISPLAY_LINES) ? (long)(cpu->eventDeadline - 1 - cpu->dmaNext) : -0x10000L)
+    #define DISPLAY_FETCH() opCode = READ(R[P]);                                            \
+                            if (Cycles <= dmaDue && DISPLAY_TOUCHES(opCode))                \
+                            {                                                               \
+                                CPU_DisplayDMA(cpu,&R[0],cpu->eventDeadline - Cycles - 1);  \
+                                if (idling) opCode = READ(++R[P]);                          \
+                                dmaDue = DISPLAY_DUE();                                     \
+                            }                                                               \
+                            R[P]++;Cycles -= 2
+    dmaDue = DISPLAY_DUE();
+    #else
+    #define DISPLAY_FETCH() opCode = READ(R[P]++);Cycles -= 2
+    #endif
+
+    #if defined(THREADED_DISPATCH) && !defined(RUN_DISPLAY)                         // A switch is quicker for the display loop
+    static void *dispatch[256] = {                                                  // Handler addresses for each opcode
+        #include "cpu1802dispatch.h"
+    };
+    #ifdef RUN_BREAKCHECK
+    #define DISPATCH()  if (Cycles < limit) goto runEnd;                                \
+                        if (R[P] == breakPoint) { hitBreak = TRUE;goto runEnd; }        \
+                        DISPLAY_FETCH();goto *dispatch[opCode]
+    #else
+    #define DISPATCH()  if (Cycles < limit) goto runEnd;                                \
+                        DISPLAY_FETCH();goto *dispatch[opCode]
+    #endif
+
+    DISPLAY_FETCH();                                                                // Fetch and start the first instruction,
+    goto *dispatch[opCode];                                                         // each handler then dispatches the next.
+
+    #include "cpu1802threaded.h"
+
+runEnd:
+    #undef DISPATCH
+    #else
+    for (;;)
+    {
+        #if defined(RUN_STATIC) && defined(RUN_DISPLAY)
+        if (breakPoint < 0)                                                         // Compiled ROM code, when it need not stop
+        {
+            #include "cpu1802static.h"
+        }
+staticLeave:
+        if (Cycles < limit) break;                                                  // Ran till the end
+        #endif
+        DISPLAY_FETCH();                                                            // 2 x 8 clock Cycles - Fetch and Execute.
+        switch(opCode)                                                              // Execute dependent on the Operation Code
+        {
+            #include "cpu1802.h"
+        }
+        #ifdef RUN_DISPLAY
+        idling = (opCode == 0x00);
+        #endif
+        if (Cycles < limit) break;                                                  // Out of cycles
+        #if defined(RUN_BREAKCHECK) || defined(RUN_DISPLAY)
+        if (R[P] == breakPoint) { hitBreak = TRUE;break; }                          // Reached the break point
+        #endif
+    }
+    #endif
+    #undef DISPLAY_DUE
+    #undef DISPLAY_FETCH
+    #endif
+
+    STORE_REGISTERS();                                                              // Write the registers back
+    #ifdef RUN_DISPLAY
+    cpu->dmaIdle = idling;
+    CPU_DisplayCatchUp(cpu);                                                        // Leave R0 as it is now
+    #endif
+    return hitBreak;
+}
+
+#undef RUN_FUNCTION
+#undef RUN_BREAKCHECK
+#undef RUN_JIT
+#undef RUN_STATIC
+#undef RUN_DISPLAY
+#undef RUN_BLOCKS
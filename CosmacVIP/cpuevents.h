@@ -0,0 +1,128 @@
+//*******************************************************************************************************
+//*******************************************************************************************************
+//
+//      Name:       CpuEvents.H
+//      Purpose:    Event scheduler (included by cpumachine.h)
+//      Date:       17th October 2026
+//
+//*******************************************************************************************************
+//*******************************************************************************************************
+
+// Everything that happens at a set time rather than because of an instruction, the 1861 interrupt,
+// EF1 and display, the keypad scan and the host sync, is an event due at some cycle. They are kept in
+// a small heap in the context, earliest first. Cycles counts down to the first one, so the run loops
+// only ever compare against that one value, and nothing there knows what the events are. When it drops
+// below zero CPU_RunEvents() runs everything that is due, through CPU_EventHandler(), which the file
+// that includes this supplies. A handler can schedule events, usually itself again.
+//
+// Times are absolute cycle counts from the reset. An event runs at the end of the instruction that
+// reaches its cycle, which may be a cycle or two late, so a handler schedules from the cycle it was
+// due on, not the one it ran on, and the frame does not drift. Events due on the same cycle run in
+// order of type.
+
+static BYTE8 CPU_EventHandler(CPU1802MACHINE *cpu,BYTE8 type,unsigned long when);
+
+#define EVENT_BEFORE(a,b)   ((long)((a)->when - (b)->when) < 0 ||                                       \
+                            ((a)->when == (b)->when && (a)->type < (b)->type))      // Heap order
+
+//*******************************************************************************************************
+//      Point Cycles at the first event. It is only an INT16, so a long way off it stops short and
+//      CPU_RunEvents() finds nothing due. One already due makes it negative at once.
+//*******************************************************************************************************
+
+static void CPU_EventTimer(CPU1802MACHINE *cpu,unsigned long now)
+{
+    unsigned long wait = 0x7FFF;
+    long due;
+    if (cpu->eventCount > 0)
+    {
+        due = (long)(cpu->events[0].when - now);
+        if (due < (long)wait) wait = (due > 0) ? due : 0;
+    }
+    cpu->eventDeadline = now + wait;
+    cpu->Cycles = (INT16)wait - 1;                                                  // Goes negative when it is reached
+}
+
+//*******************************************************************************************************
+//                                   The cycle it is now, at an instruction end
+//*******************************************************************************************************
+
+static inline unsigned long CPU_EventNow(CPU1802MACHINE *cpu)
+{
+    return cpu->eventDeadline - cpu->Cycles - 1;
+}
+
+//*******************************************************************************************************
+//                                  Schedule an event of type for cycle when
+//*******************************************************************************************************
+
+static void CPU_ScheduleEvent(CPU1802MACHINE *cpu,BYTE8 type,unsigned long when)
+{
+    unsigned long now = CPU_EventNow(cpu);
+    CPU1802EVENT event,*heap = cpu->events;
+    int n,parent;
+    if (cpu->eventCount >= CPU_EVENT_MAX) return;                                   // Full, a bug in whatever scheduled it
+    event.when = when;event.type = type;
+    n = cpu->eventCount++;
+    while (n > 0 && EVENT_BEFORE(&event,&heap[parent = (n-1)/2]))                   // Sift up
+    {
+        heap[n] = heap[parent];
+        n = parent;
+    }
+    heap[n] = event;
+    CPU_EventTimer(cpu,now);
+}
+
+//*******************************************************************************************************
+//                                      Take the first event off the heap
+//*******************************************************************************************************
+
+static CPU1802EVENT CPU_PopEvent(CPU1802MACHINE *cpu)
+{
+    CPU1802EVENT first = cpu->events[0],last,*heap = cpu->events;
+    int n = 0,child,count = --cpu->eventCount;
+    last = heap[count];
+    while ((child = n*2+1) < count)                                                 // Sift down
+    {
+        if (child+1 < count && EVENT_BEFORE(&heap[child+1],&heap[child])) child++;
+        if (!EVENT_BEFORE(&heap[child],&last)) break;
+        heap[n] = heap[child];
+        n = child;
+    }
+    heap[n] = last;
+    return first;
+}
+
+//*******************************************************************************************************
+//                         Clear the events, for a reset, with the time back at zero
+//*******************************************************************************************************
+
+static void CPU_ResetEvents(CPU1802MACHINE *cpu)
+{
+    cpu->eventCount = 0;
+    CPU_EventTimer(cpu,0);
+}
+
+//*******************************************************************************************************
+//      Run the events that are due, once Cycles has gone negative. Returns TRUE if one of them
+//      ended the frame. A handler may use up cycles itself (e.g. an interrupt), so the time is
+//      looked at again after each one.
+//*******************************************************************************************************
+
+static BYTE8 CPU_RunEvents(CPU1802MACHINE *cpu)
+{
+    BYTE8 frameEnded = FALSE;
+    unsigned long now = CPU_EventNow(cpu);
+    CPU1802EVENT event;
+    while (cpu->eventCount > 0 && (long)(now - cpu->events[0].when) >= 0)
+    {
+        event = CPU_PopEvent(cpu);
+        CPU_EventTimer(cpu,now);
+        if (CPU_EventHandler(cpu,event.type,event.when)) frameEnded = TRUE;
+        now = CPU_EventNow(cpu);
+    }
+    CPU_EventTimer(cpu,now);
+    return frameEnded;
+}
+
+#undef EVENT_BEFORE
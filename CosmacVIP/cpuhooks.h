@@ -0,0 +1,198 @@
+//*******************************************************************************************************
+//*******************************************************************************************************
+//
+//      Name:       CpuHooks.H
+//      Purpose:    Native versions of hot ROM routines (included by cpumachine.h)
+//      Date:       17th October 2026
+//
+//*******************************************************************************************************
+//*******************************************************************************************************
+
+// Each hook is a routine in one of the built in images, known by the machine, the checksum of the
+// image it is in, and the address and P it is entered with. When hooks are turned on and the run
+// loop comes to one (STATIC_ROUTINE() in the compiled ROM code, see Generate/staticrom.py), the image
+// is checked against its checksum and the routine is run here. As with cpuchip8.h and cpustudio2.h it
+// leaves every register and every byte of memory just as the 1802 code would, in the same number of
+// cycles, and only runs what fits in the cycles left. A loop may be run part way, leaving R[P] at its
+// top to carry on from the next time round. A hook returns FALSE, having changed nothing, to leave it
+// to the interpreter.
+//
+// To add one write the routine, add it to _routineHooks (no more than the size of hookCode) and add
+// its address to "routines" for its image in staticrom.py, so the compiled code comes back there.
+
+#define HOOK_PAGE(c,a)      ((c)->hookPage[(a) >> 11] & (1 << (((a) >> 8) & 7)))    // Page a is in has a hook
+
+#define HOOK_FITS(n)        (Cycles - (n) * 2 >= limit)                             // n instructions fit in the cycles left
+#define HOOK_PHI(r,d)       R[r] = (R[r] & 0x00FF) | ((WORD16)(BYTE8)(d) << 8)      // PHI
+
+typedef struct _ROUTINE_HOOK
+{
+    BYTE8 machine;                                                                  // MACHINE_ it is on
+    WORD16 address;                                                                 // Where it starts
+    BYTE8 p;                                                                        // and P when it does
+    WORD16 base,size;                                                               // Image it is in
+    unsigned long checksum;                                                         // and its checksum (see CPU_HookVerify())
+    BYTE8 (*run)(CPU1802MACHINE *cpu,INT16 limit);                                  // Native version
+} ROUTINE_HOOK;
+
+#ifdef IS_COSMACVIP
+
+//*******************************************************************************************************
+//      The monitor's memory size probe ($8012, P = 2). Writes $AA to the top of each page down from
+//      R1, until it reads back or there are no pages left, then goes on to $8022. The ROM is changed
+//      to step a page at a time (SMI 1, see Generate/binaryconv.py).
+//*******************************************************************************************************
+
+static BYTE8 CPU_HookMemorySize(CPU1802MACHINE *cpu,INT16 limit)
+{
+    BYTE8 ran = FALSE;
+    int i;
+    while (HOOK_FITS(10))                                                           // Longest way round the loop
+    {
+        ran = TRUE;
+        D = 0xAA;CPU_Write(cpu,R[1],D);                                             // LDI $AA STR R1
+        D = CPU_Read(cpu,R[1]) ^ 0xAA;                                              // LDN R1 XRI $AA
+        if (D == 0)                                                                 // BZ, it is RAM
+        {
+            Cycles -= 5 * 2;R[2] = 0x8022;
+            break;
+        }
+        i = (R[1] >> 8) + (0x01 ^ 0xFF) + 1;DF = i >> 8;D = i;                      // GHI R1 SMI 1
+        if (DF == 0)                                                                // BNF, none left
+        {
+            Cycles -= 8 * 2;R[2] = 0x8022;
+            break;
+        }
+        HOOK_PHI(1,D);                                                              // PHI R1 BR $12
+        Cycles -= 10 * 2;
+    }
+    return ran;
+}
+
+//*******************************************************************************************************
+//      The CHIP-8 interpreter's clear screen loop ($00E5, P = 3, run by 00E0). Zeroes the screen page
+//      down from RF, going to $00DF when it has done the first byte. Not if it would clear its own page.
+//*******************************************************************************************************
+
+static BYTE8 CPU_HookClearScreen(CPU1802MACHINE *cpu,INT16 limit)
+{
+    BYTE8 ran = FALSE;
+    if ((R[15] >> 8) == (R[3] >> 8)) return FALSE;
+    while (HOOK_FITS(6))
+    {
+        ran = TRUE;
+        D = R[3] >> 8;CPU_Write(cpu,R[15],D);                                       // GHI R3 STR RF
+        D = R[15] & 0xFF;                                                           // GLO RF BZ $DF
+        if (D == 0)
+        {
+            Cycles -= 4 * 2;R[3] = 0x00DF;
+            break;
+        }
+        R[15]--;                                                                    // DEC RF BR $E5
+        Cycles -= 6 * 2;
+    }
+    return ran;
+}
+
+#endif
+
+#ifdef STUDIO2_HLE
+
+//*******************************************************************************************************
+//      The Studio 2 BIOS sprite code ($0100, P = 3, run by Exxx), up to the SEP R4 back to the fetch
+//      loop. All of it or nothing, as it does not loop back to its start.
+//*******************************************************************************************************
+
+static BYTE8 CPU_HookStudio2Sprite(CPU1802MACHINE *cpu,INT16 limit)
+{
+    WORD16 next;
+    if (!HOOK_FITS(CPU_Studio2SpriteBound(cpu))) return FALSE;
+    Cycles -= CPU_Studio2Sprite(cpu,&next) * 2;
+    R[3] = next;
+    P = 4;
+    return TRUE;
+}
+
+#endif
+
+//*******************************************************************************************************
+//                                          The hooks there are
+//*******************************************************************************************************
+
+static const ROUTINE_HOOK _routineHooks[] = {
+    #ifdef IS_COSMACVIP
+    { MACHINE_COSMACVIP,0x8012,2,0x8000,0x0200,0x977CE85AL,CPU_HookMemorySize },    // Monitor memory size probe
+    #endif
+    #ifdef CHIP8_HLE
+    { MACHINE_COSMACVIP,0x00E5,3,0x0000,CHIP8_SIZE,CHIP8_CHECKSUM,CPU_HookClearScreen },   // CHIP-8 00E0
+    { MACHINE_COSMACVIP,CHIP8_DRAW,3,0x0000,CHIP8_SIZE,CHIP8_CHECKSUM,CPU_Chip8Draw }, // CHIP-8 DXYN drawing (see cpuchip8.h)
+    #endif
+    #ifdef STUDIO2_HLE
+    { MACHINE_STUDIO2,0x0100,3,0x0000,0x0300,0xB8A0D488L,CPU_HookStudio2Sprite },   // Studio 2 BIOS sprites
+    #endif
+    { 0,0,0,0,0,0,NULL }
+};
+
+//*******************************************************************************************************
+//      Check the image hook n is in. If it is there its bytes are marked as code, so changing them
+//      comes to CPU_InvalidatePage() and it is checked again. If not, not until the next frame.
+//*******************************************************************************************************
+
+static BYTE8 CPU_HookVerify(CPU1802MACHINE *cpu,int n)
+{
+    const ROUTINE_HOOK *hook = _routineHooks + n;
+    WORD16 address;
+    unsigned long sum = 0;
+    cpu->hookCode[n] = HOOK_STALE;
+    for (address = hook->base;address != (WORD16)(hook->base+hook->size);address++)
+        sum = (sum * 31 + CPU_Read(cpu,address)) & 0xFFFFFFFFL;
+    if (sum != hook->checksum) return FALSE;
+    for (address = hook->base;address != (WORD16)(hook->base+hook->size);address++)
+    {
+        cpu->codeMap[address >> 8][(address >> 3) & 31] |= (1 << (address & 7));
+        CPU_MarkCodePage(cpu,address >> 8);
+    }
+    cpu->hookCode[n] = HOOK_VALID;
+    return TRUE;
+}
+
+//*******************************************************************************************************
+//      Mark the pages with hooks for this machine, for HOOK_PAGE()
+//*******************************************************************************************************
+
+static void CPU_HookPages(CPU1802MACHINE *cpu)
+{
+    const ROUTINE_HOOK *hook;
+    memset(cpu->hookPage,0,sizeof(cpu->hookPage));
+    for (hook = _routineHooks;hook->run != NULL;hook++)
+    {
+        if (hook->machine == CORE_MACHINE)
+            cpu->hookPage[hook->address >> 11] |= (1 << ((hook->address >> 8) & 7));
+    }
+}
+
+//*******************************************************************************************************
+//      Run the hook at R[P], returning TRUE if it ran. Registers are in the context, as for
+//      CPU_Execute().
+//*******************************************************************************************************
+
+static BYTE8 CPU_RunHook(CPU1802MACHINE *cpu,INT16 limit)
+{
+    const ROUTINE_HOOK *hook;
+    int n;
+    for (n = 0;_routineHooks[n].run != NULL;n++)
+    {
+        hook = _routineHooks + n;
+        if (hook->address == R[P] && hook->p == P && hook->machine == CORE_MACHINE)
+        {
+            if (cpu->hookCode[n] != HOOK_VALID &&
+                    (cpu->hookCode[n] != HOOK_UNCHECKED || !CPU_HookVerify(cpu,n)))
+                return FALSE;
+            return (*hook->run)(cpu,limit);
+        }
+    }
+    return FALSE;
+}
+
+#undef HOOK_FITS
+#undef HOOK_PHI
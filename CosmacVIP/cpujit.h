@@ -0,0 +1,712 @@
+//*******************************************************************************************************
+//*******************************************************************************************************
+//
+//      Name:       CpuJit.H
+//      Purpose:    x86-64 translation of hot 1802 blocks (included by cpumachine.h)
+//      Date:       17th October 2026
+//
+//*******************************************************************************************************
+//*******************************************************************************************************
+
+// Blocks from the block cache that start JIT_HOT times are translated into x86-64 code. Translated
+// code goes from block to block through the dispatcher itself, and only returns to the interpreter
+// when it reaches code that is not translated, when the next block will not fit in the cycles left,
+// or after a write to a page holding cached code. The EF branches, SEQ, REQ, INP and OUT call the
+// same handlers the interpreter does. IDL and branches to themselves are never translated, a block
+// stops just before them and the interpreter idles. A page whose translations are thrown away
+// JIT_REWRITES times (self modifying code, like the ALU ops the VIP CHIP-8 interpreter builds in RAM)
+// is left to the interpreter too.
+//
+// While translated code runs the host registers hold
+//
+//      rbx     machine context                 r12d    limit for Cycles
+//      r13d    D (0-255)                       r14d    DF (0-1)
+//      r15d    Cycles                          ebp     non zero if a write hit cached code
+//
+// and everything else stays in the context. As in the interpreter the cycles for the whole block are
+// taken on entry, and those of the ops not run are handed back when it is left early. R[P] is only
+// stored when something might look at it, i.e. before ops using R[P] or R[X], and on the way out.
+//
+// The buffer is never writable and executable at once. It is mapped read/write, and the pages code
+// is emitted into are made read/execute again as soon as it has been (see CPU_JitProtect()).
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
+#include <stdarg.h>
+#include <stddef.h>
+
+#define JIT_TABLE_SIZE      (1024)                                                  // Translated blocks (power of 2)
+#define JIT_HOT             (16)                                                    // Starts before a block is translated
+#define JIT_BUFFER_SIZE     (1024*1024)                                             // Executable code buffer
+#define JIT_BLOCK_SPACE     (8192)                                                  // Most code one block can need
+#define JIT_MAX_EXITS       (BLOCK_MAX_OPS*2)                                       // Most ways out of one block
+#define JIT_RX              (16)                                                    // Register number meaning R[X]
+#define JIT_PAGE            (4096)                                                  // Host page, the unit of protection
+#define JIT_REWRITES        (8)                                                     // Pages rewritten this often aren't translated
+
+#define JIT_OFFSET(f)       ((int)offsetof(CPU1802MACHINE,f))                       // Offset of a context field from rbx
+
+typedef struct _JIT_ENTRY                                                           // 16 bytes, the dispatcher relies on it.
+{
+    int start;                                                                      // Address translated, -1 if none
+    WORD16 counted;                                                                 // Address whose starts are being counted
+    BYTE8 hits;                                                                     // and how many there have been
+    BYTE8 page;                                                                     // Page the block starts in
+    BYTE8 *code;                                                                    // Translated code
+} JITENTRY;
+
+typedef struct _JIT_EXIT
+{
+    int patch;                                                                      // Offset of the rel32 jumping here
+    int refund;                                                                     // Cycles to hand back
+    int newPC;                                                                      // Value for R[P], -1 if already there
+    BYTE8 leave;                                                                    // Back to the interpreter, not the dispatcher
+} JITEXIT;
+
+typedef struct _JIT_STATE
+{
+    JITENTRY entry[JIT_TABLE_SIZE];                                                 // Must be first, see the dispatcher
+    BYTE8 *buffer;                                                                  // Executable code buffer
+    int used;                                                                       // Bytes used in it
+    int fixed;                                                                      // Bytes used by the code below, kept on a flush
+    int dispatch,exit;                                                              // Offsets of the dispatcher and exit code
+    JITEXIT exits[JIT_MAX_EXITS];                                                   // Exits of the block being translated
+    int exitCount;
+    BYTE8 translated[256];                                                          // Pages a translated block starts or ends in
+    BYTE8 rewritten[256];                                                           // Times each has been thrown away
+} JITSTATE;
+
+typedef void (*JITENTER)(CPU1802MACHINE *cpu,BYTE8 *code,int limit);                // Entry code at the start of the buffer
+
+//*******************************************************************************************************
+//                                          Code emitters
+//*******************************************************************************************************
+
+static void CPU_JitBytes(JITSTATE *jit,int count,...)
+{
+    va_list args;
+    va_start(args,count);
+    while (count-- > 0) jit->buffer[jit->used++] = (BYTE8)va_arg(args,int);
+    va_end(args);
+}
+
+static void CPU_JitLong(JITSTATE *jit,long value)
+{
+    int n;
+    for (n = 0;n < 4;n++) jit->buffer[jit->used++] = (BYTE8)(value >> (n*8));
+}
+
+static void CPU_JitWord(JITSTATE *jit,WORD16 value)
+{
+    CPU_JitBytes(jit,2,value & 0xFF,value >> 8);
+}
+
+static void CPU_JitMemory(JITSTATE *jit,int reg,int offset)                         // ModR/M for reg,[rbx+offset]
+{
+    CPU_JitBytes(jit,1,0x83 | ((reg & 7) << 3));
+    CPU_JitLong(jit,offset);
+}
+
+static void CPU_JitRegister(JITSTATE *jit,int reg,int n,int extra)                  // ModR/M for reg,R[n] (+extra)
+{
+    if (n == JIT_RX)                                                                // [rbx+rcx*2+offset], X in ecx
+    {
+        CPU_JitBytes(jit,2,0x84 | ((reg & 7) << 3),0x4B);
+        CPU_JitLong(jit,JIT_OFFSET(R)+extra);
+    }
+    else
+        CPU_JitMemory(jit,reg,JIT_OFFSET(R)+n*2+extra);
+}
+
+static void CPU_JitSelect(JITSTATE *jit,int n)                                      // movzx ecx,X if R[X] is used
+{
+    if (n == JIT_RX) { CPU_JitBytes(jit,2,0x0F,0xB6);CPU_JitMemory(jit,1,JIT_OFFSET(X)); }
+}
+
+static void CPU_JitLoadR(JITSTATE *jit,int n)                                       // movzx eax,R[n]
+{
+    CPU_JitSelect(jit,n);
+    CPU_JitBytes(jit,2,0x0F,0xB7);
+    CPU_JitRegister(jit,0,n,0);
+}
+
+static void CPU_JitStepR(JITSTATE *jit,int n,int down)                              // inc/dec word R[n]
+{
+    CPU_JitSelect(jit,n);
+    CPU_JitBytes(jit,2,0x66,0xFF);
+    CPU_JitRegister(jit,down ? 1 : 0,n,0);
+}
+
+static void CPU_JitSetPC(JITSTATE *jit,BYTE8 p,WORD16 value)                        // mov word R[P],value
+{
+    CPU_JitBytes(jit,2,0x66,0xC7);
+    CPU_JitMemory(jit,0,JIT_OFFSET(R)+p*2);
+    CPU_JitWord(jit,value);
+}
+
+static void CPU_JitJump(JITSTATE *jit,BYTE8 code,int target)                        // jmp (code 0) or jcc rel32
+{
+    if (code == 0) CPU_JitBytes(jit,1,0xE9); else CPU_JitBytes(jit,2,0x0F,code);
+    CPU_JitLong(jit,target - (jit->used + 4));
+}
+
+static void CPU_JitPatch(JITSTATE *jit,int at,int target)                           // Point the rel32 at at to target
+{
+    long offset = target - (at + 4);
+    int n;
+    for (n = 0;n < 4;n++) jit->buffer[at+n] = (BYTE8)(offset >> (n*8));
+}
+
+static void CPU_JitExit(JITSTATE *jit,BYTE8 code,int refund,int newPC,BYTE8 leave)  // jcc to an exit added at the end
+{
+    JITEXIT *exit = jit->exits + jit->exitCount++;
+    CPU_JitBytes(jit,2,0x0F,code);
+    exit->patch = jit->used;
+    exit->refund = refund;exit->newPC = newPC;exit->leave = leave;
+    CPU_JitLong(jit,0);
+}
+
+//*******************************************************************************************************
+//     Call a C function with the context and eax (and r10d) as arguments, aligned by the entry code
+//*******************************************************************************************************
+
+static void CPU_JitCall(JITSTATE *jit,size_t function,BYTE8 withData)
+{
+    int n;
+    #ifdef _WIN32
+    if (withData) CPU_JitBytes(jit,3,0x45,0x89,0xD0);                               // mov r8d,r10d
+    CPU_JitBytes(jit,5,0x89,0xC2,0x48,0x89,0xD9);                                   // mov edx,eax ; mov rcx,rbx
+    #else
+    if (withData) CPU_JitBytes(jit,3,0x44,0x89,0xD2);                               // mov edx,r10d
+    CPU_JitBytes(jit,5,0x89,0xC6,0x48,0x89,0xDF);                                   // mov esi,eax ; mov rdi,rbx
+    #endif
+    CPU_JitBytes(jit,2,0x48,0xB8);                                                  // mov rax,function
+    for (n = 0;n < 8;n++) CPU_JitBytes(jit,1,(int)((function >> (n*8)) & 0xFF));
+    CPU_JitBytes(jit,2,0xFF,0xD0);                                                  // call rax
+}
+
+//*******************************************************************************************************
+//      Make the buffer from offset from up to to writable, to emit code, or executable, to run it.
+//*******************************************************************************************************
+
+static BOOL CPU_JitProtect(JITSTATE *jit,int from,int to,BOOL writable)
+{
+    BYTE8 *start = jit->buffer + (from & ~(JIT_PAGE-1));
+    size_t size = (size_t)(jit->buffer + to - start);
+    #ifdef _WIN32
+    DWORD old;
+    if (!VirtualProtect(start,size,writable ? PAGE_READWRITE : PAGE_EXECUTE_READ,&old)) return FALSE;
+    if (!writable) FlushInstructionCache(GetCurrentProcess(),start,size);
+    return TRUE;
+    #else
+    return mprotect(start,size,writable ? PROT_READ | PROT_WRITE : PROT_READ | PROT_EXEC) == 0;
+    #endif
+}
+
+//*******************************************************************************************************
+//        Memory access through the page tables. Address in eax, read returns the byte in eax,
+//        write stores r10b. The long way round is only taken for pages with no table entry.
+//*******************************************************************************************************
+
+static BYTE8 CPU_JitWriteSlow(CPU1802MACHINE *cpu,WORD16 address,BYTE8 data)
+{
+    BYTE8 wasCode = cpu->codePage[address >> 8];                                    // Return non zero if this
+    CPU_WriteSlow(cpu,address,data);                                                // threw away cached code.
+    return wasCode && !cpu->codePage[address >> 8];
+}
+
+static void CPU_JitAccess(JITSTATE *jit,BYTE8 isWrite)
+{
+    int skip,wide = (sizeof(unsigned long) == 8);
+    CPU_JitBytes(jit,5,0x89,0xC2,0xC1,0xEA,0x08);                                   // mov edx,eax ; shr edx,8
+    if (isWrite)                                                                    // Stamp the page (see CPU_Write())
+    {
+        CPU_JitBytes(jit,4,0x4C,0x8B,0x9C,0xD3);                                    // mov r11,[rbx+rdx*8+pageStamp]
+        CPU_JitLong(jit,JIT_OFFSET(pageStamp));
+        CPU_JitBytes(jit,2,wide ? 0x4C : 0x44,0x8B);                                // mov r9,[frameCount]
+        CPU_JitMemory(jit,1,JIT_OFFSET(frameCount));
+        CPU_JitBytes(jit,3,wide ? 0x4D : 0x45,0x89,0x0B);                           // mov [r11],r9
+    }
+    CPU_JitBytes(jit,4,0x48,0x8B,0x94,0xD3);                                        // mov rdx,[rbx+rdx*8+table]
+    CPU_JitLong(jit,isWrite ? JIT_OFFSET(writePage) : JIT_OFFSET(readPage));
+    CPU_JitBytes(jit,5,0x48,0x85,0xD2,0x74,0x00);                                   // test rdx,rdx ; jz slow
+    skip = jit->used;
+    CPU_JitBytes(jit,3,0x0F,0xB6,0xC0);                                             // movzx eax,al
+    if (isWrite)
+        CPU_JitBytes(jit,4,0x44,0x88,0x14,0x02);                                    // mov [rdx+rax],r10b
+    else
+        CPU_JitBytes(jit,4,0x0F,0xB6,0x04,0x02);                                    // movzx eax,byte [rdx+rax]
+    CPU_JitBytes(jit,2,0xEB,0x00);                                                  // jmp done
+    jit->buffer[skip-1] = (BYTE8)(jit->used - skip);
+    skip = jit->used;
+    if (isWrite)
+    {
+        CPU_JitCall(jit,(size_t)CPU_JitWriteSlow,TRUE);
+        CPU_JitBytes(jit,5,0x0F,0xB6,0xC0,0x09,0xC5);                               // movzx eax,al ; or ebp,eax
+    }
+    else
+    {
+        CPU_JitCall(jit,(size_t)CPU_ReadDecode,FALSE);
+        CPU_JitBytes(jit,3,0x0F,0xB6,0xC0);                                         // movzx eax,al
+    }
+    jit->buffer[skip-1] = (BYTE8)(jit->used - skip);
+}
+
+//*******************************************************************************************************
+//                   ALU ops, OR AND XOR and ADD SD SM with and without DF, from M(R(X)) or immediate
+//*******************************************************************************************************
+
+static void CPU_JitAlu(JITSTATE *jit,const MICROOP *op)
+{
+    BYTE8 kind = op->opCode & 7;                                                    // 1 or 2 and 3 xor 4 add 5 sd 7 sm
+    BYTE8 immediate = (op->opCode & 8) != 0;
+    long value = op->operand & 0xFF;
+    if (!immediate)                                                                 // eax = M(R(X))
+    {
+        CPU_JitLoadR(jit,JIT_RX);
+        CPU_JitAccess(jit,FALSE);
+    }
+    if (kind == 5) { CPU_JitBytes(jit,3,0x41,0x81,0xF5);CPU_JitLong(jit,0xFF); }    // SD subtracts D : xor r13d,$FF
+    if (kind == 7)                                                                  // SM subtracts the operand
+    {
+        if (immediate) value ^= 0xFF; else { CPU_JitBytes(jit,1,0x35);CPU_JitLong(jit,0xFF); }
+    }
+    kind = (kind == 1) ? 1 : (kind == 2) ? 4 : (kind == 3) ? 6 : 0;                 // x86 op group (or and xor add)
+    if (immediate)
+    {
+        CPU_JitBytes(jit,3,0x41,0x81,0xC5 | (kind << 3));                           // op r13d,value
+        CPU_JitLong(jit,value);
+    }
+    else
+        CPU_JitBytes(jit,3,0x41,0x01 | (kind << 3),0xC5);                           // op r13d,eax
+    if (kind == 0)                                                                  // Arithmetic, add carry and set DF
+    {
+        if ((op->opCode & 0xF0) == 0x70)
+            CPU_JitBytes(jit,3,0x45,0x01,0xF5);                                     // add r13d,r14d
+        else if ((op->opCode & 7) != 4)
+            CPU_JitBytes(jit,4,0x41,0x83,0xC5,0x01);                                // add r13d,1
+        CPU_JitBytes(jit,3,0x45,0x89,0xEE);                                         // mov r14d,r13d
+        CPU_JitBytes(jit,4,0x41,0xC1,0xEE,0x08);                                    // shr r14d,8
+        CPU_JitBytes(jit,4,0x45,0x0F,0xB6,0xED);                                    // movzx r13d,r13b
+    }
+}
+
+//*******************************************************************************************************
+//                  Test a condition, returning the jcc code that jumps when it is true
+//*******************************************************************************************************
+
+static BYTE8 CPU_JitTest(JITSTATE *jit,BYTE8 condition)                             // 0 IE 1 Q 2 Z 3 DF
+{
+    switch(condition)
+    {
+        case 0:
+        case 1:
+            CPU_JitBytes(jit,1,0x80);                                               // cmp byte [IE/Q],0
+            CPU_JitMemory(jit,7,(condition == 0) ? JIT_OFFSET(IE) : JIT_OFFSET(Q));
+            CPU_JitBytes(jit,1,0x00);
+            return 0x85;                                                            // jne
+        case 2:
+            CPU_JitBytes(jit,3,0x45,0x85,0xED);                                     // test r13d,r13d
+            return 0x84;                                                            // je
+    }
+    CPU_JitBytes(jit,3,0x45,0x85,0xF6);                                             // test r14d,r14d
+    return 0x85;                                                                    // jne
+}
+
+static BYTE8 CPU_JitFlag(JITSTATE *jit,BYTE8 flag,WORD16 pc)                        // EF1-EF4 via CPU_ReadEFlag()
+{
+    CPU_JitBytes(jit,1,0xB8);CPU_JitLong(jit,flag);                                 // mov eax,flag
+    CPU_JitBytes(jit,2,0x41,0xBA);CPU_JitLong(jit,pc);                              // mov r10d,pc
+    CPU_JitCall(jit,(size_t)CPU_ReadEFlag,TRUE);
+    CPU_JitBytes(jit,2,0x84,0xC0);                                                  // test al,al
+    return 0x85;                                                                    // jne
+}
+
+//*******************************************************************************************************
+//                           Ops that can be translated (see cdp1802.gen)
+//*******************************************************************************************************
+
+static BYTE8 CPU_JitTranslatable(const MICROOP *op)
+{
+    BYTE8 opCode = (BYTE8)op->opCode;
+    if (opCode == 0x00) return FALSE;                                               // IDL
+    if ((opCode & 0xF0) == 0x30 && opCode != 0x38 &&                                // Short branch to itself, left
+            (((op->address+2) & 0xFF00) | (op->operand & 0xFF)) == op->address) return FALSE; // to idle.
+    if ((opCode & 0xF4) == 0xC0 && opCode != 0xC8 &&                                // Long branch to itself.
+            op->operand == op->address) return FALSE;
+    return TRUE;
+}
+
+//*******************************************************************************************************
+//      Translate one op. p is the program counter register, refund the cycles of the ops after
+//      this one. Returns non zero if R[P] was stored before it ran, so it is right in the context.
+//*******************************************************************************************************
+
+static BYTE8 CPU_JitOp(JITSTATE *jit,const MICROOP *op,BYTE8 p,int refund,BYTE8 isLast)
+{
+    BYTE8 opCode = (BYTE8)op->opCode,n = opCode & 15,group = opCode >> 4;
+    WORD16 next = (WORD16)(op->address + op->length);                               // R[P] while it runs
+    int reg = -1;                                                                   // R register used
+    BYTE8 changesR,stored,writes = FALSE,jcc;
+
+    if (group == 0 || group == 1 || group == 2 || group == 4 || group == 5 || (group >= 8 && group <= 11))
+        reg = n;
+    if ((group == 0x7 && n < 8 && n != 6) || (group == 0xF && n < 8 && n != 6) || (group == 0x6 && n != 8) || opCode == 0x78)
+        reg = JIT_RX;
+    if (opCode == 0x79) reg = 2;                                                    // MARK pushes via R2
+    changesR = (group == 1 || group == 2 || group == 4 || group == 10 || group == 11 ||
+                                    (group == 0x6 && n < 8) || opCode == 0x72 || opCode == 0x73 || opCode == 0x79);
+    changesR = changesR && (reg == p || reg == JIT_RX);
+    stored = (reg == p || reg == JIT_RX || group == 0xD || opCode == 0x70 || opCode == 0x71);
+    if (stored) CPU_JitSetPC(jit,p,next);                                           // It might use R[P]
+
+    switch(opCode)
+    {
+        case 0x60:                                                                  // IRX
+            CPU_JitStepR(jit,JIT_RX,FALSE);
+            break;
+        case 0x70:                                                                  // RET DIS
+        case 0x71:
+            CPU_JitLoadR(jit,JIT_RX);CPU_JitAccess(jit,FALSE);
+            CPU_JitBytes(jit,3,0x41,0x89,0xC2);                                     // mov r10d,eax
+            CPU_JitStepR(jit,JIT_RX,FALSE);
+            CPU_JitBytes(jit,6,0x44,0x89,0xD0,0xC1,0xE8,0x04);                      // mov eax,r10d ; shr eax,4
+            CPU_JitBytes(jit,1,0x88);CPU_JitMemory(jit,0,JIT_OFFSET(X));            // mov [X],al
+            CPU_JitBytes(jit,4,0x41,0x83,0xE2,0x0F);                                // and r10d,15
+            CPU_JitBytes(jit,2,0x44,0x88);CPU_JitMemory(jit,2,JIT_OFFSET(P));       // mov [P],r10b
+            CPU_JitBytes(jit,1,0xC6);CPU_JitMemory(jit,0,JIT_OFFSET(IE));           // mov byte [IE],n
+            CPU_JitBytes(jit,1,opCode == 0x70);
+            break;
+        case 0x72:                                                                  // LDXA
+        case 0xF0:                                                                  // LDX
+            CPU_JitLoadR(jit,JIT_RX);CPU_JitAccess(jit,FALSE);
+            CPU_JitBytes(jit,3,0x41,0x89,0xC5);                                     // mov r13d,eax
+            if (opCode == 0x72) CPU_JitStepR(jit,JIT_RX,FALSE);
+            break;
+        case 0x73:                                                                  // STXD
+        case 0x78:                                                                  // SAV
+            CPU_JitLoadR(jit,JIT_RX);
+            if (opCode == 0x73)
+                CPU_JitBytes(jit,3,0x45,0x89,0xEA);                                 // mov r10d,r13d
+            else
+            {
+                CPU_JitBytes(jit,3,0x44,0x0F,0xB6);CPU_JitMemory(jit,2,JIT_OFFSET(T));  // movzx r10d,byte [T]
+            }
+            CPU_JitAccess(jit,TRUE);writes = TRUE;
+            if (opCode == 0x73) CPU_JitStepR(jit,JIT_RX,TRUE);
+            break;
+        case 0x76:                                                                  // RSHR
+            CPU_JitBytes(jit,6,0x44,0x89,0xE8,0x83,0xE0,0x01);                      // mov eax,r13d ; and eax,1
+            CPU_JitBytes(jit,3,0x41,0xD1,0xED);                                     // shr r13d,1
+            CPU_JitBytes(jit,4,0x41,0xC1,0xE6,0x07);                                // shl r14d,7
+            CPU_JitBytes(jit,6,0x45,0x09,0xF5,0x41,0x89,0xC6);                      // or r13d,r14d ; mov r14d,eax
+            break;
+        case 0x7A:                                                                  // REQ SEQ
+        case 0x7B:
+            CPU_JitBytes(jit,1,0xC6);CPU_JitMemory(jit,0,JIT_OFFSET(Q));            // mov byte [Q],n
+            CPU_JitBytes(jit,1,n & 1);
+            CPU_JitBytes(jit,4,0x31,0xC0,0x41,0xBA);CPU_JitLong(jit,n & 1);         // xor eax,eax ; mov r10d,n
+            CPU_JitCall(jit,(size_t)CPU_OutputHandler,TRUE);
+            break;
+        case 0x7E:                                                                  // RSHL
+            CPU_JitBytes(jit,6,0x44,0x89,0xE8,0x41,0xD1,0xE5);                      // mov eax,r13d ; shl r13d,1
+            CPU_JitBytes(jit,7,0x45,0x09,0xF5,0x45,0x0F,0xB6,0xED);                 // or r13d,r14d ; movzx r13d,r13b
+            CPU_JitBytes(jit,6,0xC1,0xE8,0x07,0x41,0x89,0xC6);                      // shr eax,7 ; mov r14d,eax
+            break;
+        case 0x79:                                                                  // MARK
+            CPU_JitBytes(jit,3,0x44,0x0F,0xB6);CPU_JitMemory(jit,2,JIT_OFFSET(X));  // movzx r10d,byte [X]
+            CPU_JitBytes(jit,8,0x41,0xC1,0xE2,0x04,0x41,0x83,0xCA,p);               // shl r10d,4 ; or r10d,P
+            CPU_JitBytes(jit,2,0x44,0x88);CPU_JitMemory(jit,2,JIT_OFFSET(T));       // mov [T],r10b
+            CPU_JitLoadR(jit,2);
+            CPU_JitAccess(jit,TRUE);writes = TRUE;
+            CPU_JitBytes(jit,1,0xC6);CPU_JitMemory(jit,0,JIT_OFFSET(X));            // mov byte [X],P
+            CPU_JitBytes(jit,1,p);
+            CPU_JitStepR(jit,2,TRUE);
+            break;
+        case 0xF6:                                                                  // SHR
+            CPU_JitBytes(jit,7,0x45,0x89,0xEE,0x41,0x83,0xE6,0x01);                 // mov r14d,r13d ; and r14d,1
+            CPU_JitBytes(jit,3,0x41,0xD1,0xED);                                     // shr r13d,1
+            break;
+        case 0xF8:                                                                  // LDI
+            CPU_JitBytes(jit,2,0x41,0xBD);CPU_JitLong(jit,op->operand & 0xFF);      // mov r13d,value
+            break;
+        case 0xFE:                                                                  // SHL
+            CPU_JitBytes(jit,7,0x45,0x89,0xEE,0x41,0xC1,0xEE,0x07);                 // mov r14d,r13d ; shr r14d,7
+            CPU_JitBytes(jit,7,0x41,0xD1,0xE5,0x45,0x0F,0xB6,0xED);                 // shl r13d,1 ; movzx r13d,r13b
+            break;
+        case 0x30:                                                                  // BR is followed by the decoder,
+        case 0x38:                                                                  // SKP, LSKP, NOP and $68 just take cycles.
+        case 0xC0:                                                                  // LBR ends the block.
+        case 0xC4:
+        case 0xC8:
+        case 0x68:
+            break;
+        default:
+            switch(group)
+            {
+                case 0x0:                                                           // LDN
+                case 0x4:                                                           // LDA
+                    CPU_JitLoadR(jit,n);CPU_JitAccess(jit,FALSE);
+                    CPU_JitBytes(jit,3,0x41,0x89,0xC5);                             // mov r13d,eax
+                    if (group == 0x4) CPU_JitStepR(jit,n,FALSE);
+                    break;
+                case 0x1:                                                           // INC
+                case 0x2:                                                           // DEC
+                    CPU_JitStepR(jit,n,group == 0x2);
+                    break;
+                case 0x5:                                                           // STR
+                    CPU_JitLoadR(jit,n);
+                    CPU_JitBytes(jit,3,0x45,0x89,0xEA);                             // mov r10d,r13d
+                    CPU_JitAccess(jit,TRUE);writes = TRUE;
+                    break;
+                case 0x8:                                                           // GLO GHI
+                case 0x9:
+                    CPU_JitBytes(jit,3,0x44,0x0F,0xB6);CPU_JitRegister(jit,5,n,group == 0x9);
+                    break;
+                case 0xA:                                                           // PLO PHI
+                case 0xB:
+                    CPU_JitBytes(jit,2,0x44,0x88);CPU_JitRegister(jit,5,n,group == 0xB);
+                    break;
+                case 0x3:                                                           // Short branches
+                    if (n & 4)                                                      // on EF1-EF4
+                        jcc = CPU_JitFlag(jit,(n & 3)+1,next) ^ ((n & 8) ? 1 : 0);
+                    else
+                        jcc = CPU_JitTest(jit,n & 3) ^ ((n & 8) ? 1 : 0);
+                    CPU_JitExit(jit,jcc,refund,(next & 0xFF00) | (op->operand & 0xFF),FALSE);
+                    break;
+                case 0xC:                                                           // Long branches and skips
+                    jcc = CPU_JitTest(jit,n & 3) ^ ((n & 8) ? 1 : 0);
+                    if (n & 4)                                                      // Skips, taken on the inverse
+                        CPU_JitExit(jit,jcc ^ 1,refund,(WORD16)(next+2),FALSE);
+                    else
+                        CPU_JitExit(jit,jcc,refund,op->operand,FALSE);
+                    break;
+                case 0x6:                                                           // OUT and INP (IRX and $68 above)
+                    if (n & 8)
+                    {
+                        CPU_JitBytes(jit,1,0xB8);CPU_JitLong(jit,n & 7);            // mov eax,port
+                        CPU_JitCall(jit,(size_t)CPU_InputHandler,FALSE);
+                        CPU_JitBytes(jit,4,0x44,0x0F,0xB6,0xE8);                    // movzx r13d,al
+                        CPU_JitBytes(jit,3,0x45,0x89,0xEA);                         // mov r10d,r13d
+                        CPU_JitLoadR(jit,JIT_RX);
+                        CPU_JitAccess(jit,TRUE);writes = TRUE;
+                    }
+                    else
+                    {
+                        CPU_JitLoadR(jit,JIT_RX);CPU_JitAccess(jit,FALSE);
+                        CPU_JitBytes(jit,3,0x41,0x89,0xC2);                         // mov r10d,eax
+                        CPU_JitBytes(jit,1,0xB8);CPU_JitLong(jit,n);                // mov eax,port
+                        CPU_JitCall(jit,(size_t)CPU_OutputHandler,TRUE);
+                        CPU_JitStepR(jit,JIT_RX,FALSE);
+                    }
+                    break;
+                case 0xD:                                                           // SEP
+                case 0xE:                                                           // SEX
+                    CPU_JitBytes(jit,1,0xC6);CPU_JitMemory(jit,0,group == 0xD ? JIT_OFFSET(P) : JIT_OFFSET(X));
+                    CPU_JitBytes(jit,1,n);
+                    break;
+                default:                                                            // ALU ops
+                    CPU_JitAlu(jit,op);
+                    break;
+            }
+            break;
+    }
+
+    if (writes)                                                                     // Wrote to cached code, leave after it
+    {
+        CPU_JitBytes(jit,2,0x85,0xED);                                              // test ebp,ebp
+        CPU_JitExit(jit,0x85,refund,stored ? -1 : next,TRUE);
+    }
+    if (changesR && !isLast)                                                        // Changed R[P] ? Leave like a branch.
+    {
+        CPU_JitBytes(jit,2,0x66,0x81);CPU_JitMemory(jit,7,JIT_OFFSET(R)+p*2);       // cmp word R[P],next
+        CPU_JitWord(jit,next);
+        CPU_JitExit(jit,0x85,refund,-1,FALSE);
+    }
+    return stored;
+}
+
+//*******************************************************************************************************
+//                           Translate the block at address, run with P as given
+//*******************************************************************************************************
+
+static BYTE8 *CPU_JitTranslate(CPU1802MACHINE *cpu,JITENTRY *entry,WORD16 address,BYTE8 p)
+{
+    JITSTATE *jit = (JITSTATE *)cpu->jit;
+    BLOCK *block = CPU_FindBlock((BLOCK *)cpu->blockCache,cpu,address);
+    int count,n,cycles,start,refund[BLOCK_MAX_OPS];
+    BYTE8 stored = FALSE;
+    const MICROOP *op;
+    WORD16 next;
+
+    count = 0;                                                                      // Ops that can be translated
+    while (count < block->count && CPU_JitTranslatable(block->op+count))            // up to the first BR or LBR, so a
+    {                                                                               // loop's head starts a translation
+        op = block->op + count++;                                                   // and the dispatcher chains it
+        if (op->opCode == 0x30 || op->opCode == 0xC0) break;                        // rather than leaving.
+    }
+    if (count == 0 || jit->rewritten[block->firstPage] >= JIT_REWRITES) return NULL; // Self modifying code isn't worth it
+    if (jit->used + JIT_BLOCK_SPACE > JIT_BUFFER_SIZE) CPU_JitFlush(jit);           // Full, start again
+    if (!CPU_JitProtect(jit,jit->used,jit->used + JIT_BLOCK_SPACE,TRUE)) return NULL;
+
+    cycles = 0;                                                                     // Cycles to hand back after each op
+    for (n = count-1;n >= 0;n--)
+    {
+        refund[n] = cycles;
+        cycles += (_decode1802[block->op[n].opCode] & DEC_EXTRACYCLE) ? 3 : 2;
+    }
+
+    start = jit->used;
+    jit->exitCount = 0;
+    CPU_JitBytes(jit,1,0x80);CPU_JitMemory(jit,7,JIT_OFFSET(P));CPU_JitBytes(jit,1,p);  // cmp byte [P],p
+    CPU_JitJump(jit,0x85,jit->exit);                                                // jne exit
+    CPU_JitBytes(jit,3,0x41,0x8D,0x87);CPU_JitLong(jit,-cycles);                    // lea eax,[r15-cycles]
+    CPU_JitBytes(jit,3,0x44,0x39,0xE0);                                             // cmp eax,r12d
+    CPU_JitJump(jit,0x8C,jit->exit);                                                // jl exit
+    CPU_JitBytes(jit,3,0x41,0x89,0xC7);                                             // mov r15d,eax
+
+    for (n = 0,op = block->op;n < count;n++,op++)
+        stored = CPU_JitOp(jit,op,p,refund[n],n == count-1);
+    op--;
+    next = (WORD16)(op->address + op->length);                                      // Where the last op goes
+    if (op->opCode == 0x30) next = (next & 0xFF00) | (op->operand & 0xFF);
+    if (op->opCode == 0xC0) next = op->operand;
+    if (!stored) CPU_JitSetPC(jit,p,next);
+    CPU_JitJump(jit,0,next == address ? start : jit->dispatch);                     // A loop goes straight round
+
+    for (n = 0;n < jit->exitCount;n++)                                              // Then the ways out
+    {
+        CPU_JitPatch(jit,jit->exits[n].patch,jit->used);
+        if (jit->exits[n].newPC >= 0) CPU_JitSetPC(jit,p,(WORD16)jit->exits[n].newPC);
+        if (jit->exits[n].refund != 0)
+        {
+            CPU_JitBytes(jit,3,0x41,0x81,0xC7);CPU_JitLong(jit,jit->exits[n].refund);   // add r15d,refund
+        }
+        CPU_JitJump(jit,0,jit->exits[n].leave ? jit->exit : jit->dispatch);
+    }
+
+    entry->start = address;
+    entry->page = address >> 8;
+    if (!CPU_JitProtect(jit,start,start + JIT_BLOCK_SPACE,FALSE)) return NULL;     // Runnable, entry not set if not
+    entry->code = jit->buffer + start;
+    jit->translated[block->firstPage] = jit->translated[block->lastPage] = TRUE;
+    return entry->code;
+}
+
+//*******************************************************************************************************
+//      Find the translated code for address, counting starts and translating it when it gets hot.
+//*******************************************************************************************************
+
+static inline BYTE8 *CPU_JitFind(CPU1802MACHINE *cpu,WORD16 address,BYTE8 p)
+{
+    JITENTRY *entry = ((JITSTATE *)cpu->jit)->entry + (address & (JIT_TABLE_SIZE-1));
+    if (entry->start == address) return entry->code;
+    if (entry->counted != address) { entry->counted = address;entry->hits = 0; }
+    if (entry->hits < JIT_HOT && ++entry->hits == JIT_HOT) return CPU_JitTranslate(cpu,entry,address,p);
+    return NULL;
+}
+
+//*******************************************************************************************************
+//                                  Run translated code from code
+//*******************************************************************************************************
+
+static void CPU_JitRun(CPU1802MACHINE *cpu,BYTE8 *code,INT16 limit)
+{
+    ((JITENTER)(void *)((JITSTATE *)cpu->jit)->buffer)(cpu,code,limit);
+}
+
+//*******************************************************************************************************
+//          Forget all translations, or those in a page (a block may run on into the next page)
+//*******************************************************************************************************
+
+static void CPU_JitFlush(JITSTATE *jit)
+{
+    int n;
+    for (n = 0;n < JIT_TABLE_SIZE;n++) { jit->entry[n].start = -1;jit->entry[n].hits = 0; }
+    memset(jit->translated,0,sizeof(jit->translated));
+    jit->used = jit->fixed;
+}
+
+static void CPU_JitInvalidatePage(CPU1802MACHINE *cpu,BYTE8 page)
+{
+    JITSTATE *jit = (JITSTATE *)cpu->jit;
+    JITENTRY *entry;
+    int n;
+    if (!jit->translated[page]) return;                                             // Nothing there to forget
+    for (n = 0;n < 512;n++)                                                         // Entries for this page and the one before
+    {
+        entry = jit->entry + (((((page+255) << 8) + n) & 0xFFFF) & (JIT_TABLE_SIZE-1));
+        if (entry->start >= 0 && (BYTE8)(page - entry->page) <= 1) { entry->start = -1;entry->hits = 0; }
+    }
+    jit->translated[page] = FALSE;
+    if (jit->rewritten[page] < JIT_REWRITES) jit->rewritten[page]++;
+}
+
+//*******************************************************************************************************
+//          Create the translator, with the entry, dispatch and exit code at the buffer start
+//*******************************************************************************************************
+
+static JITSTATE *CPU_JitCreate(void)
+{
+    JITSTATE *jit = (JITSTATE *)calloc(1,sizeof(JITSTATE));
+    if (jit == NULL) return NULL;
+    #ifdef _WIN32
+    jit->buffer = (BYTE8 *)VirtualAlloc(NULL,JIT_BUFFER_SIZE,MEM_COMMIT | MEM_RESERVE,PAGE_READWRITE);
+    #else
+    jit->buffer = (BYTE8 *)mmap(NULL,JIT_BUFFER_SIZE,PROT_READ | PROT_WRITE,MAP_PRIVATE | MAP_ANONYMOUS,-1,0);
+    if (jit->buffer == MAP_FAILED) jit->buffer = NULL;
+    #endif
+    if (jit->buffer == NULL) { free(jit);return NULL; }
+
+    CPU_JitBytes(jit,10,0x53,0x55,0x41,0x54,0x41,0x55,0x41,0x56,0x41,0x57);         // push rbx rbp r12 r13 r14 r15
+    CPU_JitBytes(jit,4,0x48,0x83,0xEC,0x28);                                        // sub rsp,40 (aligns, and shadow space)
+    #ifdef _WIN32
+    CPU_JitBytes(jit,6,0x48,0x89,0xCB,0x45,0x89,0xC4);                              // mov rbx,rcx ; mov r12d,r8d
+    #else
+    CPU_JitBytes(jit,6,0x48,0x89,0xFB,0x41,0x89,0xD4);                              // mov rbx,rdi ; mov r12d,edx
+    #endif
+    CPU_JitBytes(jit,3,0x44,0x0F,0xB6);CPU_JitMemory(jit,5,JIT_OFFSET(D));          // movzx r13d,byte [D]
+    CPU_JitBytes(jit,3,0x44,0x0F,0xB6);CPU_JitMemory(jit,6,JIT_OFFSET(DF));         // movzx r14d,byte [DF]
+    CPU_JitBytes(jit,3,0x44,0x0F,0xBF);CPU_JitMemory(jit,7,JIT_OFFSET(Cycles));     // movsx r15d,word [Cycles]
+    CPU_JitBytes(jit,2,0x31,0xED);                                                  // xor ebp,ebp
+    #ifdef _WIN32
+    CPU_JitBytes(jit,2,0xFF,0xE2);                                                  // jmp rdx
+    #else
+    CPU_JitBytes(jit,2,0xFF,0xE6);                                                  // jmp rsi
+    #endif
+
+    jit->dispatch = jit->used;                                                      // Dispatcher, go to the code for R[P]
+    CPU_JitBytes(jit,2,0x0F,0xB6);CPU_JitMemory(jit,1,JIT_OFFSET(P));               // movzx ecx,byte [P]
+    CPU_JitBytes(jit,2,0x0F,0xB7);CPU_JitRegister(jit,0,JIT_RX,0);                  // movzx eax,word [rbx+rcx*2+R]
+    CPU_JitBytes(jit,2,0x48,0x8B);CPU_JitMemory(jit,2,JIT_OFFSET(jit));             // mov rdx,[jit]
+    CPU_JitBytes(jit,4,0x89,0xC1,0x81,0xE1);CPU_JitLong(jit,JIT_TABLE_SIZE-1);      // mov ecx,eax ; and ecx,mask
+    CPU_JitBytes(jit,6,0xC1,0xE1,0x04,0x39,0x04,0x0A);                              // shl ecx,4 ; cmp [rdx+rcx],eax
+    jit->exit = jit->used + 6 + 4;
+    CPU_JitJump(jit,0x85,jit->exit);                                                // jne exit
+    CPU_JitBytes(jit,4,0xFF,0x64,0x0A,0x08);                                        // jmp [rdx+rcx+8]
+
+    CPU_JitBytes(jit,2,0x44,0x88);CPU_JitMemory(jit,5,JIT_OFFSET(D));               // Exit. mov [D],r13b
+    CPU_JitBytes(jit,2,0x44,0x88);CPU_JitMemory(jit,6,JIT_OFFSET(DF));              // mov [DF],r14b
+    CPU_JitBytes(jit,3,0x66,0x44,0x89);CPU_JitMemory(jit,7,JIT_OFFSET(Cycles));     // mov [Cycles],r15w
+    CPU_JitBytes(jit,4,0x48,0x83,0xC4,0x28);                                        // add rsp,40
+    CPU_JitBytes(jit,11,0x41,0x5F,0x41,0x5E,0x41,0x5D,0x41,0x5C,0x5D,0x5B,0xC3);    // pop r15 r14 r13 r12 rbp rbx ; ret
+
+    jit->fixed = jit->used;
+    CPU_JitFlush(jit);
+    if (!CPU_JitProtect(jit,0,JIT_BUFFER_SIZE,FALSE)) { CPU_JitDestroy(jit);return NULL; }
+    return jit;
+}
+
+static void CPU_JitDestroy(JITSTATE *jit)
+{
+    if (jit == NULL) return;
+    #ifdef _WIN32
+    VirtualFree(jit->buffer,0,MEM_RELEASE);
+    #else
+    munmap(jit->buffer,JIT_BUFFER_SIZE);
+    #endif
+    free(jit);
+}
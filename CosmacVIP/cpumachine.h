@@ -0,0 +1,1298 @@
+//*******************************************************************************************************
+//*******************************************************************************************************
+//
+//      Name:       CpuMachine.H
+//      Purpose:    1802 Processor Emulation for one machine (included by the core*.c files)
+//      Author:     Paul Robson
+//      Date:       24th February 2013
+//
+//*******************************************************************************************************
+//*******************************************************************************************************
+
+#include <stdlib.h>
+#include <string.h>
+#include "general.h"
+#include "cpu.h"
+#include "system.h"
+
+// Each of coreelf.c, corevip.c and corestudio2.c defines IS_ELF, IS_COSMACVIP or IS_STUDIO2 and
+// CPU_CORE, then includes this. Everything that differs between the machines, the memory map, the EF
+// lines and the I/O ports, is chosen here by the preprocessor, so each core is compiled for its own
+// machine and never tests which machine it is while running. Only CPU_CORE is seen outside, cpu.c
+// picks one when a machine is created and calls through it.
+
+#ifdef IS_ELF                                                                       // Features the machine has no use for
+#undef STATIC_ROM                                                                   // No ROM to compile on the Elf
+#undef ROUTINE_HOOKS
+#endif
+#ifndef IS_COSMACVIP
+#undef CHIP8_HLE
+#endif
+#ifndef IS_STUDIO2
+#undef STUDIO2_HLE
+#endif
+
+#ifdef IS_ELF
+#define CORE_MACHINE        MACHINE_ELF                                             // Machine this core is for
+#endif
+#ifdef IS_COSMACVIP
+#define CORE_MACHINE        MACHINE_COSMACVIP
+#endif
+#ifdef IS_STUDIO2
+#define CORE_MACHINE        MACHINE_STUDIO2
+#endif
+
+extern const CPU1802CORE CPU_CORE;
+
+#include "macros1802.h"
+
+#define CLOCK_SPEED             (3521280/2)                                         // Clock Frequency (1,760,640Hz)
+#define CYCLES_PER_SECOND       (CLOCK_SPEED/8)                                     // There are 8 clocks in each cycle (220,080 Cycles/Second)
+#define FRAMES_PER_SECOND       (60)                                                // NTSC Frames Per Second
+#define LINES_PER_FRAME         (262)                                               // Lines Per NTSC Frame
+#define CYCLES_PER_FRAME        (CYCLES_PER_SECOND/FRAMES_PER_SECOND)               // Cycles per Frame, Complete (3668)
+#define CYCLES_PER_LINE         (CYCLES_PER_FRAME/LINES_PER_FRAME)                  // Cycles per Display Line (14)
+
+#define VISIBLE_LINES           (128)                                               // 128 visible lines per frame
+#define NON_DISPLAY_LINES       (LINES_PER_FRAME-VISIBLE_LINES)                     // Number of non-display lines per frame. (134)
+#define EXEC_CYCLES_PER_FRAME   (NON_DISPLAY_LINES*CYCLES_PER_LINE)                 // Cycles where 1802 not generating video per frame (1876)
+
+// Note: this means that there are 1876*60/2 approximately instructions per second, about 56,280. With an instruction rate of
+// approx 8m per second, this means each instruction is limited to 8,000,000 / 56,280 * (128/312.5) about 58 AVR instructions for each
+// 1802 instructions.
+
+static void CPU_CoreReset(CPU1802MACHINE *cpu,BYTE8 *ramMemoryAddress,WORD16 ramSize);
+static void CPU_BuildMemoryMap(CPU1802MACHINE *cpu);
+static BYTE8 CPU_ReadDecode(CPU1802MACHINE *cpu,WORD16 address);
+static void CPU_WriteDecode(CPU1802MACHINE *cpu,WORD16 address,BYTE8 data);
+static void CPU_WriteSlow(CPU1802MACHINE *cpu,WORD16 address,BYTE8 data);
+
+#ifdef JIT_X86_64
+struct _JIT_STATE;
+static void CPU_JitFlush(struct _JIT_STATE *jit);
+static void CPU_JitDestroy(struct _JIT_STATE *jit);
+static void CPU_JitInvalidatePage(CPU1802MACHINE *cpu,BYTE8 page);
+#endif
+
+// Each frame the 1861 does not display for 1876 cycles, then fetches 128 lines of 8 bytes by DMA from
+// where R0 points, R0 moving on with each byte. The DMA takes 8 of each line's 14 cycles, the 1802
+// runs for the other 6. Cycles only counts the 1802's own cycles, so a frame is 1876 + 128 * 6 of
+// them. Whether the display is on is looked at when it starts, if it is off there is no DMA and the
+// lines are 14 cycles each, so turning it on or off part way through a frame counts from the next.
+// INT comes 29 cycles before the display if it is on, and EF1 is set for the 4 lines before it and
+// its last 4 lines. Each line's DMA comes 2 of the 1802's cycles into it, which is where the VIP
+// monitor's interrupt routine expects it, however late the interrupt is taken.
+//
+// Run faster (see CPU_SetClock()) the 1802 gets a whole frame's cycles more for each multiple, added
+// to the time before the display. The display itself, with the interrupt and EF1 round it, takes the
+// same cycles as ever, so the interrupt routines that count cycles to it still work, and the frames,
+// and the timers counted by them, stay at 60Hz.
+//
+// State 1 : till the interrupt
+// State 2 : from the interrupt to the end of the display
+
+#define NON_DISPLAY_CYCLES      (EXEC_CYCLES_PER_FRAME)                             // Cycles before the display starts
+#define INTERRUPT_CYCLES        (29)                                                // INT this long before it,
+#define EF1_CYCLES              (4*CYCLES_PER_LINE)                                 // EF1 this long before it,
+#define EF1_LINE                (CPU_DISPLAY_LINES-4)                               // and again from this line on.
+#define DMA_LINE_CYCLES         (CYCLES_PER_LINE-CPU_DISPLAY_BYTES)                 // 1802 cycles in a line with DMA (6)
+#define DMA_DELAY               (2)                                                 // 1802 cycles into the line its DMA comes
+
+#define EVENT_EF1               (0)                                                 // Events (see cpuevents.h), in the order
+#define EVENT_INTERRUPT         (1)                                                 // they run when due on the same cycle.
+#define EVENT_DISPLAY           (2)
+#define EVENT_DISPLAY_END       (3)
+#define EVENT_SYNC              (4)
+#define EVENT_KEYPAD            (5)
+
+#include "cpuevents.h"
+
+//*******************************************************************************************************
+//      Schedule the 1861 for the frame after a display (or a reset) ends at cycle end, the 1802
+//      running for as many more whole frames as its clock is faster first
+//*******************************************************************************************************
+
+static void CPU_ScheduleFrame(CPU1802MACHINE *cpu,unsigned long end)
+{
+    unsigned long display = end + NON_DISPLAY_CYCLES + (cpu->clockMultiplier - 1) * (unsigned long)CYCLES_PER_FRAME;
+    CPU_ScheduleEvent(cpu,EVENT_EF1,display-EF1_CYCLES);
+    CPU_ScheduleEvent(cpu,EVENT_INTERRUPT,display-INTERRUPT_CYCLES);
+    CPU_ScheduleEvent(cpu,EVENT_DISPLAY,display);
+}
+
+#ifdef BLOCK_CACHE
+
+//*******************************************************************************************************
+//      Block cache. Code is decoded once into micro-ops with the operands already fetched, running on
+//      through conditional branches and short branches within the page, up to an instruction that
+//      changes P or leaves the page, then a BLOCK_END op. Each op has its address, so the core leaves
+//      the block if R[P] is not where the next op expects (e.g. a branch was taken), BLOCK_END has an
+//      address R[P] can never have. Pages holding cached code have no write table entry, so writes
+//      to them end up in CPU_WriteSlow(), which throws away every block on that page if the byte is
+//      code. This sets the addresses in those blocks to -1 as well, so a block that changes its own
+//      code stops at once.
+//*******************************************************************************************************
+
+#define BLOCK_CACHE_SIZE    (1024)                                                  // Number of blocks (power of 2)
+#define BLOCK_MAX_OPS       (16)                                                    // Most ops in a block
+#define BLOCK_END           (256)                                                   // Op code ending every block
+
+#define DEC_OPERANDS        (0x03)                                                  // Bits in _decode1802[] (see process.py)
+#define DEC_EXTRACYCLE      (0x04)
+#define DEC_NEWP            (0x08)
+#define DEC_WRITES          (0x10)
+
+typedef struct _MICRO_OP
+{
+    WORD16 opCode;                                                                  // 1802 op code or BLOCK_END
+    WORD16 operand;                                                                 // Immediate byte or long address
+    int address;                                                                    // Where the instruction is
+    BYTE8 length;                                                                   // Bytes the instruction takes up
+    BYTE8 refund;                                                                   // Fetch cycles of this and later ops
+} MICROOP;
+
+typedef struct _BLOCK
+{
+    int start;                                                                      // Address of first instruction, -1 if not used
+    BYTE8 count;                                                                    // Number of ops
+    BYTE8 fetchCycles;                                                              // Fetch cycles for the whole block
+    INT16 cycles;                                                                   // All cycles for the whole block
+    BYTE8 firstPage,lastPage;                                                       // Pages the code is in
+    MICROOP op[BLOCK_MAX_OPS+1];                                                    // Instructions then BLOCK_END
+} BLOCK;
+
+static const BYTE8 _decode1802[256] = {
+    #include "cpu1802decode.h"
+};
+
+#define BLOCK_CACHE_BYTES   (BLOCK_CACHE_SIZE * sizeof(BLOCK))
+#else
+#define BLOCK_CACHE_BYTES   (0)
+#endif
+
+#ifdef STATIC_ROM
+#define STATIC_UNCHECKED    (0)                                                     // Values of staticRam (see CPU_StaticVerify())
+#define STATIC_VALID        (1)
+#define STATIC_STALE        (2)
+#endif
+
+#ifdef CHIP8_HLE
+#define CHIP8_UNCHECKED     (0)                                                     // Values of chip8Code (see cpuchip8.h)
+#define CHIP8_VALID         (1)
+#define CHIP8_STALE         (2)
+#endif
+
+#ifdef ROUTINE_HOOKS
+#define HOOK_UNCHECKED      (0)                                                     // Values of hookCode (see cpuhooks.h)
+#define HOOK_VALID          (1)
+#define HOOK_STALE          (2)
+#endif
+
+//*******************************************************************************************************
+//              Create a machine with its own RAM, in one cache aligned zeroed block
+//*******************************************************************************************************
+
+static CPU1802MACHINE *CPU_CoreCreate(WORD16 ramSize)
+{
+    BYTE8 *block = (BYTE8 *)calloc(1,sizeof(CPU1802MACHINE)+64+BLOCK_CACHE_BYTES+ramSize);  // Machine, alignment slack, blocks and RAM
+    CPU1802MACHINE *cpu;
+    if (block == NULL) return NULL;
+    cpu = (CPU1802MACHINE *)(block + (64 - ((size_t)block & 63)) % 64);             // Align the context to a cache line
+    cpu->allocation = block;                                                        // Remember what to free
+    cpu->core = &CPU_CORE;                                                          // and the core that runs it
+    cpu->clockMultiplier = 1;                                                       // at its own speed
+    #ifdef BLOCK_CACHE
+    cpu->blockCache = cpu+1;                                                        // Block cache follows the context
+    #endif
+    CPU_CoreReset(cpu,(BYTE8 *)(cpu+1)+BLOCK_CACHE_BYTES,ramSize);                  // then the RAM
+    return cpu;
+}
+
+//*******************************************************************************************************
+//                                      Release a created machine
+//*******************************************************************************************************
+
+static void CPU_CoreDestroy(CPU1802MACHINE *cpu)
+{
+    if (cpu == NULL) return;
+    #ifdef JIT_X86_64
+    CPU_JitDestroy((struct _JIT_STATE *)cpu->jit);                                  // Translator is allocated separately
+    #endif
+    free(cpu->allocation);
+}
+
+//*******************************************************************************************************
+//                          Reset the 1802 and System Handlers
+//*******************************************************************************************************
+
+static void CPU_CoreReset(CPU1802MACHINE *cpu,BYTE8 *ramMemoryAddress,WORD16 ramSize)
+{
+    if (ramMemoryAddress != NULL)                                                   // If RAM not yet allocated
+    {
+        cpu->ramMemorySize = ramSize;                                               // Remember size
+        cpu->ramMemory = ramMemoryAddress;                                          // Remember address
+        cpu->ramMask = 1;                                                           // Calculate the RAM mask.
+        while (cpu->ramMask < cpu->ramMemorySize) cpu->ramMask = cpu->ramMask << 1;
+        cpu->ramMask--;                                                             // From (say) $2000 to $1FFF
+        CPU_BuildMemoryMap(cpu);                                                    // Set up the page tables
+    }
+
+    cpu->X = cpu->P = cpu->Q = cpu->R[0] = 0;                                       // Reset 1802 - Clear X,P,Q,R0
+    cpu->IE = 1;                                                                    // Set IE to 1
+    cpu->DF = cpu->DF & 1;                                                          // Make DF a valid value as it is 1-bit.
+
+    cpu->State = 1;                                                                 // State 1
+    cpu->ef1 = cpu->dmaIdle = FALSE;                                                // Not displaying
+    cpu->dmaLine = CPU_DISPLAY_LINES;
+    CPU_ResetEvents(cpu);                                                           // Start as if a display has just ended
+    CPU_ScheduleFrame(cpu,0);
+    cpu->screenEnabled = FALSE;
+    cpu->displayChanged = cpu->frameCount;                                          // Display off, so changed
+
+    #ifdef IS_COSMACVIP                                                             // On VIP the Monitor ROM is put at $0000 on reset.
+    cpu->D = 8;                                                                     // Fix up to run Monitor ROM
+    cpu->R[0] = 0x0008;                                                             // Avoids implementation of U6A
+    cpu->P = 2;                                                                     // (see boot.ods)
+    cpu->R[2] = 0x800A;                                                             // This is the system status at
+    cpu->X = 2;                                                                     // $800A
+    #endif
+}
+
+//*******************************************************************************************************
+//                                 Macros to Read/Write memory
+//*******************************************************************************************************
+
+#define READ(a)     CPU_Read(cpu,a)
+#define WRITE(a,d)  CPU_Write(cpu,a,d)
+
+//*******************************************************************************************************
+//   Macros for fetching 1 + 2 BYTE8 operands, Note 2 BYTE8 fetch stores in _temp, 1 BYTE8 returns value
+//*******************************************************************************************************
+
+#define FETCH2()    (CPU_Read(cpu,R[P]++))
+#define FETCH3()    { _temp = CPU_Read(cpu,R[P]++);_temp = (_temp << 8) | CPU_Read(cpu,R[P]++); }
+
+//*******************************************************************************************************
+//      Idling, IDL or a branch to itself, which will run again until something outside changes it.
+//      Single steps just run it, the run loops skip ahead to the end of the cycles (see cpucore.h).
+//*******************************************************************************************************
+
+#define IDLE_SKIPS      (0)                                                         // so branches don't look for it
+#define IDLE(n)         ((void)0)
+
+//*******************************************************************************************************
+//                      Macros translating Hardware I/O to hardwareHandler calls
+//*******************************************************************************************************
+
+#define READEFLAG(n)    CPU_ReadEFlag(cpu,n,R[P])
+#define UPDATEIO(p,d)   CPU_OutputHandler(cpu,p,d)
+#define INPUTIO(p)      CPU_InputHandler(cpu,p)
+
+static BYTE8 CPU_ReadEFlag(CPU1802MACHINE *cpu,BYTE8 flag,WORD16 pc)
+{
+    BYTE8 retVal = 0;
+    (void)pc;                                                                       // Only COSMAC_BOOTS_MONITOR looks at it
+    switch (flag)
+    {
+        case 1:                                                                     // EF1 is set round the display's ends
+            retVal = cpu->ef1;                                                      // (see CPU_EventEF1())
+            break;
+        case 3:                                                                     // EF3 detects keypressed on VIP and Elf but differently.
+            #ifdef IS_COSMACVIP
+            retVal = SYSTEM_Command(HWC_READKEYBOARD,cpu->keyboardLatch);           // Read the keystroke - if down return 1.
+            #ifdef COSMAC_BOOTS_MONITOR
+            if (pc == 0x8024 && cpu->keyboardLatch == 0x0C) retVal = 1;             // Fudges the monitor to run whatever you do.
+            #endif
+            #endif
+            #ifdef IS_ELF
+            retVal = (cpu->currentKey != 0xFF);                                     // ELF : Any key down
+            #endif // IS_ELF
+            #ifdef IS_STUDIO2
+            SYSTEM_Command(HWC_SETKEYPAD,1);
+            retVal = SYSTEM_Command(HWC_READKEYBOARD,cpu->keyboardLatch);
+            #endif
+            break;
+        case 4:                                                                     // EF4 is !IN Button
+            #ifdef IS_ELF
+            retVal = (SYSTEM_Command(HWC_READIKEY,0) != 0) ? 0 : 1;                 // Return 0 if I is pressed, 1 otherwise.
+            #endif
+            #ifdef IS_STUDIO2
+            SYSTEM_Command(HWC_SETKEYPAD,2);
+            retVal = SYSTEM_Command(HWC_READKEYBOARD,cpu->keyboardLatch);
+            #endif
+            break;
+            break;
+    }
+    return retVal;
+}
+
+static BYTE8 CPU_InputHandler(CPU1802MACHINE *cpu,BYTE8 portID)
+{
+    BYTE8 retVal = 0;
+    switch (portID)
+    {
+        case 1:                                                                     // IN 1 turns the display on.
+            if (!cpu->screenEnabled) cpu->displayChanged = cpu->frameCount;
+            cpu->screenEnabled = TRUE;
+            break;
+        case 4:                                                                     // IN 4 reads the keypad latch on the ELF
+            #ifdef IS_ELF
+            retVal = cpu->keyboardLatch;
+            #endif // IS_ELF
+            break;
+    }
+    return retVal;
+}
+
+static void CPU_OutputHandler(CPU1802MACHINE *cpu,BYTE8 portID,BYTE8 data)
+{
+    switch (portID)
+    {
+        case 0:                                                                     // Called with 0 to set Q
+            SYSTEM_Command(HWC_UPDATEQ,data);                                       // Update Q Flag via HW Handler
+            break;
+        case 1:                                                                     // OUT 1 turns the display off
+            if (cpu->screenEnabled) cpu->displayChanged = cpu->frameCount;
+            cpu->screenEnabled = FALSE;
+            break;
+        case 2:                                                                     // OUT 2 sets the keyboard latch (both S2 & VIP)
+            #ifdef IS_COSMACVIP
+            cpu->keyboardLatch = data & 0x0F;                                       // Lower 4 bits only :)
+            #endif
+            #ifdef IS_STUDIO2
+            cpu->keyboardLatch = data & 0x0F;                                       // Lower 4 bits only :)
+            #endif
+            break;
+        case 4:                                                                     // OUT 4 sets the LED Display (ELF)
+            #ifdef IS_ELF
+            SYSTEM_Command(HWC_UPDATELED,data);
+            #endif
+            break;
+    }
+}
+
+//*******************************************************************************************************
+//                                              Monitor ROM
+//*******************************************************************************************************
+
+#ifndef ARDUINO_VERSION                                                             // if not Arduino
+#define PROGMEM                                                                     // fix usage of PROGMEM and prog_char
+#define prog_uchar BYTE8
+#endif // ARDUINO_VERSION
+
+#ifdef IS_COSMACVIP
+#include "monitor_rom.h"                                                            // Stock monitor ROM image (almost)
+#define MONITOR_SIZE        (512)                                                   // and size
+#endif
+
+// Note the stock monitor rom is modified slightly. Location $801B is changed from SMI 4 to SMI 1. The
+// function of this change is to allow memory units not in 1k blocks, e.g. the original monitor checks
+// $Fxx,$Bxx,$7xx,$3xx whereas this modified one checks $Fxx,$Exx,$Dxx etc. so we can use the roughly
+// 1.5k RAM available on a 328 based Arduino.
+
+#ifdef IS_STUDIO2                                                                   // Basic ROM and Games for Studio 2.
+#include "studio2_rom.h"
+#define MONITOR_SIZE        (2048)
+#endif
+
+//*******************************************************************************************************
+//      Memory map descriptions. Addresses are first masked with ADDRESS_MASK (0 means use the RAM
+//      mask) then looked up in the region list, anything not in a region reads as OPEN_BUS.
+//*******************************************************************************************************
+
+#define MAP_END     (0)                                                             // End of region list
+#define MAP_RAM     (1)                                                             // RAM, no bigger than the RAM given to CPU_Reset()
+#define MAP_ROM     (2)                                                             // Read only image
+
+typedef struct _MEMORY_REGION
+{
+    BYTE8 type;                                                                     // MAP_ type
+    WORD16 start;                                                                   // First address (after masking)
+    WORD16 size;                                                                    // Size in bytes
+    BYTE8 *image;                                                                   // ROM image
+} MEMORYREGION;
+
+#ifdef IS_COSMACVIP
+#define ADDRESS_MASK    (0xFFFF)
+#define OPEN_BUS        (0x00)
+static const MEMORYREGION memoryMap[] = {
+    { MAP_RAM,0x0000,0x8000,NULL },                                                 // RAM from $0000 up
+    { MAP_ROM,0x8000,MONITOR_SIZE,_monitor },                                       // Monitor at $8000
+    { MAP_END,0,0,NULL }
+};
+#endif
+
+#ifdef IS_ELF
+#define ADDRESS_MASK    (0)                                                         // RAM repeats through the address space
+#define OPEN_BUS        (0x00)
+static const MEMORYREGION memoryMap[] = {
+    { MAP_RAM,0x0000,0xFFFF,NULL },
+    { MAP_END,0,0,NULL }
+};
+#endif
+
+#ifdef IS_STUDIO2
+#define ADDRESS_MASK    (0x0FFF)                                                    // Only 12 address lines decoded
+#define OPEN_BUS        (0xFF)
+static const MEMORYREGION memoryMap[] = {
+    { MAP_ROM,0x0000,MONITOR_SIZE,_studio2 },                                       // BIOS and games $000-$7FF
+    { MAP_RAM,0x0800,0x0200,NULL },                                                 // 512 bytes RAM $800-$9FF
+    { MAP_END,0,0,NULL }
+};
+#endif
+
+//*******************************************************************************************************
+//      Build the read and write page tables. Each of the 256 pages points straight at the host memory
+//      behind it. Pages that are not decoded read from an open bus page and write to a discard page,
+//      pages that only partly map (or ROM the host cannot address directly) are NULL, which makes
+//      every access to them go through CPU_ReadDecode() / CPU_WriteDecode().
+//*******************************************************************************************************
+
+static void CPU_BuildMemoryMap(CPU1802MACHINE *cpu)
+{
+    int page;
+    long address,size;
+    WORD16 mask = (ADDRESS_MASK != 0) ? ADDRESS_MASK : cpu->ramMask;
+    const MEMORYREGION *region;
+    #ifdef BLOCK_CACHE
+    BLOCK *block = (BLOCK *)cpu->blockCache;
+    int n;
+    #endif
+    memset(cpu->openBus,OPEN_BUS,sizeof(cpu->openBus));
+    for (page = 0;page < 256;page++)
+    {
+        address = (page << 8) & mask;                                               // Where this page decodes to
+        cpu->pageStamp[page] = &cpu->pageWritten[address >> 8];
+        cpu->readPage[page] = cpu->openBus;                                         // Not decoded by default
+        cpu->writePage[page] = cpu->discard;
+        if ((mask & 0xFF) != 0xFF)                                                  // Page not contiguous after masking
+        {
+            cpu->readPage[page] = cpu->writePage[page] = NULL;
+            continue;
+        }
+        for (region = memoryMap;region->type != MAP_END;region++)
+        {
+            size = region->size;
+            if (region->type == MAP_RAM && size > cpu->ramMemorySize) size = cpu->ramMemorySize;
+            if (address+256 <= region->start || address >= region->start+size) continue;
+            if (address < region->start || address+256 > region->start+size)        // Only partly in this region.
+            {
+                cpu->readPage[page] = cpu->writePage[page] = NULL;
+                break;
+            }
+            if (region->type == MAP_RAM)                                            // RAM page, read and write.
+            {
+                cpu->readPage[page] = cpu->writePage[page] = cpu->ramMemory + (address - region->start);
+            }
+            else                                                                    // ROM page, read only.
+            {
+                cpu->readPage[page] = region->image + (address - region->start);
+                #ifdef ARDUINO_VERSION
+                cpu->readPage[page] = NULL;                                         // ROM is in PROGMEM, not addressable.
+                #endif
+            }
+            break;
+        }
+    }
+    #ifdef BLOCK_CACHE
+    memset(cpu->codePage,0,sizeof(cpu->codePage));                                  // Nothing cached yet
+    memset(cpu->codeMap,0,sizeof(cpu->codeMap));
+    #ifdef STATIC_ROM
+    cpu->staticRam = STATIC_UNCHECKED;
+    #endif
+    #ifdef CHIP8_HLE
+    cpu->chip8Code = CHIP8_UNCHECKED;
+    #endif
+    #ifdef ROUTINE_HOOKS
+    memset(cpu->hookCode,HOOK_UNCHECKED,sizeof(cpu->hookCode));
+    #endif
+    for (n = 0;block != NULL && n < BLOCK_CACHE_SIZE;n++) block[n].start = -1;
+    #endif
+    #ifdef JIT_X86_64
+    if (cpu->jit != NULL) CPU_JitFlush((struct _JIT_STATE *)cpu->jit);              // and nothing translated
+    #endif
+}
+
+//*******************************************************************************************************
+//                                        Read a BYTE8 in memory
+//*******************************************************************************************************
+
+static inline BYTE8 CPU_Read(CPU1802MACHINE *cpu,WORD16 address)
+{
+    BYTE8 *page = cpu->readPage[address >> 8];
+    return (page != NULL) ? page[address & 0xFF] : CPU_ReadDecode(cpu,address);
+}
+
+static BYTE8 CPU_CoreReadMemory(CPU1802MACHINE *cpu,WORD16 address)
+{
+    return CPU_Read(cpu,address);
+}
+
+//*******************************************************************************************************
+//      Write a BYTE8 in memory. Every write stamps its page with the frame count, so the display can
+//      tell if the pages it fetches from have changed (see CPU_DisplayDMA()). The stamp is found
+//      through pageStamp, so that is one store.
+//*******************************************************************************************************
+
+static inline void CPU_Write(CPU1802MACHINE *cpu,WORD16 address,BYTE8 data)
+{
+    BYTE8 *page = cpu->writePage[address >> 8];
+    *cpu->pageStamp[address >> 8] = cpu->frameCount;
+    if (page != NULL) page[address & 0xFF] = data; else CPU_WriteSlow(cpu,address,data);
+}
+
+static void CPU_CoreWriteMemory(CPU1802MACHINE *cpu,WORD16 address,BYTE8 data)
+{
+    CPU_Write(cpu,address,data);
+}
+
+//*******************************************************************************************************
+//                     Read a BYTE8 in memory the long way, for pages with no table entry
+//*******************************************************************************************************
+
+#ifdef IS_COSMACVIP
+static BYTE8 CPU_ReadDecode(CPU1802MACHINE *cpu,WORD16 address)
+{
+    if (address < cpu->ramMemorySize) return cpu->ramMemory[address];
+    address -= 0x8000;
+    if (address >= 0 && address < MONITOR_SIZE)
+    {
+        #ifdef ARDUINO_VERSION
+        return pgm_read_byte_near(_monitor+address);
+        #else
+        return _monitor[address];
+        #endif // ARDUINO_VERSION
+    }
+    return 0;
+}
+#endif
+
+#ifdef IS_ELF
+static BYTE8 CPU_ReadDecode(CPU1802MACHINE *cpu,WORD16 address)
+{
+    address &= cpu->ramMask;
+    if (address < cpu->ramMemorySize) return cpu->ramMemory[address];
+    return 0;
+}
+#endif
+
+#ifdef IS_STUDIO2
+static BYTE8 CPU_ReadDecode(CPU1802MACHINE *cpu,WORD16 address)
+{
+    address &= 0xFFF;
+    if (address < 0x800)
+    {
+        #ifdef ARDUINO_VERSION
+        return pgm_read_byte_near(_studio2+address);
+        #else
+        return _studio2[address];
+        #endif // ARDUINO_VERSION
+    }
+    if (address >= 0x800 && address < 0xA00)
+        return cpu->ramMemory[address-0x800];
+    return 0xFF;
+}
+#endif
+
+//*******************************************************************************************************
+//                    Write a BYTE8 in memory the long way, for pages with no table entry
+//*******************************************************************************************************
+
+#ifdef IS_COSMACVIP
+static void CPU_WriteDecode(CPU1802MACHINE *cpu,WORD16 address,BYTE8 data)
+{
+    if (address < cpu->ramMemorySize) cpu->ramMemory[address] = data;               // only RAM space is writeable
+}
+#endif
+
+#ifdef IS_ELF
+static void CPU_WriteDecode(CPU1802MACHINE *cpu,WORD16 address,BYTE8 data)
+{
+    address &= cpu->ramMask;
+    if (address < cpu->ramMemorySize) cpu->ramMemory[address] = data;               // only RAM space is writeable
+}
+#endif
+
+#ifdef IS_STUDIO2
+static void CPU_WriteDecode(CPU1802MACHINE *cpu,WORD16 address,BYTE8 data)
+{
+    address = address & 0xFFF;
+    if (address >= 0x800 && address < 0xA00) cpu->ramMemory[address-0x800] = data;  // only RAM space is writeable
+}
+#endif
+
+#ifdef BLOCK_CACHE
+
+//*******************************************************************************************************
+//         Throw away all the blocks with code in a page, and let it be written directly again
+//*******************************************************************************************************
+
+static void CPU_InvalidatePage(CPU1802MACHINE *cpu,BYTE8 page)
+{
+    BLOCK *block;
+    int n,i;
+    for (n = 0;n < 512;n++)                                                         // Blocks starting in this page or the one
+    {                                                                               // before, the only ones that can reach it.
+        block = (BLOCK *)cpu->blockCache + (((((page+255) << 8) + n) & 0xFFFF) & (BLOCK_CACHE_SIZE-1));
+        if (block->start >= 0 && (block->firstPage == page || block->lastPage == page))
+        {
+            block->start = -1;
+            for (i = 0;i < block->count;i++) block->op[i].address = -1;             // In case it is the one running
+        }
+    }
+    #ifdef JIT_X86_64
+    if (cpu->jit != NULL) CPU_JitInvalidatePage(cpu,page);                          // Translations of them too
+    #endif
+    #ifdef STATIC_ROM
+    if (cpu->staticRam == STATIC_VALID) cpu->staticRam = STATIC_UNCHECKED;          // Compiled RAM image may be changed
+    #endif
+    #ifdef CHIP8_HLE
+    if (cpu->chip8Code == CHIP8_VALID) cpu->chip8Code = CHIP8_UNCHECKED;            // So may the CHIP-8 interpreter
+    #endif
+    #ifdef ROUTINE_HOOKS
+    for (n = 0;n < (int)sizeof(cpu->hookCode);n++)                                  // and the hooked routines
+        if (cpu->hookCode[n] == HOOK_VALID) cpu->hookCode[n] = HOOK_UNCHECKED;
+    #endif
+    cpu->codePage[page] = FALSE;
+    memset(cpu->codeMap[page],0,sizeof(cpu->codeMap[page]));
+    cpu->writePage[page] = cpu->readPage[page];                                     // Only RAM pages are ever marked
+}
+
+//*******************************************************************************************************
+//      Mark the bytes of a block as cached code, and its pages as holding it so writes to them come
+//      to CPU_WriteSlow(). Only writes to the marked bytes throw the page away, not data next to it.
+//*******************************************************************************************************
+
+static void CPU_MarkCodePage(CPU1802MACHINE *cpu,BYTE8 page)
+{
+    if (cpu->writePage[page] == cpu->readPage[page])                                // Writable, i.e. not ROM or open bus
+    {
+        cpu->codePage[page] = TRUE;
+        cpu->writePage[page] = NULL;
+    }
+}
+
+static void CPU_MarkCode(CPU1802MACHINE *cpu,const BLOCK *block)
+{
+    const MICROOP *op;
+    WORD16 address;
+    BYTE8 n;
+    for (op = block->op;op->address >= 0;op++)
+    {
+        for (n = 0;n < op->length;n++)
+        {
+            address = op->address + n;
+            cpu->codeMap[address >> 8][(address >> 3) & 31] |= (1 << (address & 7));
+        }
+    }
+    CPU_MarkCodePage(cpu,block->firstPage);
+    CPU_MarkCodePage(cpu,block->lastPage);
+}
+
+#if defined(STATIC_ROM) && defined(IS_COSMACVIP)
+
+//*******************************************************************************************************
+//      Check the code of a RAM image compiled ahead of time (the VIP CHIP-8 interpreter) is still in
+//      RAM before it is run. Ranges are address,length pairs ending in 0,0. If it is, its bytes are
+//      marked as code, so changing them comes to CPU_InvalidatePage() and it is checked again. If not,
+//      it is not checked again until the next frame.
+//*******************************************************************************************************
+
+#define STATIC_RAM_OK(i,b,r)    (cpu->staticRam == STATIC_VALID ||                                      \
+                                (cpu->staticRam == STATIC_UNCHECKED && CPU_StaticVerify(cpu,i,b,r)))
+
+static BYTE8 CPU_StaticVerify(CPU1802MACHINE *cpu,const BYTE8 *image,WORD16 base,const WORD16 *ranges)
+{
+    const WORD16 *range;
+    WORD16 address;
+    cpu->staticRam = STATIC_STALE;
+    for (range = ranges;range[1] != 0;range += 2)
+    {
+        for (address = range[0];address != range[0]+range[1];address++)
+        {
+            if (CPU_Read(cpu,address) != image[address-base]) return FALSE;
+        }
+    }
+    for (range = ranges;range[1] != 0;range += 2)
+    {
+        for (address = range[0];address != range[0]+range[1];address++)
+        {
+            cpu->codeMap[address >> 8][(address >> 3) & 31] |= (1 << (address & 7));
+            CPU_MarkCodePage(cpu,address >> 8);
+        }
+    }
+    cpu->staticRam = STATIC_VALID;
+    return TRUE;
+}
+
+#endif
+
+//*******************************************************************************************************
+//        Put BLOCK_END at op, and work out the fetch cycles to hand back if the block is left early
+//*******************************************************************************************************
+
+static void CPU_EndBlock(BLOCK *block,MICROOP *op)
+{
+    BYTE8 n;
+    op->opCode = BLOCK_END;op->operand = 0;op->length = 0;
+    op->address = -1;                                                               // Always leaves the block
+    op->refund = 0;
+    for (n = block->count;n > 0;n--,op--)
+    {
+        op[-1].refund = op->refund + 2;
+    }
+    block->fetchCycles = op->refund;
+}
+
+//*******************************************************************************************************
+//                                          Decode a block
+//*******************************************************************************************************
+
+static void CPU_DecodeBlock(CPU1802MACHINE *cpu,BLOCK *block,WORD16 address)
+{
+    MICROOP *op = block->op;
+    BYTE8 opCode,decode,isEnd;
+    block->start = address;
+    block->firstPage = block->lastPage = address >> 8;
+    block->count = 0;block->cycles = 0;
+    do
+    {
+        opCode = CPU_Read(cpu,address);
+        decode = _decode1802[opCode];
+        op->opCode = opCode;
+        op->address = address;
+        op->length = 1 + (decode & DEC_OPERANDS);
+        op->operand = 0;
+        if (op->length > 1) op->operand = CPU_Read(cpu,address+1);                  // Immediate byte or high address byte
+        if (op->length > 2) op->operand = (op->operand << 8) | CPU_Read(cpu,address+2);
+        block->cycles += (decode & DEC_EXTRACYCLE) ? 3 : 2;
+        address += op->length;
+        if (((address-1) >> 8) != block->firstPage) block->lastPage = (address-1) >> 8;
+        isEnd = (decode & DEC_NEWP) != 0 || opCode == 0xC0 || opCode == 0x00;       // SEP, RET, DIS, LBR and IDL end it.
+        if (opCode == 0x30)                                                         // BR is followed if it stays in the first page,
+        {                                                                           // and is not to itself.
+            address = (address & 0xFF00) | op->operand;
+            isEnd = (address >> 8) != block->firstPage || address == op->address;
+        }
+
+        op++;
+        block->count++;
+    } while (!isEnd && block->count < BLOCK_MAX_OPS);
+    CPU_EndBlock(block,op);
+}
+
+//*******************************************************************************************************
+//     Copy the start of a block into part, as far as it runs before more than cyclesLeft have been
+//     used. The first instruction is always copied so that it behaves like the instruction by
+//     instruction core near the end of a state. The copy also ends after a write, as it would not
+//     be stopped if the write changed the code.
+//*******************************************************************************************************
+
+static BLOCK *CPU_PartBlock(const BLOCK *block,BLOCK *part,int cyclesLeft)
+{
+    const MICROOP *op = block->op;
+    MICROOP *copy = part->op;
+    BYTE8 decode;
+    part->count = 0;
+    do
+    {
+        decode = _decode1802[op->opCode];
+        *copy++ = *op++;
+        part->count++;
+        cyclesLeft -= (decode & DEC_EXTRACYCLE) ? 3 : 2;
+    } while (op->opCode != BLOCK_END && cyclesLeft >= 0 && (decode & DEC_WRITES) == 0);
+    CPU_EndBlock(part,copy);
+    return part;
+}
+
+//*******************************************************************************************************
+//                              Find the block at address, decoding it if needed
+//*******************************************************************************************************
+
+static inline BLOCK *CPU_FindBlock(BLOCK *cache,CPU1802MACHINE *cpu,WORD16 address)
+{
+    BLOCK *block = cache + (address & (BLOCK_CACHE_SIZE-1));
+    if (block->start == address) return block;
+    CPU_DecodeBlock(cpu,block,address);
+    CPU_MarkCode(cpu,block);
+    return block;
+}
+
+#endif
+
+//*******************************************************************************************************
+//             Write to a page with no write table entry, either cached code or not directly mapped
+//*******************************************************************************************************
+
+static void CPU_WriteSlow(CPU1802MACHINE *cpu,WORD16 address,BYTE8 data)
+{
+    BYTE8 *page = cpu->writePage[address >> 8];
+    #ifdef BLOCK_CACHE
+    if (cpu->codePage[address >> 8])                                                // Page holding cached code
+    {
+        if (cpu->codeMap[address >> 8][(address >> 3) & 31] & (1 << (address & 7)))
+            CPU_InvalidatePage(cpu,address >> 8);                                   // Written to the code itself
+        page = cpu->codePage[address >> 8] ? cpu->readPage[address >> 8] : cpu->writePage[address >> 8];
+    }
+    #endif
+    if (page != NULL) page[address & 0xFF] = data; else CPU_WriteDecode(cpu,address,data);
+}
+
+#ifdef JIT_X86_64
+#include "cpujit.h"
+#endif
+
+//*******************************************************************************************************
+//      Fetch all the display lines due by cycle now in one go, from where r0 points, moving it on a
+//      byte for each byte fetched. The lines are only fetched when something could tell they had
+//      been (see DISPLAY_TOUCHES()), so this is usually several at once. Returns how many.
+//
+//      A line comes out the same as last time if it is fetched from the same address, in one page
+//      not written since the frame it was last fetched in. Otherwise the display is marked changed
+//      this frame, so the host need not draw (or hash, or keep) a display that is not.
+//*******************************************************************************************************
+
+static int CPU_DisplayDMA(CPU1802MACHINE *cpu,WORD16 *r0,unsigned long now)
+{
+    unsigned long late = now - cpu->dmaNext;
+    int lines = 1,n,i;
+    BYTE8 *screen,*page;
+    WORD16 *from;
+    if (cpu->dmaLine >= CPU_DISPLAY_LINES || (long)late < 0) return 0;
+    if (late >= DMA_LINE_CYCLES) lines = (int)(late / DMA_LINE_CYCLES) + 1;         // More than one, fetch them all
+    if (lines > CPU_DISPLAY_LINES - cpu->dmaLine) lines = CPU_DISPLAY_LINES - cpu->dmaLine;
+    screen = cpu->display + cpu->dmaLine * CPU_DISPLAY_BYTES;
+    from = cpu->displayFrom + cpu->dmaLine;
+    cpu->dmaLine += lines;
+    cpu->dmaNext += lines * DMA_LINE_CYCLES;
+    for (n = 0;n < lines;n++)
+    {
+        page = cpu->readPage[*r0 >> 8];
+        if (page != NULL && (*r0 & 0xFF) <= 256-CPU_DISPLAY_BYTES)                  // All in one mapped page
+        {
+            memcpy(screen,page + (*r0 & 0xFF),CPU_DISPLAY_BYTES);
+            if (*from != *r0 || (long)(*cpu->pageStamp[*r0 >> 8] - cpu->displayBefore) >= 0)
+                cpu->displayChanged = cpu->frameCount;
+        }
+        else
+        {
+            for (i = 0;i < CPU_DISPLAY_BYTES;i++) screen[i] = CPU_Read(cpu,*r0 + i);
+            cpu->displayChanged = cpu->frameCount;                                  // Can't tell, so changed
+        }
+        *from++ = *r0;
+        screen += CPU_DISPLAY_BYTES;
+        *r0 += CPU_DISPLAY_BYTES;
+    }
+    return lines;
+}
+
+//*******************************************************************************************************
+//      Instructions that could tell whether a line has been fetched yet, by using R0 (as a register,
+//      or as P or X), by writing memory the DMA may read, or by I/O. IDL is one, as DMA ends it.
+//*******************************************************************************************************
+
+#define DISPLAY_TOUCHES(op) (P == 0 || X == 0 || ((op) & 0x0F) == 0 ||                                 \
+                            ((op) & 0xF0) == 0x50 || ((op) & 0xF0) == 0x60 ||                           \
+                            (op) == 0x73 || (op) == 0x78 || (op) == 0x79)
+
+//*******************************************************************************************************
+//          The generated code uses the bare 1802 register names, these map them onto the context
+//*******************************************************************************************************
+
+#define D       (cpu->D)
+#define X       (cpu->X)
+#define P       (cpu->P)
+#define T       (cpu->T)
+#define DF      (cpu->DF)
+#define IE      (cpu->IE)
+#define Q       (cpu->Q)
+#define R       (cpu->R)
+#define Cycles  (cpu->Cycles)
+
+#ifdef CHIP8_HLE
+#include "cpuchip8.h"
+#endif
+#ifdef STUDIO2_HLE
+#include "cpustudio2.h"
+#endif
+#ifdef ROUTINE_HOOKS
+#include "cpuhooks.h"
+#endif
+
+//*******************************************************************************************************
+//      Fetch the display lines due now, with the registers in the context. A DMA ends IDL, so if the
+//      last instruction was one the 1802 goes on past it.
+//*******************************************************************************************************
+
+static void CPU_DisplayCatchUp(CPU1802MACHINE *cpu)
+{
+    if (CPU_DisplayDMA(cpu,&R[0],CPU_EventNow(cpu)) > 0 && cpu->dmaIdle)
+    {
+        R[P]++;
+        cpu->dmaIdle = FALSE;
+    }
+}
+
+//*******************************************************************************************************
+//                           The 1861 sets EF1 for the 4 lines before the display
+//*******************************************************************************************************
+
+static BYTE8 CPU_EventEF1(CPU1802MACHINE *cpu,unsigned long when)
+{
+    cpu->ef1 = TRUE;
+    return FALSE;
+}
+
+//*******************************************************************************************************
+//      and interrupts 29 cycles before it, unless the display is off. Taking the interrupt uses a
+//      cycle of its own.
+//*******************************************************************************************************
+
+static BYTE8 CPU_EventInterrupt(CPU1802MACHINE *cpu,unsigned long when)
+{
+    cpu->State = 2;                                                                 // Switch to Interrupt Preliminary state
+    if (cpu->screenEnabled)                                                         // If screen is on
+    {
+        if (CPU_Read(cpu,R[P]) == 0) R[P]++;                                        // Come out of IDL for Interrupt.
+        if (IE != 0) Cycles--;                                                      // Interrupt cycle (S3)
+        INTERRUPT();                                                                // if IE != 0 generate an interrupt.
+    }
+    return FALSE;
+}
+
+//*******************************************************************************************************
+//      Start the display. With it on the first line is fetched now and one every DMA_LINE_CYCLES
+//      after, as the 1802 gets to them (see CPU_DisplayDMA()).
+//*******************************************************************************************************
+
+static BYTE8 CPU_EventDisplay(CPU1802MACHINE *cpu,unsigned long when)
+{
+    unsigned long lineCycles = CYCLES_PER_LINE;                                     // No DMA, the 1802 has the whole line
+    cpu->ef1 = FALSE;
+    if (cpu->screenEnabled)
+    {
+        cpu->dmaLine = 0;
+        cpu->dmaNext = when + DMA_DELAY;
+        cpu->dmaIdle = (CPU_Read(cpu,R[P]) == 0);                                   // Waiting in IDL for it
+        cpu->displayBefore = cpu->displayFrame;                                     // Fetched this frame, compared
+        cpu->displayFrame = cpu->frameCount;                                        // with when last fetched
+        lineCycles = DMA_LINE_CYCLES;
+    }
+    CPU_ScheduleEvent(cpu,EVENT_EF1,when+EF1_LINE*lineCycles);
+    CPU_ScheduleEvent(cpu,EVENT_DISPLAY_END,when+CPU_DISPLAY_LINES*lineCycles);
+    return FALSE;
+}
+
+//*******************************************************************************************************
+//      The end of the display ends the frame. The lines not yet fetched are fetched, and the next
+//      frame is scheduled from here.
+//*******************************************************************************************************
+
+static BYTE8 CPU_EventDisplayEnd(CPU1802MACHINE *cpu,unsigned long when)
+{
+    CPU_DisplayCatchUp(cpu);
+    cpu->dmaLine = CPU_DISPLAY_LINES;
+    cpu->ef1 = FALSE;
+    cpu->State = 1;                                                                 // Switch to Main Frame State
+    cpu->frameCount++;
+    CPU_ScheduleEvent(cpu,EVENT_SYNC,when);
+    CPU_ScheduleEvent(cpu,EVENT_KEYPAD,when);
+    CPU_ScheduleFrame(cpu,when);
+    return FALSE;
+}
+
+//*******************************************************************************************************
+//      At the same point the host catches up with it. Anything found changed during the frame is
+//      checked again from here.
+//*******************************************************************************************************
+
+static BYTE8 CPU_EventSync(CPU1802MACHINE *cpu,unsigned long when)
+{
+    #ifdef ROUTINE_HOOKS
+    BYTE8 n;
+    #endif
+    #ifdef STATIC_ROM
+    if (cpu->staticRam == STATIC_STALE) cpu->staticRam = STATIC_UNCHECKED;          // Check the compiled RAM image again
+    #endif
+    #ifdef CHIP8_HLE
+    if (cpu->chip8Code == CHIP8_STALE) cpu->chip8Code = CHIP8_UNCHECKED;            // and the CHIP-8 interpreter
+    #endif
+    #ifdef ROUTINE_HOOKS
+    for (n = 0;n < sizeof(cpu->hookCode);n++)                                       // and the hooked routines
+        if (cpu->hookCode[n] == HOOK_STALE) cpu->hookCode[n] = HOOK_UNCHECKED;
+    #endif
+    SYSTEM_Command(HWC_FRAMESYNC,0);                                                // Synchronise.
+    return TRUE;
+}
+
+//*******************************************************************************************************
+//                              Scan the keypad, once a frame after the sync
+//*******************************************************************************************************
+
+static BYTE8 CPU_EventKeypad(CPU1802MACHINE *cpu,unsigned long when)
+{
+    BYTE8 n,newKey;
+    newKey = 0xFF;                                                                  // Update current key pressed.
+    for (n = 0;n < 16;n++)
+    {
+        if (SYSTEM_Command(HWC_READKEYBOARD,n)) newKey = n;
+    }
+    if (newKey != cpu->currentKey)                                                  // Has key status changed ?
+    {
+        cpu->currentKey = newKey;                                                   // Update current key
+        #ifdef IS_ELF
+        if (cpu->currentKey != 0xFF)                                                // If it is a new key press
+        {
+            cpu->keyboardLatch = (cpu->keyboardLatch << 4) | cpu->currentKey;       // Shift into the keyboard latch
+            cpu->keyboardLatch = cpu->keyboardLatch & 0xFF;                         // which is an 8 bit value.
+        }
+        #endif
+    }
+    return FALSE;
+}
+
+//*******************************************************************************************************
+//      Run an event (see cpuevents.h), returning TRUE if it ends the frame. New devices add theirs
+//      here.
+//*******************************************************************************************************
+
+static BYTE8 CPU_EventHandler(CPU1802MACHINE *cpu,BYTE8 type,unsigned long when)
+{
+    BYTE8 frameEnded = FALSE;
+    switch (type)
+    {
+        case EVENT_EF1:
+            frameEnded = CPU_EventEF1(cpu,when);
+            break;
+        case EVENT_INTERRUPT:
+            frameEnded = CPU_EventInterrupt(cpu,when);
+            break;
+        case EVENT_DISPLAY:
+            frameEnded = CPU_EventDisplay(cpu,when);
+            break;
+        case EVENT_DISPLAY_END:
+            frameEnded = CPU_EventDisplayEnd(cpu,when);
+            break;
+        case EVENT_SYNC:
+            frameEnded = CPU_EventSync(cpu,when);
+            break;
+        case EVENT_KEYPAD:
+            frameEnded = CPU_EventKeypad(cpu,when);
+            break;
+    }
+    return frameEnded;
+}
+
+//*******************************************************************************************************
+//                                         Execute one instruction
+//*******************************************************************************************************
+
+static BYTE8 CPU_CoreExecute(CPU1802MACHINE *cpu)
+{
+    BYTE8 rState = 0;
+    WORD16 _temp;                                                                   // Temporary register
+    BYTE8 opCode;
+    if (cpu->dmaLine < CPU_DISPLAY_LINES) CPU_DisplayCatchUp(cpu);                  // Display lines due come first
+    opCode = CPU_Read(cpu,R[P]++);
+    Cycles -= 2;                                                                    // 2 x 8 clock Cycles - Fetch and Execute.
+    switch(opCode)                                                                  // Execute dependent on the Operation Code
+    {
+        #include "cpu1802.h"
+    }
+    cpu->dmaIdle = (opCode == 0x00);
+    if (Cycles < 0)                                                                 // Events are due.
+    {
+        CPU_RunEvents(cpu);
+        rState = cpu->State;                                                        // Return state as state may have switched
+    }
+    return rState;
+}
+
+#undef D
+#undef X
+#undef P
+#undef T
+#undef DF
+#undef IE
+#undef Q
+#undef R
+#undef Cycles
+
+//*******************************************************************************************************
+//   Run loops, plain, with the break point check, with translated code, and for while the display is
+//   being fetched (see cpucore.h). Only the ones that do not check the break point run the ROM code
+//   compiled ahead of time, the display one only while no break point is set.
+//*******************************************************************************************************
+
+#define RUN_FUNCTION    CPU_RunFast
+#ifdef STATIC_ROM
+#define RUN_STATIC
+#endif
+#include "cpucore.h"
+
+#define RUN_FUNCTION    CPU_RunBreak
+#define RUN_BREAKCHECK
+#include "cpucore.h"
+
+#ifdef JIT_X86_64
+#define RUN_FUNCTION    CPU_RunJit
+#define RUN_JIT
+#ifdef STATIC_ROM
+#define RUN_STATIC
+#endif
+#include "cpucore.h"
+#endif
+
+#define RUN_FUNCTION    CPU_RunDisplay
+#define RUN_DISPLAY
+#ifdef STATIC_ROM
+#define RUN_STATIC
+#endif
+#include "cpucore.h"
+
+//*******************************************************************************************************
+//      Run for up to cycleBudget cycles, stopping early at the end of a frame or the break point.
+//      The break point is only tested when one is set, by a separate copy of the run loop. While the
+//      display is being fetched everything runs in CPU_RunDisplay(), which checks it itself.
+//*******************************************************************************************************
+
+static BYTE8 CPU_CoreRun(CPU1802MACHINE *cpu,long cycleBudget)
+{
+    long limit;
+    INT16 start;
+    BYTE8 hitBreak;
+    while (cycleBudget > 0)
+    {
+        limit = (long)cpu->Cycles + 1 - cycleBudget;                                // Value of Cycles when the budget runs out
+        if (limit < 0) limit = 0;                                                   // but the next event comes first.
+        start = cpu->Cycles;
+        if (cpu->dmaLine < CPU_DISPLAY_LINES)
+            hitBreak = CPU_RunDisplay(cpu,(INT16)limit);
+        else if (cpu->breakEnabled)
+            hitBreak = CPU_RunBreak(cpu,(INT16)limit);
+        #ifdef JIT_X86_64
+        else if (cpu->useJit)
+            hitBreak = CPU_RunJit(cpu,(INT16)limit);
+        #endif
+        else
+            hitBreak = CPU_RunFast(cpu,(INT16)limit);
+        cycleBudget -= start - cpu->Cycles;                                         // Deduct the cycles actually run.
+        if (hitBreak) return CPU_STOP_BREAK;
+        if (cpu->Cycles < 0)                                                        // Events are due.
+        {
+            if (CPU_RunEvents(cpu)) return CPU_STOP_FRAME;                          // Frame has ended.
+            if (cpu->breakEnabled && cpu->R[cpu->P] == cpu->breakPoint)             // Interrupt may land on the break.
+                return CPU_STOP_BREAK;
+        }
+    }
+    return CPU_STOP_BUDGET;
+}
+
+//*******************************************************************************************************
+//      Turn translation of hot code to x86-64 on or off, returning TRUE if it is now on. It is off
+//      unless asked for, and not there at all if not built in, the interpreter then does everything.
+//*******************************************************************************************************
+
+static BYTE8 CPU_CoreSetJit(CPU1802MACHINE *cpu,BYTE8 enable)
+{
+    #ifdef JIT_X86_64
+    if (enable && cpu->jit == NULL) cpu->jit = CPU_JitCreate();                     // Made the first time it is used
+    cpu->useJit = (enable && cpu->jit != NULL);
+    return cpu->useJit;
+    #else
+    return FALSE;
+    #endif
+}
+
+//*******************************************************************************************************
+//      Turn running the VIP CHIP-8 interpreter's instructions natively on or off, returning TRUE if it
+//      is now on. Off unless asked for, and only there on the VIP with the compiled ROMs.
+//*******************************************************************************************************
+
+static BYTE8 CPU_CoreSetChip8(CPU1802MACHINE *cpu,BYTE8 enable)
+{
+    #ifdef CHIP8_HLE
+    cpu->useChip8 = (enable != 0);
+    return cpu->useChip8;
+    #else
+    return FALSE;
+    #endif
+}
+
+//*******************************************************************************************************
+//      The same for the Studio 2 BIOS interpreter, only there on the Studio 2 with the compiled ROMs.
+//*******************************************************************************************************
+
+static BYTE8 CPU_CoreSetStudio2(CPU1802MACHINE *cpu,BYTE8 enable)
+{
+    #ifdef STUDIO2_HLE
+    cpu->useStudio2 = (enable != 0);
+    return cpu->useStudio2;
+    #else
+    return FALSE;
+    #endif
+}
+
+//*******************************************************************************************************
+//      Turn running hot ROM routines natively on or off (see cpuhooks.h), returning TRUE if it is
+//      now on. Off unless asked for, and only there with the compiled ROMs.
+//*******************************************************************************************************
+
+static BYTE8 CPU_CoreSetHooks(CPU1802MACHINE *cpu,BYTE8 enable)
+{
+    #ifdef ROUTINE_HOOKS
+    CPU_HookPages(cpu);
+    cpu->useHooks = (enable != 0);
+    return cpu->useHooks;
+    #else
+    return FALSE;
+    #endif
+}
+
+//*******************************************************************************************************
+//      Finish loading a saved machine (see CPU_LoadState()) by putting its RAM back. Only pages whose
+//      cached code is changed by it are thrown away, so going back to a recent state is quick. Every
+//      page counts as written now. The host is then told Q as it is now.
+//*******************************************************************************************************
+
+static void CPU_CoreRestore(CPU1802MACHINE *cpu,const BYTE8 *ram)
+{
+    int page;
+    #ifdef BLOCK_CACHE
+    int n;
+    long offset;
+    for (page = 0;page < 256;page++)
+    {
+        if (!cpu->codePage[page]) continue;
+        offset = cpu->readPage[page] - cpu->ramMemory;                              // Where its RAM is, if directly mapped
+        if (cpu->readPage[page] == NULL || offset < 0 || offset+256 > cpu->ramMemorySize)
+        {
+            CPU_InvalidatePage(cpu,page);
+            continue;
+        }
+        for (n = 0;n < 256;n++)
+        {
+            if (ram[offset+n] != cpu->ramMemory[offset+n] && (cpu->codeMap[page][n >> 3] & (1 << (n & 7))))
+            {
+                CPU_InvalidatePage(cpu,page);
+                break;
+            }
+        }
+    }
+    #endif
+    memcpy(cpu->ramMemory,ram,cpu->ramMemorySize);
+    for (page = 0;page < 256;page++) cpu->pageWritten[page] = cpu->frameCount;      // (all of it may have changed)
+    CPU_OutputHandler(cpu,0,cpu->Q);
+}
+
+//*******************************************************************************************************
+//                     The core for this machine, picked by CPU_Create() (see cpu.c)
+//*******************************************************************************************************
+
+const CPU1802CORE CPU_CORE = {
+    CORE_MACHINE,
+    CPU_CoreCreate,CPU_CoreDestroy,CPU_CoreReset,CPU_CoreExecute,CPU_CoreRun,
+    CPU_CoreReadMemory,CPU_CoreWriteMemory,
+    CPU_CoreSetJit,CPU_CoreSetChip8,CPU_CoreSetStudio2,CPU_CoreSetHooks,
+    CPU_CoreRestore
+};
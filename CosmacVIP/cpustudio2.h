@@ -0,0 +1,701 @@
+//*******************************************************************************************************
+//*******************************************************************************************************
+//
+//      Name:       CpuStudio2.H
+//      Purpose:    High level emulation of the Studio 2 BIOS interpreter (included by cpumachine.h)
+//      Date:       17th October 2026
+//
+//*******************************************************************************************************
+//*******************************************************************************************************
+
+// The Studio 2 BIOS interpreter (see Miscellany/bios.asm) fetches each instruction in a loop at $006B
+// with P = 4, looks up its handler in the tables at $00E0/$00F0 and runs it with P = 3, the handler
+// going back with SEP R4 to $0092, a BR to $006B. The program pointer is R5, the index RA, the stack
+// R2 and the variables the bytes at $C0-$CF of the page in R6.1, the sprite tables following them.
+//
+// When it is turned on and the run loop reaches $006B each instruction is run here instead. It leaves
+// every register and every byte of memory just as the interpreter would, reading and writing memory
+// in the same order so it does not matter what overlaps what, and takes the same number of cycles,
+// so the interpreter can carry on from any instruction. An instruction is only run here if it will
+// fit in the cycles left, so the interrupt never comes in the middle of one. 0xxx (machine code) and
+// anything else not in bios.asm is left to the interpreter. The BIOS is in ROM so it is always there.
+
+#define STUDIO2_FETCH       (0x006B)                                                // Fetch loop (P = 4)
+#define STUDIO2_TABLE       (0x00E0)                                                // Handler high bytes, low bytes at +$10
+
+#define STUDIO2_AT(p,pc)    ((p) == 4 && (pc) == STUDIO2_FETCH)
+
+#define STUDIO2_FITS(n)     (Cycles - (n) * 2 >= limit)                             // n instructions fit in the cycles left
+#define STUDIO2_PLO(r,d)    R[r] = (R[r] & 0xFF00) | (BYTE8)(d)                     // PLO / PHI
+#define STUDIO2_PHI(r,d)    R[r] = (R[r] & 0x00FF) | ((WORD16)(BYTE8)(d) << 8)
+#define STUDIO2_RAM(a)      (((a) & 0x0E00) == 0x0800)                              // $800-$9FF, as decoded
+
+//*******************************************************************************************************
+//      What the fetch loop leaves behind, from $006B up to the handler. b1 and b2 are the instruction,
+//      handler where it goes.
+//*******************************************************************************************************
+
+static void CPU_Studio2Fetch(CPU1802MACHINE *cpu,BYTE8 b1,BYTE8 b2,WORD16 handler)
+{
+    STUDIO2_PHI(7,R[6] >> 8);                                                       // GHI R6 PHI R7
+    STUDIO2_PHI(12,R[4] >> 8);                                                      // GHI R4 PHI RC
+    R[5]++;                                                                         // LDA R5 PLO RF
+    STUDIO2_PLO(15,b1);
+    STUDIO2_PLO(6,0xC0 | (b1 & 0x0F));                                              // R6 to the first variable,
+    STUDIO2_PLO(7,0xC0 | (b2 >> 4));                                                // R7 to the second
+    R[12] = (R[4] & 0xFF00) + 0xF1 + (b1 >> 4);                                     // RC past the low byte table entry
+    D = handler & 0xFF;
+    DF = 0;                                                                         // from ADI $0F
+    R[3] = handler;
+    P = 3;
+}
+
+//*******************************************************************************************************
+//      PointRFTo ($0292), called by SEP RC from the sprite code. RF to the sprite table entry offset
+//      from R7, as the byte after the SEP. 11 instructions with the SEP.
+//*******************************************************************************************************
+
+static void CPU_Studio2PointRF(CPU1802MACHINE *cpu,BYTE8 offset)
+{
+    int i;
+    STUDIO2_PHI(15,R[6] >> 8);
+    i = (R[7] & 0xFF) + offset;DF = i >> 8;D = i;
+    STUDIO2_PLO(15,D);
+    X = 15;
+}
+
+//*******************************************************************************************************
+//      XORPlot ($01EB), called by SEP RC. XOR the byte at R6 onto the screen at RD.0, RF.0 non zero
+//      if any pixel was already set. 13 instructions with the SEP, 14 if there was a collision.
+//*******************************************************************************************************
+
+static int CPU_Studio2Plot(CPU1802MACHINE *cpu)
+{
+    int count = 13;
+    STUDIO2_PHI(13,0x09);
+    X = 13;
+    D = CPU_Read(cpu,R[6]) & CPU_Read(cpu,R[13]);
+    if (D != 0) { STUDIO2_PLO(15,D);count++; }
+    D = CPU_Read(cpu,R[6]) ^ CPU_Read(cpu,R[13]);
+    CPU_Write(cpu,R[13],D);
+    R[6]++;
+    return count;
+}
+
+//*******************************************************************************************************
+//      Most instructions the sprite code can take, for the sprite in V9 with R6 on the variables.
+//*******************************************************************************************************
+
+static int CPU_Studio2SpriteBound(CPU1802MACHINE *cpu)
+{
+    WORD16 page = R[6] & 0xFF00;
+    BYTE8 v = CPU_Read(cpu,page | 0xC9);
+    v = CPU_Read(cpu,page | (BYTE8)(((0xD0 + v) & 0xFF) + 0x08)) & 0x0F;            // Height
+    return 200 + v * 36;
+}
+
+//*******************************************************************************************************
+//      Exxx, the sprite instructions ($0100). Returns the 1802 instructions taken, next is where R3
+//      is left.
+//*******************************************************************************************************
+
+static int CPU_Studio2Sprite(CPU1802MACHINE *cpu,WORD16 *next)
+{
+    int count,i;
+    BYTE8 carry,direction;
+    STUDIO2_PLO(7,0xC9);                                                            // Sprite number in V9
+    D = CPU_Read(cpu,R[7]);
+    DF = (D >> 4) & 1;D = D << 4;                                                   // SHL x 4
+    STUDIO2_PLO(6,D);                                                               // R6 to its picture buffer
+    X = 7;
+    i = 0xD0 + CPU_Read(cpu,R[7]);DF = i >> 8;D = i;
+    STUDIO2_PLO(7,D);                                                               // R7 to its table entries
+    R[12] = 0x0292;D = 0x92;                                                        // RC to PointRFTo
+    CPU_Studio2PointRF(cpu,0x10);
+    D = CPU_Read(cpu,R[15]);STUDIO2_PHI(13,D);                                      // RD.1 direction
+    CPU_Studio2PointRF(cpu,0x08);
+    D = CPU_Read(cpu,R[15]) & 0x0F;STUDIO2_PLO(14,D);                               // RE.0 height
+    D = CPU_Read(cpu,R[15]) & 0x80;STUDIO2_PHI(14,D);                               // RE.1 flip
+    D = CPU_Read(cpu,R[7]);STUDIO2_PLO(13,D);                                       // RD.0 position
+    R[5]--;
+    D = CPU_Read(cpu,R[5]++);                                                       // Instruction again, tested a bit at a time
+    count = 16+11+2+11+3+3+2+2;
+    for (i = 0;i < 4;i++)
+    {
+        DF = D & 1;D = D >> 1;
+        count += 2;
+        if (DF) break;
+    }
+    switch(i)
+    {
+        case 0:                                                                     // E1 move in the table's direction
+        case 1:                                                                     // E2 move in RC's direction
+            if (i == 1)
+            {
+                D = 0xCC;STUDIO2_PLO(15,D);
+                D = CPU_Read(cpu,R[15]);STUDIO2_PHI(13,D);
+                count += 4;
+            }
+            direction = R[13] >> 8;
+            count += 3;
+            D = direction ^ 0x02;
+            if (D != 0) { count += 3;D = direction ^ 0x08; }
+            if (D == 0)                                                             // 2 up, 8 down
+            {
+                D = CPU_Read(cpu,R[7]);
+                if (direction == 0x02)
+                    { i = D + (0x08 ^ 0xFF) + 1;count += 2; }
+                else
+                    { i = D + 0x08;count += 3; }
+                DF = i >> 8;D = i;
+                CPU_Write(cpu,R[7],D);                                              // _MoveVertical
+                CPU_Studio2PointRF(cpu,0x18);
+                D = 0x01;                                                           // GHI R3 SD
+                i = CPU_Read(cpu,R[15]) + (D ^ 0xFF) + 1;DF = i >> 8;D = i;
+                CPU_Write(cpu,R[15],D);
+                count += 1+11+4;
+                *next = 0x016D;
+                return count;
+            }
+            count += 3;
+            D = direction ^ 0x04;
+            if (D != 0) { count += 3;D = direction ^ 0x06; }
+            if (D != 0)                                                             // Not moved
+            {
+                count += 1;
+                *next = 0x0163;
+                return count;
+            }
+            if (direction == 0x06)                                                  // 6 right
+            {
+                for (;;)
+                {
+                    count += 2;
+                    if ((R[14] & 0xFF) == 0) break;
+                    D = CPU_Read(cpu,R[6]);
+                    DF = D & 1;D = D >> 1;
+                    CPU_Write(cpu,R[6],D);
+                    count += 4;
+                    if (DF)
+                    {
+                        count += 2;
+                        if ((R[14] >> 8) == 0)
+                        {
+                            D = 0x80;STUDIO2_PHI(14,D);R[13]++;
+                            count += 3;
+                        }
+                    }
+                    R[6]++;
+                    D = CPU_Read(cpu,R[6]);
+                    carry = D & 1;D = (D >> 1) | (DF << 7);DF = carry;              // RSHR
+                    CPU_Write(cpu,R[6],D);
+                    count += 5;
+                    if (DF)
+                    {
+                        R[6]--;
+                        D = CPU_Read(cpu,R[6]) | 0x80;
+                        CPU_Write(cpu,R[6],D);
+                        R[6]++;
+                        D = R[14] >> 8;
+                        count += 7;
+                        if (D != 0)
+                        {
+                            D = R[1] >> 8;STUDIO2_PHI(14,D);R[13]++;
+                            count += 3;
+                        }
+                    }
+                    R[6]++;R[14]--;
+                    count += 3;
+                }
+            }
+            else                                                                    // 4 left
+            {
+                for (;;)
+                {
+                    count += 2;
+                    if ((R[14] & 0xFF) == 0) break;
+                    D = CPU_Read(cpu,R[6]);
+                    DF = D >> 7;D = D << 1;
+                    CPU_Write(cpu,R[6],D);
+                    count += 4;
+                    if (DF)
+                    {
+                        count += 2;
+                        if ((R[14] >> 8) != 0)
+                        {
+                            D = R[1] >> 8;STUDIO2_PHI(14,D);R[13]--;
+                            count += 3;
+                        }
+                    }
+                    R[6]++;
+                    D = CPU_Read(cpu,R[6]);
+                    carry = D >> 7;D = (D << 1) | DF;DF = carry;                    // RSHL
+                    CPU_Write(cpu,R[6],D);
+                    count += 5;
+                    if (DF)
+                    {
+                        R[6]--;
+                        D = CPU_Read(cpu,R[6]) | 0x01;
+                        CPU_Write(cpu,R[6],D);
+                        R[6]++;
+                        D = R[14] >> 8;
+                        count += 7;
+                        if (D == 0)
+                        {
+                            D = 0x80;STUDIO2_PHI(14,D);R[13]--;
+                            count += 3;
+                        }
+                    }
+                    R[6]++;R[14]--;
+                    count += 3;
+                }
+            }
+            CPU_Studio2PointRF(cpu,0x20);                                           // _DecMoveCtr
+            D = CPU_Read(cpu,R[15]);
+            i = D + (0x01 ^ 0xFF) + 1;DF = i >> 8;D = i;
+            CPU_Write(cpu,R[15],D);
+            CPU_Studio2PointRF(cpu,0x08);                                           // new flip into the height
+            D = CPU_Read(cpu,R[15]) & 0x0F;
+            CPU_Write(cpu,R[15],D);
+            D = (R[14] >> 8) | CPU_Read(cpu,R[15]);
+            CPU_Write(cpu,R[15],D);
+            D = R[13] & 0xFF;
+            CPU_Write(cpu,R[7],D);                                                  // and the new position
+            count += 11+3+11+9;
+            *next = 0x020B;
+            return count;
+
+        case 2:                                                                     // E4 XOR the data at the index in
+            X = 6;
+            count += 1;
+            for (;;)
+            {
+                count += 2;
+                D = R[14] & 0xFF;
+                if (D == 0) break;
+                D = CPU_Read(cpu,R[10]++) ^ CPU_Read(cpu,R[6]);
+                CPU_Write(cpu,R[6],D);
+                R[6] += 2;R[14]--;
+                count += 7;
+            }
+            count += 1;
+            *next = 0x013D;
+            return count;
+
+        case 3:                                                                     // E8aa draw, jump on collision
+            D = 0x01;STUDIO2_PHI(12,D);
+            D = 0xEB;STUDIO2_PLO(12,D);                                             // RC to XORPlot
+            D = R[1] >> 8;STUDIO2_PLO(15,D);
+            D = R[14] >> 8;
+            count += 8;
+            if (D != 0) { R[13]--;count++; }                                        // Flipped, left byte first
+            for (;;)
+            {
+                count += 2;
+                D = R[14] & 0xFF;
+                if (D == 0) break;
+                count += CPU_Studio2Plot(cpu);
+                if (R[14] >> 8) R[13]++; else R[13]--;
+                count += CPU_Studio2Plot(cpu);
+                i = (R[13] & 0xFF) + ((R[14] >> 8) ? 7 : 9);DF = i >> 8;D = i;
+                STUDIO2_PLO(13,D);
+                R[14]--;
+                count += 1+5;
+            }
+            D = R[15] & 0xFF;
+            count += 2;
+            if (D != 0)                                                             // Collided, short jump
+            {
+                D = CPU_Read(cpu,R[5]);STUDIO2_PLO(5,D);
+                count += 3;
+                *next = 0x01E9;
+            }
+            else
+            {
+                R[5]++;
+                count += 2;
+                *next = 0x01E6;
+            }
+            return count;
+    }
+    D = 0x10;STUDIO2_PLO(15,D);                                                     // E0 clear the picture buffer
+    count += 2;
+    do
+    {
+        D = R[1] >> 8;
+        CPU_Write(cpu,R[6],D);
+        R[6]++;R[15]--;
+        D = R[15] & 0xFF;
+        count += 6;
+    } while (D != 0);
+    count += 1;
+    *next = 0x013D;
+    return count;
+}
+
+//*******************************************************************************************************
+//      Run one instruction from the fetch loop, returning FALSE (having changed nothing) if it is
+//      left to the interpreter. count is the 1802 instructions it takes, fetch, handler and BR $6B.
+//      bound is the most it can take, worked out before anything is changed.
+//*******************************************************************************************************
+
+static BYTE8 CPU_Studio2Instruction(CPU1802MACHINE *cpu,INT16 limit)
+{
+    BYTE8 b1 = CPU_Read(cpu,R[5]),b2 = CPU_Read(cpu,R[5]+1);
+    BYTE8 x = b1 & 0x0F,n = b2 & 0x0F,v,flag;
+    WORD16 handler,page,next,stack,digits;
+    int count,bound,i;
+    if (b1 < 0x10) return FALSE;                                                    // Machine code
+    page = R[6] & 0xFF00;                                                           // Variables page
+    handler = (CPU_Read(cpu,(R[4] & 0xFF00) | (STUDIO2_TABLE + (b1 >> 4))) << 8) |
+                CPU_Read(cpu,(R[4] & 0xFF00) | (STUDIO2_TABLE + 0x10 + (b1 >> 4)));
+    bound = 25;                                                                     // Longest of the short ones (Dkaa)
+    switch(handler)
+    {
+        case 0x009B:                                                                // 8xyf runs F0+f on the stack, only
+            stack = R[2];                                                           // these are one byte ops.
+            if ((n > 7 && n != 0x0E) || !STUDIO2_RAM(stack-2) || !STUDIO2_RAM(stack-1) ||
+                    (WORD16)(R[5]+1-(stack-2)) < 2)
+                return FALSE;
+            break;
+        case 0x0256:                                                                // 9xy8 BCD, the only long one
+            if ((n & 0x0F) == 0x08)
+            {
+                if ((R[1] >> 8) != 0) return FALSE;                                 // Table of powers of 10 in ROM
+                digits = page | CPU_Read(cpu,page | (0xC0 | (b2 >> 4)));            // and digits not over VX
+                if ((WORD16)((page | (0xC0 | x)) - digits) < 3) return FALSE;
+                v = CPU_Read(cpu,page | (0xC0 | x));
+                bound = 53 + 8 * (v / 100 + v / 10 % 10 + v % 10);
+            }
+            break;
+        case 0x0100:                                                                // Exxx, as long as the sprite is high
+            bound = CPU_Studio2SpriteBound(cpu);
+            break;
+        case 0x02A4:                                                                // Frnn
+            if (b2 == 0xF2)
+                bound = 2 + 5 * ((R[10] & 0xFF) + 1) + 1;
+            else if (b2 != 0xA6 && b2 != 0xA9 && b2 != 0xAC && b2 != 0xAF && b2 != 0xB3 && b2 != 0xB6)
+                return FALSE;
+            break;
+        case 0x00D2: case 0x00CA: case 0x00BF: case 0x00C4: case 0x024E: case 0x00B9:
+        case 0x023D: case 0x00D9: case 0x02E5: case 0x00AF: case 0x02BF:
+            break;
+        default:
+            return FALSE;
+    }
+    if (!STUDIO2_FITS(33 + bound + 1)) return FALSE;
+    CPU_Studio2Fetch(cpu,b1,b2,handler);
+    count = 33 + 1;next = STUDIO2_FETCH;
+    switch(handler)
+    {
+        case 0x00CA:                                                                // 2xxx call, then as 1xxx
+            R[5]++;
+            D = R[5] & 0xFF;CPU_Write(cpu,--R[2],D);
+            D = R[5] >> 8;CPU_Write(cpu,--R[2],D);
+            R[5]--;
+            count += 8;
+        case 0x00D2:                                                                // 1xxx jump
+            D = CPU_Read(cpu,R[5]++);STUDIO2_PLO(5,D);
+            D = (R[6] & 0xFF) & 0x0F;STUDIO2_PHI(5,D);
+            count += 6;next = 0x00D9;
+            break;
+
+        case 0x00BF:                                                                // 3raa jump if r != 0
+        case 0x00C4:                                                                // 4raa jump if r == 0
+            D = CPU_Read(cpu,R[6]);
+            if ((D != 0) == (handler == 0x00BF))
+            {
+                D = CPU_Read(cpu,R[5]);STUDIO2_PLO(5,D);
+                count += 5;next = 0x00CA;
+            }
+            else
+            {
+                R[5]++;
+                count += 4;next = 0x00C4;
+            }
+            break;
+
+        case 0x024E:                                                                // 5rnn skip if r != nn
+            D = CPU_Read(cpu,R[5]++);
+            X = 6;
+            D = D ^ CPU_Read(cpu,R[6]);
+            if (D == 0) { count += 5;next = 0x024E; }
+            else { R[5] += 2;count += 7;next = 0x0256; }
+            break;
+
+        case 0x00B9:                                                                // 6rnn r = nn
+            D = CPU_Read(cpu,R[5]++);
+            CPU_Write(cpu,R[6],D);
+            count += 3;next = 0x00BC;
+            break;
+
+        case 0x023D:                                                                // 7rnn r += nn, 70aa dec R0 and jump
+            D = x;
+            count += 3;
+            if (D != 0)
+            {
+                X = 6;
+                i = CPU_Read(cpu,R[5]++) + CPU_Read(cpu,R[6]);DF = i >> 8;D = i;
+                CPU_Write(cpu,R[6],D);
+                count += 5;next = 0x0247;
+                break;
+            }
+            i = CPU_Read(cpu,R[6]) + (0x01 ^ 0xFF) + 1;DF = i >> 8;D = i;
+            count += 3;
+            if (D != 0)                                                             // Only stored if not zero
+            {
+                CPU_Write(cpu,R[6],D);
+                D = CPU_Read(cpu,R[5]);STUDIO2_PLO(5,D);
+                count += 4;next = 0x02E5;
+            }
+            else
+            {
+                R[5]++;
+                count += 2;next = 0x024E;
+            }
+            break;
+
+        case 0x009B:                                                                // 8xyf arithmetic
+            R[2]--;X = 2;
+            D = 0xD3;CPU_Write(cpu,R[2]--,D);                                       // SEP R3 after it
+            D = CPU_Read(cpu,R[5]++) | 0xF0;
+            CPU_Write(cpu,R[2],D);
+            X = 6;
+            D = CPU_Read(cpu,R[7]++);
+            v = CPU_Read(cpu,R[6]);
+            switch(CPU_Read(cpu,R[2]))                                              // Run on the stack
+            {
+                case 0xF0:  D = v;break;                                            // LDX
+                case 0xF1:  D = D | v;break;                                        // OR, AND, XOR
+                case 0xF2:  D = D & v;break;
+                case 0xF3:  D = D ^ v;break;
+                case 0xF4:  i = D + v;DF = i >> 8;D = i;break;                      // ADD
+                case 0xF5:  i = v + (D ^ 0xFF) + 1;DF = i >> 8;D = i;break;         // SD
+                case 0xF6:  DF = D & 1;D = D >> 1;break;                            // SHR
+                case 0xF7:  i = D + (v ^ 0xFF) + 1;DF = i >> 8;D = i;break;         // SM
+                case 0xFE:  DF = D >> 7;D = D << 1;break;                           // SHL
+            }
+            R[2] += 2;
+            CPU_Write(cpu,R[6],D);
+            D = 0xCB;STUDIO2_PLO(6,D);                                              // Carry into VB
+            v = R[1] >> 8;D = (v << 1) | DF;DF = v >> 7;
+            CPU_Write(cpu,R[6],D);
+            count += 19;next = 0x00AF;
+            break;
+
+        case 0x0256:                                                                // 9xyf memory
+            STUDIO2_PHI(12,R[6] >> 8);
+            D = CPU_Read(cpu,R[7]);STUDIO2_PLO(12,D);                               // RC to the byte VY
+            D = CPU_Read(cpu,R[5]++);
+            count += 5;
+            for (i = 0;i < 4;i++)
+            {
+                DF = D & 1;D = D >> 1;
+                count += 2;
+                if (DF) break;
+            }
+            switch(i)
+            {
+                case 0:                                                             // 9xy1 VY = VX
+                    D = CPU_Read(cpu,R[6]);CPU_Write(cpu,R[7],D);
+                    count += 3;next = 0x029E;
+                    break;
+                case 1:                                                             // 9xy2 VX = byte VY
+                    D = CPU_Read(cpu,R[12]);CPU_Write(cpu,R[6],D);
+                    count += 3;next = 0x026D;
+                    break;
+                case 2:                                                             // 9xy4 byte VY = VX
+                    D = CPU_Read(cpu,R[6]);CPU_Write(cpu,R[12],D);
+                    count += 3;next = 0x0270;
+                    break;
+                case 3:                                                             // 9xy8 BCD of VX at byte VY on
+                    X = 6;
+                    D = CPU_Read(cpu,R[6]);STUDIO2_PHI(15,D);
+                    D = R[1] >> 8;STUDIO2_PHI(14,D);
+                    D = 0xBC;STUDIO2_PLO(14,D);                                     // RE to 100,10,1
+                    R[12]--;
+                    count += 8;
+                    do
+                    {
+                        R[12]++;
+                        D = R[1] >> 8;CPU_Write(cpu,R[12],D);
+                        count += 3;
+                        for (;;)                                                    // Subtract till it borrows
+                        {
+                            D = CPU_Read(cpu,R[14]);
+                            i = CPU_Read(cpu,R[6]) + (D ^ 0xFF) + 1;DF = i >> 8;D = i;
+                            count += 3;
+                            if (DF == 0) break;
+                            CPU_Write(cpu,R[6],D);
+                            i = CPU_Read(cpu,R[12]) + 1;DF = i >> 8;D = i;
+                            CPU_Write(cpu,R[12],D);
+                            count += 5;
+                        }
+                        D = CPU_Read(cpu,R[14]++);
+                        DF = D & 1;D = D >> 1;
+                        count += 3;
+                    } while (DF == 0);
+                    D = R[15] >> 8;CPU_Write(cpu,R[6],D);                           // VX back, VY moved on
+                    D = R[12] & 0xFF;CPU_Write(cpu,R[7],D);
+                    count += 5;next = 0x0290;
+                    break;
+                default:                                                            // 9xy0 skip if VX != VY
+                    D = CPU_Read(cpu,R[7]);
+                    X = 6;
+                    D = D ^ CPU_Read(cpu,R[6]);
+                    count += 2+3;
+                    if (D == 0) { count += 1;next = 0x024E; }
+                    else { R[5] += 2;count += 3;next = 0x0256; }
+                    break;
+            }
+            break;
+
+        case 0x00D9:                                                                // Annn index = nnn
+            D = (R[6] & 0xFF) & 0x0F;STUDIO2_PHI(10,D);
+            D = CPU_Read(cpu,R[5]++);STUDIO2_PLO(10,D);
+            count += 6;next = 0x00E0;
+            break;
+
+        case 0x02E5:                                                                // Bcnn store nn at index, add c to it
+            D = CPU_Read(cpu,R[5]++);
+            CPU_Write(cpu,R[10],D);
+            R[2]--;X = 2;
+            D = (R[6] & 0xFF) & 0x0F;CPU_Write(cpu,R[2],D);
+            i = (R[10] & 0xFF) + CPU_Read(cpu,R[2]);DF = i >> 8;D = i;
+            STUDIO2_PLO(10,D);
+            R[2]++;
+            count += 12;next = 0x02F2;
+            break;
+
+        case 0x00AF:                                                                // C0xx return, Crnn r = random & nn
+            D = (R[6] & 0xFF) ^ 0xC0;
+            count += 3;
+            if (D == 0)
+            {
+                D = CPU_Read(cpu,R[2]++);STUDIO2_PHI(5,D);
+                D = CPU_Read(cpu,R[2]++);STUDIO2_PLO(5,D);
+                count += 5;next = 0x00B9;
+                break;
+            }
+            R[9]++;                                                                 // _Random, from R9 and the BIOS
+            D = R[9] & 0xFF;STUDIO2_PLO(14,D);
+            D = 0x00;STUDIO2_PHI(14,D);                                             // GHI R3
+            X = 14;
+            i = (R[9] >> 8) + CPU_Read(cpu,R[14]);DF = i >> 8;D = i;
+            CPU_Write(cpu,R[6],D);
+            DF = D & 1;D = D >> 1;
+            X = 6;
+            i = D + CPU_Read(cpu,R[6]);DF = i >> 8;D = i;
+            STUDIO2_PHI(9,D);
+            CPU_Write(cpu,R[6],D);
+            D = CPU_Read(cpu,R[5]++) & CPU_Read(cpu,R[6]);
+            CPU_Write(cpu,R[6],D);
+            count += 18;next = 0x0064;
+            break;
+
+        case 0x02BF:                                                                // Dkaa jump if key k down
+            D = 0xCB;STUDIO2_PLO(7,D);
+            D = (R[6] & 0xFF) & 0x0F;STUDIO2_PLO(15,D);
+            D = D ^ 0x0F;
+            count += 7;
+            if (D == 0)                                                             // F, the key in VB
+            {
+                D = CPU_Read(cpu,R[7]);STUDIO2_PLO(15,D);
+                count += 2;
+            }
+            X = 2;R[2]--;
+            D = R[15] & 0xFF;CPU_Write(cpu,R[2],D);
+            CPU_OutputHandler(cpu,2,CPU_Read(cpu,R[2]));                            // OUT 2 selects the key
+            R[2]++;
+            D = 0xCA;STUDIO2_PLO(6,D);
+            D = CPU_Read(cpu,R[6]);                                                 // Which keypad
+            count += 9+1;
+            if (D != 0)
+                flag = CPU_ReadEFlag(cpu,3,0x02D9);
+            else
+                flag = CPU_ReadEFlag(cpu,4,0x02DD);
+            if (flag)
+            {
+                D = R[15] & 0xFF;CPU_Write(cpu,R[7],D);                             // Key into VB and jump
+                D = CPU_Read(cpu,R[5]);STUDIO2_PLO(5,D);
+                count += 6;next = 0x02E5;
+            }
+            else
+            {
+                R[5]++;
+                count += 2;next = 0x02DB;
+            }
+            break;
+
+        case 0x0100:                                                                // Exxx sprites
+            count += CPU_Studio2Sprite(cpu,&next);
+            break;
+
+        case 0x02A4:                                                                // Frnn, jumps to $02nn
+            D = CPU_Read(cpu,R[5]++);
+            count += 2;
+            switch(D)
+            {
+                case 0xA6:                                                          // FrA6 r = byte at index
+                    D = CPU_Read(cpu,R[10]);CPU_Write(cpu,R[6],D);
+                    count += 3;next = 0x02A9;
+                    break;
+                case 0xA9:                                                          // FrA9 byte at index = r
+                    D = CPU_Read(cpu,R[6]);CPU_Write(cpu,R[10],D);
+                    count += 3;next = 0x02AC;
+                    break;
+                case 0xAC:                                                          // FrAC as FrA6, index + 1
+                    D = CPU_Read(cpu,R[10]++);CPU_Write(cpu,R[6],D);
+                    count += 3;next = 0x02AF;
+                    break;
+                case 0xAF:                                                          // FrAF as FrA9, index + 1
+                    D = CPU_Read(cpu,R[6]);CPU_Write(cpu,R[10],D);
+                    R[10]++;
+                    count += 4;next = 0x02B3;
+                    break;
+                case 0xB3:                                                          // FrB3 index low = r
+                    D = CPU_Read(cpu,R[6]);STUDIO2_PLO(10,D);
+                    count += 3;next = 0x02B6;
+                    break;
+                case 0xB6:                                                          // FrB6 r &= 15, index low |= r
+                    D = CPU_Read(cpu,R[6]) & 0x0F;CPU_Write(cpu,R[6],D);
+                    X = 6;
+                    D = (R[10] & 0xFF) | CPU_Read(cpu,R[6]);STUDIO2_PLO(10,D);
+                    count += 8;next = 0x02BF;
+                    break;
+                default:                                                            // F?F2 clear down to index low 0
+                    do
+                    {
+                        D = R[1] >> 8;CPU_Write(cpu,R[10],D);
+                        D = R[10] & 0xFF;
+                        R[10]--;
+                        count += 5;
+                    } while (D != 0);
+                    count += 1;next = 0x02F9;
+                    break;
+            }
+            break;
+    }
+    Cycles -= count * 2;
+    R[3] = next;
+    P = 4;
+    R[4] = STUDIO2_FETCH;
+    return TRUE;
+}
+
+//*******************************************************************************************************
+//      Run Studio 2 instructions from R[P] for as long as they are known and fit, returning TRUE if
+//      any were. Registers are in the context, as for CPU_Execute().
+//*******************************************************************************************************
+
+static BYTE8 CPU_Studio2Run(CPU1802MACHINE *cpu,INT16 limit)
+{
+    BYTE8 ran = FALSE;
+    while (STUDIO2_AT(P,R[P]) && CPU_Studio2Instruction(cpu,limit)) ran = TRUE;
+    return ran;
+}
+
+#undef STUDIO2_FITS
+#undef STUDIO2_PLO
+#undef STUDIO2_PHI
+#undef STUDIO2_RAM
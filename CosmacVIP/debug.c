@@ -18,16 +18,100 @@
 #include "debugscreen.h"
 #include "debug.h"
 #include "cpu.h"
+#include "system.h"
+#include "rewind.h"
+#include "movie.h"
+#include "pace.h"
 
 static BOOL inDebugMode = TRUE;                                                     // True if in debugger mode
 static int  programPointer;                                                         // Displayed code
 static int  dataPointer;                                                            // Displayed data
 static int  breakPoint;                                                             // Current break
 static int  lastKey;                                                                // Last key status
+static BOOL useJit = FALSE;                                                         // Run hot code translated
+static BOOL useInterpreter = FALSE;                                                 // Run CHIP-8 / BIOS instructions natively
+static BOOL useHooks = FALSE;                                                       // Run hot ROM routines natively
 
 static void DBG_KeyCommand(char cmd);
 
-static BYTE8 ram[0x600];                                                              // RAM Space (maximum)
+static CPU1802MACHINE *machine = NULL;                                              // The emulated machine, with its RAM
+static BYTE8 machineType = DEFAULT_MACHINE;                                         // and which one it is (MACHINE_)
+static REWINDBUFFER *history = NULL;                                                // Its last few frames, to step back through
+static int runAhead = 0;                                                            // Frames run ahead of it for the display
+static BYTE8 *aheadState = NULL;                                                    // and it saved while they are
+static BOOL turbo = FALSE;                                                          // Always run flat out, not just with Tab
+static int clockMultiplier = 1;                                                     // 1802 clock it is created with
+static BOOL runShown = FALSE;                                                       // Display passed on since leaving the debugger
+static unsigned long shownFrame;                                                    // and the frame count it was at
+
+#ifndef RAMSIZE
+#define RAMSIZE     (0x600)                                                         // RAM Space (e.g. -DRAMSIZE=0x1000 for 4k)
+#endif
+
+#define STATEFILE   "machine.sav"                                                   // Saved by W, loaded by R
+#define REWINDSIZE  (1024L*1024L)                                                   // Bytes of frames kept to step back through
+
+//*******************************************************************************************************
+//                          Set the machine to emulate, before the first reset
+//*******************************************************************************************************
+
+void DBG_SetMachine(BYTE8 type)
+{
+    machineType = type;
+}
+
+//*******************************************************************************************************
+//      Show the display this many frames ahead of the machine, run with the keys as they are now, so
+//      a key press is seen that many frames sooner. 0 turns it off.
+//*******************************************************************************************************
+
+void DBG_SetRunAhead(int frames)
+{
+    runAhead = (frames > 0) ? frames : 0;
+}
+
+//*******************************************************************************************************
+//      Run flat out all the time, drawing only as many frames as the display shows. Otherwise it does
+//      while Tab is held.
+//*******************************************************************************************************
+
+void DBG_SetTurbo(BOOL isTurbo)
+{
+    turbo = isTurbo;
+}
+
+//*******************************************************************************************************
+//      Run the 1802 this many times as fast, the frames staying at 60Hz (see CPU_SetClock()). Before
+//      the first reset, out of range is the nearest it can be.
+//*******************************************************************************************************
+
+void DBG_SetClock(int multiplier)
+{
+    clockMultiplier = multiplier;
+}
+
+//*******************************************************************************************************
+//      Save the machine, run it ahead without the host, keep what it displays and put it back. If the
+//      break point is reached on the way the display is from there.
+//*******************************************************************************************************
+
+static BYTE8 *DBG_RunAhead(void)
+{
+    static BYTE8 display[CPU_DISPLAY_LINES*CPU_DISPLAY_BYTES];
+    long size = CPU_StateSize(machine);
+    BYTE8 *screen;
+    int n;
+    if (aheadState == NULL) aheadState = (BYTE8 *)malloc(size);
+    if (aheadState == NULL) return CPU_GetScreenMemoryAddress(machine);
+    CPU_SaveState(machine,aheadState,size);
+    SYSTEM_SetHeadless(TRUE);
+    for (n = 0;n < runAhead && CPU_Run(machine,CPU_RUN_UNLIMITED) == CPU_STOP_FRAME;n++) {}
+    SYSTEM_SetHeadless(FALSE);
+    screen = CPU_GetScreenMemoryAddress(machine);
+    if (screen != NULL) screen = (BYTE8 *)memcpy(display,screen,sizeof(display));
+    CPU_LoadState(machine,aheadState,size);
+    return screen;
+}
 
 //*******************************************************************************************************
 //                                          Full System Reset
@@ -35,14 +119,37 @@ static BYTE8 ram[0x600];
 
 void DBG_Reset()
 {
-    CPU_Reset(ram,sizeof(ram));                                                     // Reset CPU define RAM.
+    if (machine == NULL)                                                            // Create the machine first time
+    {
+        machine = CPU_Create(machineType,RAMSIZE);
+        if (machine == NULL) exit(fprintf(stderr,"Cannot create machine\n"));
+        CPU_SetClock(machine,(WORD16)clockMultiplier);                              // Kept over resets
+    }
+    if (history == NULL) history = REWIND_Create(machine,REWINDSIZE);               // and somewhere to record it
+    if (history == NULL) exit(fprintf(stderr,"Cannot create rewind buffer\n"));
+    MOVIE_Reset();                                                                  // Recorded if recording
+    CPU_Reset(machine,NULL,0);                                                      // Reset CPU, RAM unchanged.
+    REWIND_Clear(history);
     inDebugMode = TRUE;                                                             // Start in Debug Mode
     programPointer = 0x0000;                                                        // Start point
-    #ifdef IS_COSMACVIP
-    programPointer = 0x800A;                                                        // code at ROM position $800A for VIP
-    #endif
+    if (machineType == MACHINE_COSMACVIP)
+        programPointer = 0x800A;                                                    // code at ROM position $800A for VIP
     dataPointer = 0x0000;                                                           // Data at $0000
     breakPoint = 0xFFFF;                                                            // Break off (effectively)
+    CPU_ClearBreakPoint(machine);
+}
+
+//*******************************************************************************************************
+//      Record the keys to a movie from the machine as it is now, or play one back, and run. Stepping
+//      back and loading state are off while it does, as they would break the recording.
+//*******************************************************************************************************
+
+void DBG_StartMovie(char *fileName,BOOL record)
+{
+    BOOL ok = record ? MOVIE_Record(fileName,machine) : MOVIE_Play(fileName,machine);
+    if (!ok) exit(fprintf(stderr,"Cannot %s movie %s\n",record ? "record" : "play",fileName));
+    REWIND_Clear(history);
+    inDebugMode = FALSE;
 }
 
 //*******************************************************************************************************
@@ -65,7 +172,7 @@ void DBG_LoadFile(char *fileName,int address)
 
 void DBG_LoadData(WORD16 address,BYTE8 *data,WORD16 length)
 {
-    while (length-- > 0) CPU_WriteMemory(address++,*data++);
+    while (length-- > 0) CPU_WriteMemory(machine,address++,*data++);
 }
 
 //*******************************************************************************************************
@@ -98,29 +205,60 @@ void DBG_Execute()
         {
             if (IF_KeyPressed(i)) currentKey = i;
         }
+        if (IF_KeyPressed('\b')) currentKey = '\b';
         if (currentKey != lastKey && currentKey != -1)                              // If key changed and one pressed
             DBG_KeyCommand(currentKey);                                             // Execute it.
         lastKey = currentKey;
-        DBG_Draw(programPointer,dataPointer,breakPoint);                            // Update display
+        DBG_Draw(machine,programPointer,dataPointer,breakPoint);                    // Update display
+        runShown = FALSE;
     }
     else                                                                            // Run mode
     {
-        while (CPU_Execute() != 1 && CPU_ReadProgramCounter() != breakPoint) {}     // Execute till end of frame or break
-        if (IF_KeyPressed('M') || CPU_ReadProgramCounter() == breakPoint)           // M or break returns to debug mode
+        BOOL frameEnded = FALSE;
+        BYTE8 *screen;
+        PACE_SetTurbo(turbo || IF_KeyPressed('\t'));                                // Tab runs flat out
+        if (IF_KeyPressed('\b') && !MOVIE_Active())                                 // Backspace steps back a frame at a time,
+        {
+            REWIND_StepBack(history);
+            SYSTEM_Command(HWC_FRAMESYNC,0);                                        // as fast as they were played.
+        }
+        else
+        {
+            do                                                                      // Execute till end of frame or break,
+            {
+                frameEnded = (CPU_Run(machine,CPU_RUN_UNLIMITED) == CPU_STOP_FRAME);
+                if (frameEnded) REWIND_Record(history);                             // record each frame end
+            }
+            while (frameEnded && !MOVIE_ResetPending() && PACE_Skip());             // and run on past those not drawn.
+        }
+        screen = (frameEnded && runAhead > 0) ? DBG_RunAhead() : CPU_GetScreenMemoryAddress(machine);
+        if (IF_KeyPressed('M') || CPU_ReadProgramCounter(machine) == breakPoint)    // M or break returns to debug mode
         {
             inDebugMode = TRUE;
-            programPointer = CPU_ReadProgramCounter();                              // Program pointer at R[P]
+            programPointer = CPU_ReadProgramCounter(machine);                       // Program pointer at R[P]
         }
-        if (IF_KeyPressed('P'))                                                     // P is reset
+        if ((IF_KeyPressed('P') && !MOVIE_Playing() && (frameEnded || !MOVIE_Active())) || // P is reset, at a frame end if
+            MOVIE_ResetDue())                                                       // recording, or a played back one
         {
             DBG_Reset();
             inDebugMode = FALSE;
         }
-        IF_DisplayScreen(FALSE,                                                     // Update display
-                            CPU_GetScreenMemoryAddress(),CPU_GetScreenScrollOffset());
+        IF_PublishScreen(screen,!runShown || runAhead > 0 ||                        // Pass the display to be shown,
+                                    CPU_DisplayChanged(machine,shownFrame));        // if it can have changed
+        shownFrame = CPU_ReadFrameCount(machine);
+        runShown = TRUE;
     }
 }
 
+//*******************************************************************************************************
+//      TRUE if in the debugger, FALSE if running. Only the thread running DBG_Execute() may ask.
+//*******************************************************************************************************
+
+BOOL DBG_InDebugMode(void)
+{
+    return inDebugMode;
+}
+
 //*******************************************************************************************************
 //                                          Handle Debug Commands
 //*******************************************************************************************************
@@ -137,33 +275,53 @@ static void DBG_KeyCommand(char cmd)
     {
         int opcode;
         CPU1802STATE s;                                                             // Read CPU State
-        CPU_ReadState(&s);
+        CPU_ReadState(machine,&s);
         switch(cmd)
         {
-            case 'P':   DBG_Reset();                                                // P : Reset
-                        break;
+            case 'P':   if (!MOVIE_Active()) DBG_Reset();                           // P : Reset, not part way through a
+                        break;                                                      //     frame a movie is recording or playing
             case 'K':   breakPoint = programPointer;                                // K : Set Breakpoint
+                        CPU_SetBreakPoint(machine,breakPoint);
                         break;
             case 'H':   programPointer = s.R[s.P];                                  // H : Display code at R[P]
                         break;
             case 'X':   dataPointer = s.R[s.X];                                     // X : Display data at R[X]
                         break;
-            case 'S':   CPU_Execute();                                              // S : Single step
-                        CPU_ReadState(&s);
+            case 'S':   CPU_Execute(machine);                                       // S : Single step
+                        CPU_ReadState(machine,&s);
                         programPointer = s.R[s.P];
                         break;
             case 'G':   inDebugMode = FALSE;                                        // G : Run
                         break;
-            case 'V':   opcode = CPU_ReadMemory(s.R[s.P]);                          // V : Step over
+            case 'J':   useJit = CPU_SetJit(machine,!useJit);                       // J : Toggle translation of hot code
+                        break;
+            case 'L':   useInterpreter = CPU_SetChip8(machine,!useInterpreter) |    // L : Toggle high level CHIP-8 or
+                                            CPU_SetStudio2(machine,!useInterpreter);    //     Studio 2 BIOS
+                        break;
+            case 'N':   useHooks = CPU_SetHooks(machine,!useHooks);                 // N : Toggle native ROM routines
+                        break;
+            case 'W':   CPU_SaveStateFile(machine,STATEFILE);                       // W : Write the machine to a file
+                        break;
+            case 'R':   if (!MOVIE_Active() && CPU_LoadStateFile(machine,STATEFILE))    // R : Read it back
+                        {
+                            programPointer = CPU_ReadProgramCounter(machine);
+                            REWIND_Clear(history);
+                        }
+                        break;
+            case '\b':  if (!MOVIE_Active() && REWIND_StepBack(history))            // Backspace : Back a frame
+                            programPointer = CPU_ReadProgramCounter(machine);
+                        break;
+            case 'V':   opcode = CPU_ReadMemory(machine,s.R[s.P]);                  // V : Step over
                         if ((opcode & 0xF0) == 0xD0)                                // if SEP R?
                         {
                             inDebugMode = FALSE;                                    // Run with break at R[P]+1
                             breakPoint = (s.R[s.P]+1) & 0xFFFF;
+                            CPU_SetBreakPoint(machine,breakPoint);
                         }
                         else                                                        // otherwise same as normal single step
                         {
-                            CPU_Execute();
-                            CPU_ReadState(&s);
+                            CPU_Execute(machine);
+                            CPU_ReadState(machine,&s);
                             programPointer = s.R[s.P];
                         }
                         break;
@@ -12,8 +12,14 @@
 #ifndef _DEBUG_H
 #define _DEBUG_H
 
+void DBG_SetMachine(BYTE8 type);
+void DBG_SetRunAhead(int frames);
+void DBG_SetTurbo(BOOL isTurbo);
+void DBG_SetClock(int multiplier);
+void DBG_StartMovie(char *fileName,BOOL record);
 void DBG_Reset();
 void DBG_Execute();
+BOOL DBG_InDebugMode(void);
 void DBG_LoadChip8();
 void DBG_LoadFile(char *fileName,int address);
 void DBG_LoadData(WORD16 address,BYTE8 *data,WORD16 length);
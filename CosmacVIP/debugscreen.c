@@ -15,6 +15,7 @@
 #include "general.h"
 #include "cpu.h"
 #include "hardware.h"
+#include "pace.h"
 #include "mnemonics1802.h"
 
 static void DBG_PrintString(int x,int y,char *text,int fgr);
@@ -24,7 +25,7 @@ static void DBG_PrintHex(int x,int y,int n,int fgr,int w);
 //                                      Draw the debugger screen
 //*******************************************************************************************************
 
-void DBG_Draw(int programPointer,int dataPointer,int breakPoint)
+void DBG_Draw(CPU1802MACHINE *cpu,int programPointer,int dataPointer,int breakPoint)
 {
     char *labels[] = { "D","DF","P","RP","X","RX","MX","Q","IE","T",NULL };
     int i = 0;
@@ -36,16 +37,27 @@ void DBG_Draw(int programPointer,int dataPointer,int breakPoint)
     DBG_PrintString(24,7,"BP",2);
     DBG_PrintString(24,8,"CY",2);
     DBG_PrintString(24,9,"ST",2);
+    DBG_PrintString(24,5,"RT",2);
+    DBG_PrintString(24,6,"JT",2);
 
     CPU1802STATE s;
-    CPU_ReadState(&s);
+    CPU_ReadState(cpu,&s);
     i = 0;
     DBG_PrintHex(18,i++,s.D,3,2);DBG_PrintHex(18,i++,s.DF,3,1);DBG_PrintHex(18,i++,s.P,3,1);
     DBG_PrintHex(18,i++,s.R[s.P],3,4);DBG_PrintHex(18,i++,s.X,3,1);DBG_PrintHex(18,i++,s.R[s.X],3,4);
-    DBG_PrintHex(18,i++,CPU_ReadMemory(s.R[s.X]),3,2);DBG_PrintHex(18,i++,s.Q,3,1);DBG_PrintHex(18,i++,s.IE,3,1);
+    DBG_PrintHex(18,i++,CPU_ReadMemory(cpu,s.R[s.X]),3,2);DBG_PrintHex(18,i++,s.Q,3,1);DBG_PrintHex(18,i++,s.IE,3,1);
     DBG_PrintHex(18,i++,s.T,3,2);
     i = 7;
     DBG_PrintHex(27,i++,breakPoint,3,4);DBG_PrintHex(27,i++,s.Cycles,3,4);DBG_PrintHex(27,i++,s.State,3,1);
+
+    PACESTATS pace;                                                                 // Average lateness of frame ends
+    long render = IF_GetRenderTime();                                               // and time to draw one, in us
+    char timing[32];
+    PACE_GetStats(&pace);
+    sprintf(timing,"%4ld",pace.averageLate < 9999000L ? pace.averageLate / 1000 : 9999L);
+    DBG_PrintString(27,6,timing,3);
+    sprintf(timing,"%4ld",render < 9999000L ? render / 1000 : 9999L);
+    DBG_PrintString(27,5,timing,3);
     for (i = 0;i < 16;i++)
     {
         DBG_PrintString(i%4*8,i/4+11,"R",2);
@@ -55,7 +67,7 @@ void DBG_Draw(int programPointer,int dataPointer,int breakPoint)
     for (i = 0;i < 8;i++)
         DBG_PrintHex(1,i+16,(dataPointer+i*8) & 0xFFFF,2,4);
     for (i = 0;i < 64;i++)
-        DBG_PrintHex(i % 8 * 3 + 7,i/8+16,CPU_ReadMemory((i+dataPointer) & 0xFFFF),3,2);
+        DBG_PrintHex(i % 8 * 3 + 7,i/8+16,CPU_ReadMemory(cpu,(i+dataPointer) & 0xFFFF),3,2);
 
     i = 0;
     while (i < 10)
@@ -64,17 +76,17 @@ void DBG_Draw(int programPointer,int dataPointer,int breakPoint)
         int isHome = (programPointer == s.R[s.P]);
         DBG_PrintHex(0,i,programPointer,isHome ? 3 : 2,4);
         if (programPointer == breakPoint) DBG_PrintString(4,i,"*",6);
-        strcpy(buffer,_mnemonics[CPU_ReadMemory(programPointer++)]);
+        strcpy(buffer,_mnemonics[CPU_ReadMemory(cpu,programPointer++)]);
         if (buffer[strlen(buffer)-2] == '.')
         {
             if (buffer[strlen(buffer)-1] == '1')
             {
-                sprintf(buffer+strlen(buffer)-2,"%02x",CPU_ReadMemory(programPointer));
+                sprintf(buffer+strlen(buffer)-2,"%02x",CPU_ReadMemory(cpu,programPointer));
                 programPointer = (programPointer+1) & 0xFFFF;
             }
             else
             {
-                sprintf(buffer+strlen(buffer)-2,"%02x%02x",CPU_ReadMemory(programPointer),CPU_ReadMemory((programPointer+1) & 0xFFFF));
+                sprintf(buffer+strlen(buffer)-2,"%02x%02x",CPU_ReadMemory(cpu,programPointer),CPU_ReadMemory(cpu,(programPointer+1) & 0xFFFF));
                 programPointer = (programPointer+2) & 0xFFFF;
             }
         }
@@ -82,7 +94,7 @@ void DBG_Draw(int programPointer,int dataPointer,int breakPoint)
         DBG_PrintString(5,i,buffer,isHome ? 3 : 2);
         i++;
     }
-    IF_DisplayScreen(TRUE,CPU_GetScreenMemoryAddress(),CPU_GetScreenScrollOffset());
+    IF_DisplayScreen(TRUE,CPU_GetScreenMemoryAddress(cpu));
 }
 
 //*******************************************************************************************************
@@ -12,6 +12,8 @@
 #ifndef _DEBUGSCREEN_H
 #define _DEBUGSCREEN_H
 
-void DBG_Draw(int programPointer,int dataPointer,int breakPoint);
+#include "cpu.h"
+
+void DBG_Draw(CPU1802MACHINE *cpu,int programPointer,int dataPointer,int breakPoint);
 
 #endif // _DEBUGSCREEN_H
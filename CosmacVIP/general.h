@@ -12,13 +12,19 @@
 #ifndef _GENERAL_H
 #define _GENERAL_H
 
-//*******************************************************************************************************
-//                  Uncomment ONE of these to define what system is being built
 //*******************************************************************************************************
+//      Systems that can be emulated. Which one is picked when it starts (see main.c), uncomment ONE
+//      of these to choose what it runs if not told.
+//*******************************************************************************************************
+
+#define MACHINE_ELF         (0)
+#define MACHINE_COSMACVIP   (1)
+#define MACHINE_STUDIO2     (2)
+#define MACHINE_COUNT       (3)
 
-//#define IS_ELF                                                                    // Choose your poison :)
-//#define IS_COSMACVIP
-#define IS_STUDIO2
+//#define DEFAULT_MACHINE   MACHINE_ELF                                             // Choose your poison :)
+//#define DEFAULT_MACHINE   MACHINE_COSMACVIP
+#define DEFAULT_MACHINE     MACHINE_STUDIO2
 
 //#define COSMAC_BOOTS_MONITOR                                                      // If this is defined forces VIP to boot monitor
                                                                                     // whether C is pressed or not.
@@ -31,6 +37,25 @@ typedef signed short INT16;
 #define FALSE       (0)                                                             // Boolean type
 #define TRUE        (!(FALSE))
 
+#if defined(__GNUC__) && !defined(ARDUINO_VERSION)                                  // Keep each machine context on its own cache line(s)
+#define CACHE_ALIGNED   __attribute__((aligned(64)))                                // so many machines can run without false sharing.
+#define THREADED_DISPATCH                                                           // Use the computed goto (labels as values) core.
+#define BLOCK_CACHE                                                                 // Run predecoded blocks rather than fetching each time.
+#ifdef BLOCK_CACHE
+#define STATIC_ROM                                                                  // Run the built in ROMs as C compiled ahead of time.
+#endif
+#ifdef STATIC_ROM                                                                   // (each core only keeps the ones for its machine)
+#define CHIP8_HLE                                                                   // Run CHIP-8 instructions natively (CPU_SetChip8() turns it on)
+#define STUDIO2_HLE                                                                 // Run BIOS instructions natively (CPU_SetStudio2() turns it on)
+#define ROUTINE_HOOKS                                                               // Run hot ROM routines natively (CPU_SetHooks() turns it on)
+#endif
+#if defined(__x86_64__) && defined(BLOCK_CACHE)
+#define JIT_X86_64                                                                  // Translate hot blocks to x86-64 (CPU_SetJit() turns it on)
+#endif
+#else
+#define CACHE_ALIGNED
+#endif
+
 #ifndef ARDUINO_VERSION                                                             // The arduino version doesn't need the CPU state
 #define CPUSTATECODE                                                                // access stuff, which is for the debugger.
 #endif
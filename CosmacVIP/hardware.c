@@ -11,7 +11,10 @@
 
 #include <stdlib.h>
 #include <ctype.h>
+#include <string.h>
 #include "hardware.h"
+#include "cpu.h"
+#include "pace.h"
 
 #ifdef __APPLE__
 #include <SDL/SDL.h>
@@ -25,9 +28,41 @@
 #define BEEPFREQUENCY   (2000)
 
 static SDL_Surface *screen;                                                             // Screen used for rendering
-static BOOL keyStatus[128];                                                             // Status of Keys.
+static Uint32 keyBits[128/32];                                                          // A bit for each key down.
 static BOOL isSoundOn = FALSE;                                                          // Sound status.
+static BOOL soundQ = FALSE;                                                             // Q as the machine last set it.
 static int cyclePos;                                                                    // Position in wave cycle.
+
+static Uint32 pixelTable[256][8];                                                       // Each display byte as 8 pixels
+static BYTE8 shownFrame[CPU_DISPLAY_LINES*CPU_DISPLAY_BYTES];                           // Display as last drawn
+static BOOL shownOff;                                                                   // and whether it was off,
+static BOOL shownDebug;                                                                 // in the debugger.
+static BOOL mustDraw = TRUE;                                                            // Display erased, draw it anyway
+static BOOL mustFlip = TRUE;                                                            // Something drawn to show
+static long long drawTime = 0;                                                          // Time this frame took to draw (ns)
+static long renderTime = 0;                                                             // and on average, shown as well
+static Uint32 videoThread;                                                              // Thread that owns the video
+
+// The machine runs on a thread of its own, and this one only shows what it has done. Each frame is
+// passed over in a triple buffer. The machine fills the back one and swaps it with the middle one,
+// and this thread swaps the middle one with the front one to show it. The swaps are single atomic
+// exchanges, so neither thread ever waits for the other. A frame not taken in time is replaced by
+// the next one. The keys come back the other way, as bits set and cleared atomically.
+
+typedef struct _IF_FRAME
+{
+    BYTE8 display[CPU_DISPLAY_LINES*CPU_DISPLAY_BYTES];                                 // Lines the 1861 fetched,
+    BOOL isOn;                                                                          // if the display was on,
+    BOOL q;                                                                             // and Q (the sound) at the end
+} IFFRAME;
+
+#define FRAME_NEW       (4)                                                             // Middle frame not yet shown
+
+static IFFRAME frames[3];
+static int frameBack = 0;                                                               // Being filled by the machine,
+static int frameMiddle = 1;                                                             // passed over (| FRAME_NEW),
+static int frameFront = 2;                                                              // and being shown.
+static BOOL publishedQ = FALSE;                                                         // Q in the last one passed over
 
 static SDLKey keyConvert[] = {                                                          // Known keyboard keys.
     SDLK_0,SDLK_1,SDLK_2,SDLK_3,SDLK_4,SDLK_5,SDLK_6,SDLK_7,                            // 0-9 : 0-9
@@ -38,6 +73,7 @@ static SDLKey keyConvert[] = {
 };
 
 static void audioCallback(void *_beeper, Uint8 *_stream, int _length);
+static void IF_Sound(BOOL isOn);
 
 //*******************************************************************************************************
 //                          Initialise the Interface Layer
@@ -46,29 +82,36 @@ static void audioCallback(void *_beeper, Uint8 *_stream, int _length);
 #define WIDTH   (1024)
 #define HEIGHT  (768)
 
-void IF_Initialise(void)
+void IF_Initialise(BYTE8 machine)
 {
     int i;
     if (SDL_Init(SDL_INIT_VIDEO||SDL_INIT_AUDIO)<0)                                     // Initialise SDL
         exit(printf( "Unable to init SDL: %s\n", SDL_GetError() ));
     atexit(IF_Terminate);                                                               // Call terminate on the way out.
 
-    if (SDL_SetVideoMode(WIDTH, HEIGHT, 32,SDL_HWSURFACE|SDL_DOUBLEBUF) < 0)                 // Set Screen Mode
+    if (SDL_SetVideoMode(WIDTH, HEIGHT, 32,SDL_SWSURFACE) < 0)                          // Set Screen Mode
         exit(printf("Unable to set video: %s\n", SDL_GetError()));
 
-    screen = SDL_SetVideoMode(WIDTH, HEIGHT, 32, SDL_HWSURFACE|SDL_DOUBLEBUF);               // Create drawing surface
-    if ( !screen )
+    screen = SDL_SetVideoMode(WIDTH, HEIGHT, 32, SDL_SWSURFACE);                        // Create drawing surface, one that
+    if ( !screen )                                                                      // keeps what is drawn on it
         exit(printf("Unable to create buffer: %s\n", SDL_GetError()));
-    #ifdef IS_ELF
-    SDL_WM_SetCaption("Elf + Pixie Emulator",NULL);
-    #endif
-    #ifdef IS_COSMACVIP
-    SDL_WM_SetCaption("RCA Cosmac VIP Emulator",NULL);
-    #endif
-    #ifdef IS_STUDIO2
-    SDL_WM_SetCaption("RCA Studio 2 Emulator",NULL);
-    #endif
-    for (i = 0; i < 128; i++) keyStatus[i] = FALSE;                                     // Reset all key statuses.
+    switch (machine)                                                                    // Caption for the machine emulated
+    {
+        case MACHINE_ELF:
+            SDL_WM_SetCaption("Elf + Pixie Emulator",NULL);
+            break;
+        case MACHINE_COSMACVIP:
+            SDL_WM_SetCaption("RCA Cosmac VIP Emulator",NULL);
+            break;
+        case MACHINE_STUDIO2:
+            SDL_WM_SetCaption("RCA Studio 2 Emulator",NULL);
+            break;
+    }
+    for (i = 0; i < 128/32; i++) keyBits[i] = 0;                                        // Reset all key statuses.
+    videoThread = SDL_ThreadID();
+    Uint32 fgr = SDL_MapRGB(screen->format,255,255,255);                                // Each display byte's pixels
+    Uint32 bgr = SDL_MapRGB(screen->format,0,0,0);
+    for (i = 0;i < 256*8;i++) pixelTable[i/8][i%8] = ((i/8) & (0x80 >> (i%8))) ? fgr : bgr;
     #ifdef SOUND
     SDL_AudioSpec desiredSpec;                                                          // Create an SDL Audio Specification.
     desiredSpec.freq = 44100;
@@ -83,6 +126,19 @@ void IF_Initialise(void)
     #endif
 }
 
+//*******************************************************************************************************
+//                  Set a key's bit, read by the machine's thread (see IF_KeyPressed())
+//*******************************************************************************************************
+
+static void IF_SetKey(int key,BOOL isDown)
+{
+    Uint32 bit = 1U << (key & 31);
+    if (isDown)
+        __atomic_fetch_or(keyBits+key/32,bit,__ATOMIC_RELAXED);
+    else
+        __atomic_fetch_and(keyBits+key/32,~bit,__ATOMIC_RELAXED);
+}
+
 //*******************************************************************************************************
 //                      Render the interface layer - in debug mode, or not
 //*******************************************************************************************************
@@ -100,15 +156,29 @@ BOOL IF_Render(BOOL debugMode)
 
             for (i = 0;i < sizeof(keyConvert)/sizeof(SDLKey);i++)                       // Scan through known keys
                 if (key == keyConvert[i])                                               // If found
-                    keyStatus[i < 10 ? i+'0':i-10+'A'] = (event.type == SDL_KEYDOWN);   // Update status.
+                    IF_SetKey(i < 10 ? i+'0':i-10+'A',event.type == SDL_KEYDOWN);       // Update status.
+            if (key == SDLK_BACKSPACE)                                                  // Backspace is '\b'
+                IF_SetKey('\b',event.type == SDL_KEYDOWN);
+            if (key == SDLK_TAB)                                                        // Tab is '\t'
+                IF_SetKey('\t',event.type == SDL_KEYDOWN);
             if (key == SDLK_ESCAPE)                                                     // Esc key ends program.
                                 quit = TRUE;
 
         } // end switch
     } // end of message processing
 
-    SDL_Flip(screen);                                                                   // Flip screens
-    SDL_FillRect(screen, 0, SDL_MapRGB(screen->format, 0, 0, 64));                      // Erase for next time.
+    if (mustFlip)                                                                       // Show it, if anything was drawn
+    {
+        long long start = PACE_Time();
+        SDL_Flip(screen);
+        if (!shownDebug) renderTime += (long)(drawTime + PACE_Time() - start - renderTime) / 16;
+    }
+    mustFlip = FALSE;drawTime = 0;
+    if (shownDebug)                                                                     // The debugger is drawn afresh
+    {
+        SDL_FillRect(screen, 0, SDL_MapRGB(screen->format, 0, 0, 64));                  // Erase for next time.
+        mustDraw = TRUE;
+    }
     return quit;
 }
 
@@ -120,10 +190,16 @@ void IF_Write(int x,int y,char ch,int colour)
 {
     int xCSize = screen->w / 32;                                                        // Work out character box size.
     int yCSize = screen->h / 24;
-    SDL_Rect rc;
+    SDL_Rect rc;
+    if (!shownDebug)                                                                    // Debugger after the full size display,
+    {
+        SDL_FillRect(screen, 0, SDL_MapRGB(screen->format, 0, 0, 64));                  // erase that first.
+        shownDebug = mustDraw = TRUE;
+    }
     rc.x = xCSize * x;rc.y = yCSize * y;                                                // Erase character background.
     rc.w = xCSize;rc.h = yCSize;
     SDL_FillRect(screen,&rc,SDL_MapRGB(screen->format,0,0,64));
+    mustFlip = TRUE;
     if (ch <= ' ' || ch > 127) return;                                                  // Don't render control and space.
     unsigned char *byteData = fontdata + (int)((ch - ' ') * 5);                         // point to the font data
     int xp,yp,pixel;
@@ -156,12 +232,13 @@ void IF_Terminate(void)
 }
 
 //*******************************************************************************************************
-//                              Check to see if a key is pressed
+//                      Check to see if a key is pressed, from either thread
 //*******************************************************************************************************
 
 BOOL IF_KeyPressed(char ch)
 {
-    return keyStatus[toupper(ch)];
+    int key = toupper(ch) & 127;
+    return (__atomic_load_n(keyBits+key/32,__ATOMIC_RELAXED) >> (key & 31)) & 1;
 }
 
 //*******************************************************************************************************
@@ -170,52 +247,120 @@ BOOL IF_KeyPressed(char ch)
 
 BOOL IF_ShiftPressed(void)
 {
-    return keyStatus['Z'+1] || keyStatus['Z'+2];
+    return IF_KeyPressed('Z'+1) || IF_KeyPressed('Z'+2);
 }
 
+//*******************************************************************************************************
+//      Display the pixel screen. Each line is made into pixels a byte at a time from pixelTable, then
+//      widened to the window and copied down each window line it covers, a line the same as the one
+//      above being copied again. Nothing is drawn if the display is as it was last drawn.
+//*******************************************************************************************************
+
+void IF_DisplayScreen(BOOL isDebugMode,BYTE8 *screenData)
+{
+    int xc,yc,xs,ys,x,y,i,n;
+    Uint32 pixels[64],line[WIDTH],*target;
+    BYTE8 *bytes;
+    SDL_Rect rc;
+    long long start;
+    if (!mustDraw && isDebugMode == shownDebug && (screenData == NULL) == shownOff &&   // Unchanged, so nothing to draw
+            (screenData == NULL || memcmp(screenData,shownFrame,sizeof(shownFrame)) == 0)) return;
+    start = PACE_Time();
+    xc = 0;yc = 0;xs = screen->w / 64;ys = screen->h / CPU_DISPLAY_LINES;               // Main display.
+    if (isDebugMode)                                                                    // Debug display.
+    {
+        xc = screen->w*24/32;yc = 0;xs =(screen->w-xc)/64;                              // Make it fit in space.
+        ys = screen->h*6/24/CPU_DISPLAY_LINES;
+    }
+    shownDebug = isDebugMode;shownOff = (screenData == NULL);
+    mustDraw = FALSE;mustFlip = TRUE;
+    if (screenData == NULL)                                                             // Screen off, erase it.
+    {
+        rc.x = xc;rc.y = yc;rc.w = xs * 64;rc.h = ys*CPU_DISPLAY_LINES;
+        SDL_FillRect(screen,&rc,SDL_MapRGB(screen->format,0,0,0));
+        return;
+    }
+    memcpy(shownFrame,screenData,sizeof(shownFrame));
+    if (SDL_MUSTLOCK(screen) && SDL_LockSurface(screen) < 0) return;
+    for (y = 0;y < CPU_DISPLAY_LINES;y++)                                               // One line at a time, as fetched.
+    {
+        bytes = screenData + y * CPU_DISPLAY_BYTES;
+        if (y == 0 || memcmp(bytes,bytes-CPU_DISPLAY_BYTES,CPU_DISPLAY_BYTES) != 0)     // Not the same as the one above
+        {
+            for (x = 0;x < CPU_DISPLAY_BYTES;x++)                                       // 8 pixels a byte,
+                memcpy(pixels+x*8,pixelTable[bytes[x]],sizeof(pixelTable[0]));
+            for (x = n = 0;x < 64;x++)                                                  // each as wide as a cell.
+            {
+                for (i = 0;i < xs;i++) line[n++] = pixels[x];
+                if (isDebugMode) line[n-1] = pixelTable[0][0];                          // Debug mode show individual cells.
+            }
+        }
+        for (i = 0;i < ys;i++)                                                          // Copy it down the cell.
+        {
+            target = (Uint32 *)((BYTE8 *)screen->pixels + (yc + y * ys + i) * screen->pitch) + xc;
+            memcpy(target,line,n * sizeof(Uint32));
+        }
+    }
+    if (SDL_MUSTLOCK(screen)) SDL_UnlockSurface(screen);
+    drawTime = PACE_Time() - start;
+}
+
+//*******************************************************************************************************
+//      Pass a finished frame to the video thread, from the machine's thread. Nothing is passed over
+//      if neither the display (as far as the caller can tell) nor Q have changed since the last one.
+//*******************************************************************************************************
+
+void IF_PublishScreen(BYTE8 *screenData,BOOL hasChanged)
+{
+    IFFRAME *frame = frames + frameBack;
+    if (!hasChanged && soundQ == publishedQ) return;
+    frame->isOn = (screenData != NULL);
+    if (screenData != NULL) memcpy(frame->display,screenData,sizeof(frame->display));
+    frame->q = publishedQ = soundQ;
+    frameBack = __atomic_exchange_n(&frameMiddle,frameBack | FRAME_NEW,__ATOMIC_ACQ_REL) & 3;
+}
+
+//*******************************************************************************************************
+//      Show the last frame passed over, on the video thread, returning FALSE if there is no new one.
+//      The sound is turned on or off with it.
+//*******************************************************************************************************
+
+BOOL IF_PresentScreen(void)
+{
+    IFFRAME *frame;
+    if ((__atomic_load_n(&frameMiddle,__ATOMIC_ACQUIRE) & FRAME_NEW) == 0) return FALSE;
+    frameFront = __atomic_exchange_n(&frameMiddle,frameFront,__ATOMIC_ACQ_REL) & 3;
+    frame = frames + frameFront;
+    IF_DisplayScreen(FALSE,frame->isOn ? frame->display : NULL);
+    IF_Sound(frame->q);
+    return TRUE;
+}
+
+//*******************************************************************************************************
+//              Average time to draw and show a frame in nanoseconds, of those that changed
+//*******************************************************************************************************
+
+long IF_GetRenderTime(void)
+{
+    return renderTime;
+}
+
 //*******************************************************************************************************
-//                                 Display the pixel screen
+//      Q set by the machine. It goes with the next frame passed over, or happens now if the debugger
+//      is stepping the machine on the video thread.
 //*******************************************************************************************************
 
-void IF_DisplayScreen(BOOL isDebugMode,BYTE8 *screenData,BYTE8 scrollOffset)
+void IF_SetSound(BOOL isOn)
 {
-    int xc,yc,xs,ys,x,y,pixByte;
-    SDL_Rect rc;
-    xc = 0;yc = 0;xs = screen->w / 64;ys = screen->h / 32;                              // Main display.
-    if (isDebugMode)                                                                    // Debug display.
-    {
-        xc = screen->w*24/32;yc = 0;xs =(screen->w-xc)/64;ys = screen->h*6/24/32;       // Make it fit in space.
-    }
-    rc.x = xc;rc.y = yc;rc.w = xs * 64;rc.h = ys*32;                                    // Erase screen display
-    SDL_FillRect(screen,&rc,SDL_MapRGB(screen->format,0,0,0));
-    if (screenData == NULL) return;                                                     // Screen off, exit.
-    Uint32 fgr = SDL_MapRGB(screen->format,255,255,255);                                // Painting colour.
-    rc.w = xs;rc.h = ys;                                                                // Set cell width and height
-    if (isDebugMode) rc.w--,rc.h--;                                                     // Debug mode show individual cells.
-    for (y = 0;y < 32;y++)                                                              // One line at a time.
-    {
-        BYTE8 *pixels = screenData + ((y * 8 + scrollOffset) & 0xFF);                   // Work out where data comes from.
-        rc.y = yc + ys * y;                                                             // Calculate vertical coordinate
-        for (x = 0;x < 8;x++)                                                           // 8 bytes per line.
-        {
-            pixByte = *pixels++;                                                        // Get next pixel.
-            rc.x = xc + x * xs * 8;                                                     // Calculate horizontal coordinate
-            while (pixByte != 0)                                                        // if something to render.
-            {
-                if (pixByte & 0x80) SDL_FillRect(screen,&rc,fgr);                       // if bit 7 set draw pixel
-                pixByte = (pixByte << 1) & 0xFF;                                        // shift to left, lose overflow.
-                rc.x = rc.x + xs;                                                       // next coordinate across.
-            }
-        }
-
-    }
-}
+    soundQ = isOn;
+    if (SDL_ThreadID() == videoThread) IF_Sound(isOn);
+}
 
 //*******************************************************************************************************
 //                                    Control sound.
 //*******************************************************************************************************
 
-void IF_SetSound(BOOL isOn)
+static void IF_Sound(BOOL isOn)
 {
     if (isSoundOn == isOn) return;                                                      // No status change.
     isSoundOn = isOn;                                                                   // Update status
@@ -14,14 +14,17 @@
 #ifndef _HARDWARE_H
 #define _HARDWARE_H
 
-void IF_Initialise(void);
+void IF_Initialise(BYTE8 machine);
 BOOL IF_Render(BOOL debugMode);
 void IF_Terminate(void);
 void IF_Write(int x,int y,char ch,int colour);
 BOOL IF_KeyPressed(char ch);
 BOOL IF_ShiftPressed(void);
-void IF_DisplayScreen(BOOL isDebugMode,BYTE8 *screenData,BYTE8 scrollOffset);
+void IF_DisplayScreen(BOOL isDebugMode,BYTE8 *screenData);
+void IF_PublishScreen(BYTE8 *screenData,BOOL hasChanged);
+BOOL IF_PresentScreen(void);
 void IF_SetSound(BOOL isOn);
-int IF_GetTime(void);
+int IF_GetTime(void);
+long IF_GetRenderTime(void);
 
 #endif
@@ -16,37 +16,108 @@
 #include "general.h"
 #include "cpu.h"
 #include "hardware.h"
+#include "system.h"
 #include "debug.h"
+#include "movie.h"
+
+#ifdef __APPLE__
+#include <SDL/SDL.h>
+#else
+#include <SDL.h>
+#endif
+
+// SDL 1.2 has to be drawn on and read from on the thread that set the video mode, so that is this
+// one, and the machine runs on a thread of its own. This thread keeps the machine while it is in the
+// debugger, which draws straight to the screen. When it is told to run the machine is handed over,
+// and this thread only shows the frames passed back (see IF_PublishScreen()) and reads the keys,
+// until it returns to the debugger and hands the machine back. A slow display then never holds up
+// the machine.
+
+static SDL_sem *runMachine;                                                             // Posted to hand the machine over
+static int running = FALSE;                                                             // Machine is the other thread's
+static int quitting = FALSE;                                                            // Other thread is to finish
 
 //*******************************************************************************************************
-//                                              Main Program
-//*******************************************************************************************************
+//                  The machine's thread, running it each time it is handed over
+//*******************************************************************************************************
 
+static int MAIN_Emulate(void *unused)
+{
+    (void)unused;
+    while (SDL_SemWait(runMachine) == 0 && !__atomic_load_n(&quitting,__ATOMIC_ACQUIRE))
+    {
+        while (!DBG_InDebugMode() && !__atomic_load_n(&quitting,__ATOMIC_ACQUIRE))
+            DBG_Execute();
+        __atomic_store_n(&running,FALSE,__ATOMIC_RELEASE);                              // Hand it back
+    }
+    return 0;
+}
+
+//*******************************************************************************************************
+//                                              Main Program
+//*******************************************************************************************************
+
 int main(int argc,char *argv[])
 {
     BOOL quit = FALSE;
-    IF_Initialise();                                                                    // Initialise the hardware
-    DBG_Reset();
+    BYTE8 machine = DEFAULT_MACHINE;
+    char *movie = NULL;
+    BOOL record = FALSE;
+    SDL_Thread *emulator;
     int i;
-    for (i = 1;i < argc;i++) DBG_LoadFileToAddress(argv[i]);
+    for (i = 1;i < argc;i++)                                                            // -elf -vip or -studio2 picks the machine
+    {
+        if (strcmp(argv[i],"-elf") == 0) machine = MACHINE_ELF;
+        if (strcmp(argv[i],"-vip") == 0) machine = MACHINE_COSMACVIP;
+        if (strcmp(argv[i],"-studio2") == 0) machine = MACHINE_STUDIO2;
+        if (strncmp(argv[i],"-runahead=",10) == 0) DBG_SetRunAhead(atoi(argv[i]+10));  // -runahead=n shows n frames ahead
+        if (strcmp(argv[i],"-turbo") == 0) DBG_SetTurbo(TRUE);                          // -turbo runs flat out
+        if (strncmp(argv[i],"-clock=",7) == 0) DBG_SetClock(atoi(argv[i]+7));           // -clock=n runs the 1802 n times as fast
+        if (strncmp(argv[i],"-record=",8) == 0) { movie = argv[i]+8;record = TRUE; }    // -record=file records the keys
+        if (strncmp(argv[i],"-play=",6) == 0) { movie = argv[i]+6;record = FALSE; }     // -play=file plays them back
+    }
+    IF_Initialise(machine);                                                             // Initialise the hardware
+    SYSTEM_SetMachine(machine);
+    DBG_SetMachine(machine);
+    DBG_Reset();
+    for (i = 1;i < argc;i++)                                                            // Anything else is <file>@<address>
+        if (argv[i][0] != '-') DBG_LoadFileToAddress(argv[i]);
 
     #ifdef LOAD_TEST_STUFF
     #ifndef ARDUINO_VERSION
-    #ifdef IS_COSMACVIP
-    DBG_LoadFileToAddress("../Miscellany/chip8.rom@0");
-    DBG_LoadFileToAddress("../Miscellany/brix.ch8@200");
-    #endif
-    #ifdef IS_ELF
-    DBG_LoadFileToAddress("../Testing/speed.asm.bin@0");
-    #endif
+    if (machine == MACHINE_COSMACVIP)
+    {
+        DBG_LoadFileToAddress("../Miscellany/chip8.rom@0");
+        DBG_LoadFileToAddress("../Miscellany/brix.ch8@200");
+    }
+    if (machine == MACHINE_ELF)
+        DBG_LoadFileToAddress("../Testing/speed.asm.bin@0");
     #endif
     #endif
+    if (movie != NULL) DBG_StartMovie(movie,record);                                    // After loading, it is part of it
 
+    runMachine = SDL_CreateSemaphore(0);                                                // Start the machine's thread
+    emulator = (runMachine != NULL) ? SDL_CreateThread(MAIN_Emulate,NULL) : NULL;
+    if (emulator == NULL) exit(fprintf(stderr,"Cannot start machine thread\n"));
     while (!quit)                                                                       // Keep running till finished.
     {
-        DBG_Execute();
+        if (!__atomic_load_n(&running,__ATOMIC_ACQUIRE))                                // Machine is this thread's
+        {
+            if (DBG_InDebugMode()) DBG_Execute();                                       // so run the debugger,
+            if (!DBG_InDebugMode())                                                     // till told to run it.
+            {
+                __atomic_store_n(&running,TRUE,__ATOMIC_RELEASE);
+                SDL_SemPost(runMachine);
+            }
+        }
+        else if (!IF_PresentScreen()) SDL_Delay(1);                                     // Show its latest frame
         quit = IF_Render(TRUE);
     }
+    __atomic_store_n(&quitting,TRUE,__ATOMIC_RELEASE);                                  // Stop the machine's thread
+    SDL_SemPost(runMachine);
+    SDL_WaitThread(emulator,NULL);
+    SDL_DestroySemaphore(runMachine);
+    MOVIE_Stop();                                                                       // Finish any recording
     IF_Terminate();
     return 0;
 }
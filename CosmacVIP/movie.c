@@ -0,0 +1,310 @@
+//*******************************************************************************************************
+//*******************************************************************************************************
+//
+//      Name:       Movie.C
+//      Purpose:    Input movie recording and playback
+//      Date:       17th October 2026
+//
+//*******************************************************************************************************
+//*******************************************************************************************************
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "general.h"
+#include "cpu.h"
+#include "hardware.h"
+#include "movie.h"
+
+// A movie is the machine as it was when recording started (see CPU_SaveState()), then every change to
+// the keys it can read, each against the frame it happened on, counted by the host syncs. Resets are
+// recorded the same way. While recording or playing the machine only sees the keys as they were at
+// the start of the frame, so a recording plays back exactly, and playback does not wait for the
+// frame time so it runs as fast as the host can.
+//
+// The file is "CMOV", the version and machine, the size of the saved machine and the saved machine,
+// then the events, each a four byte frame number (low byte first), the event type and the keys.
+
+#define MOVIE_VERSION   (1)                                                         // Bumped when the format changes
+
+#define KEY_COUNT       (36)                                                        // 0-9 and A-Z
+#define KEY_BYTES       ((KEY_COUNT+7)/8)                                           // as a bit each
+
+#define EVENT_KEYS      (0)                                                         // Keys changed
+#define EVENT_RESET     (1)                                                         // Machine reset after this frame
+#define EVENT_END       (2)                                                         // Recording stopped
+
+#define MODE_OFF        (0)
+#define MODE_RECORD     (1)
+#define MODE_PLAY       (2)
+#define MODE_ENDED      (3)                                                         // Played back, keys held to the frame end
+
+static BYTE8 mode = MODE_OFF;                                                       // What it is doing
+static FILE *movieFile = NULL;                                                      // to this file
+static unsigned long frame;                                                         // Frames since it started
+static BYTE8 keys[KEY_BYTES];                                                       // Keys down this frame
+static BOOL resetDue;                                                               // Played back reset to do
+
+static BOOL haveNext;                                                               // Next event to play back
+static unsigned long nextFrame;
+static BYTE8 nextType;
+static BYTE8 nextKeys[KEY_BYTES];
+
+//*******************************************************************************************************
+//                                  Write and read a four byte number
+//*******************************************************************************************************
+
+static void MOVIE_WriteLong(unsigned long n)
+{
+    int i;
+    for (i = 0;i < 4;i++) fputc((int)((n >> (i*8)) & 0xFF),movieFile);
+}
+
+static BOOL MOVIE_ReadLong(unsigned long *n)
+{
+    int i,c;
+    *n = 0;
+    for (i = 0;i < 4;i++)
+    {
+        if ((c = fgetc(movieFile)) == EOF) return FALSE;
+        *n |= (unsigned long)c << (i*8);
+    }
+    return TRUE;
+}
+
+//*******************************************************************************************************
+//                                      Write an event at this frame
+//*******************************************************************************************************
+
+static void MOVIE_WriteEvent(BYTE8 type)
+{
+    MOVIE_WriteLong(frame);
+    fputc(type,movieFile);
+    fwrite(keys,1,KEY_BYTES,movieFile);
+}
+
+//*******************************************************************************************************
+//                          Read the next event to play back, haveNext is FALSE if none
+//*******************************************************************************************************
+
+static void MOVIE_ReadEvent(void)
+{
+    int type;
+    haveNext = MOVIE_ReadLong(&nextFrame) && (type = fgetc(movieFile)) != EOF &&
+                                        fread(nextKeys,1,KEY_BYTES,movieFile) == KEY_BYTES;
+    if (haveNext) nextType = (BYTE8)type;
+}
+
+//*******************************************************************************************************
+//                              Read the host's keys into keys[], TRUE if changed
+//*******************************************************************************************************
+
+static BOOL MOVIE_SampleKeys(void)
+{
+    BYTE8 now[KEY_BYTES];
+    int i;
+    memset(now,0,sizeof(now));
+    for (i = 0;i < KEY_COUNT;i++)
+        if (IF_KeyPressed((char)(i < 10 ? '0'+i : 'A'+i-10))) now[i >> 3] |= (1 << (i & 7));
+    if (memcmp(now,keys,KEY_BYTES) == 0) return FALSE;
+    memcpy(keys,now,KEY_BYTES);
+    return TRUE;
+}
+
+//*******************************************************************************************************
+//      Play back the events up to this frame. At the end of the movie the keys are kept till the next
+//      frame end, as the keypad is scanned after the sync, then it goes back to the host's keys.
+//*******************************************************************************************************
+
+static void MOVIE_PlayEvents(void)
+{
+    while (mode == MODE_PLAY && haveNext && nextFrame <= frame)
+    {
+        switch (nextType)
+        {
+            case EVENT_KEYS:
+                memcpy(keys,nextKeys,KEY_BYTES);
+                break;
+            case EVENT_RESET:
+                resetDue = TRUE;
+                break;
+            case EVENT_END:
+                haveNext = FALSE;
+                break;
+        }
+        if (haveNext) MOVIE_ReadEvent();
+    }
+    if (mode == MODE_PLAY && !haveNext)                                             // Ended, or cut short
+    {
+        fclose(movieFile);
+        movieFile = NULL;
+        mode = MODE_ENDED;
+    }
+}
+
+//*******************************************************************************************************
+//      Start recording to a file, from the machine as it is now. FALSE if the file cannot be written.
+//*******************************************************************************************************
+
+BOOL MOVIE_Record(const char *fileName,CPU1802MACHINE *cpu)
+{
+    long size = CPU_StateSize(cpu);
+    BYTE8 *state = (BYTE8 *)malloc(size);
+    MOVIE_Stop();
+    if (state == NULL) return FALSE;
+    movieFile = fopen(fileName,"wb");
+    if (movieFile == NULL)
+    {
+        free(state);
+        return FALSE;
+    }
+    CPU_SaveState(cpu,state,size);
+    fwrite("CMOV",1,4,movieFile);
+    fputc(MOVIE_VERSION,movieFile);
+    fputc(CPU_GetMachine(cpu),movieFile);
+    MOVIE_WriteLong(size);
+    fwrite(state,1,size,movieFile);
+    free(state);
+    mode = MODE_RECORD;
+    frame = 0;
+    resetDue = FALSE;
+    memset(keys,0,KEY_BYTES);
+    MOVIE_SampleKeys();
+    MOVIE_WriteEvent(EVENT_KEYS);                                                   // Keys it starts with
+    return TRUE;
+}
+
+//*******************************************************************************************************
+//      Start playing a file back, putting the machine back as it was when it was recorded. FALSE if
+//      it cannot be read or was recorded from another machine or build.
+//*******************************************************************************************************
+
+BOOL MOVIE_Play(const char *fileName,CPU1802MACHINE *cpu)
+{
+    char magic[4];
+    unsigned long size;
+    BYTE8 *state = NULL;
+    BOOL ok;
+    MOVIE_Stop();
+    movieFile = fopen(fileName,"rb");
+    if (movieFile == NULL) return FALSE;
+    ok = fread(magic,1,4,movieFile) == 4 && memcmp(magic,"CMOV",4) == 0 &&
+            fgetc(movieFile) == MOVIE_VERSION && fgetc(movieFile) == CPU_GetMachine(cpu) &&
+            MOVIE_ReadLong(&size) && size == (unsigned long)CPU_StateSize(cpu);
+    if (ok) ok = (state = (BYTE8 *)malloc(size)) != NULL;
+    if (ok) ok = fread(state,1,size,movieFile) == size && CPU_LoadState(cpu,state,size);
+    free(state);
+    if (!ok)
+    {
+        fclose(movieFile);
+        movieFile = NULL;
+        return FALSE;
+    }
+    mode = MODE_PLAY;
+    frame = 0;
+    resetDue = FALSE;
+    memset(keys,0,KEY_BYTES);
+    MOVIE_ReadEvent();
+    MOVIE_PlayEvents();                                                             // Keys it starts with
+    return TRUE;
+}
+
+//*******************************************************************************************************
+//                          Stop recording or playing, the host's keys are used again
+//*******************************************************************************************************
+
+void MOVIE_Stop(void)
+{
+    if (mode == MODE_RECORD) MOVIE_WriteEvent(EVENT_END);
+    if (movieFile != NULL) fclose(movieFile);
+    movieFile = NULL;
+    mode = MODE_OFF;
+}
+
+//*******************************************************************************************************
+//                              Recording or playing, and how far it has got
+//*******************************************************************************************************
+
+BOOL MOVIE_Active(void)
+{
+    return mode != MODE_OFF;
+}
+
+BOOL MOVIE_Playing(void)
+{
+    return mode == MODE_PLAY;
+}
+
+unsigned long MOVIE_FrameCount(void)
+{
+    return frame;
+}
+
+//*******************************************************************************************************
+//      Is a key down, as the machine sees it. When recording or playing only 0-9 and A-Z are seen,
+//      as they were at the start of the frame.
+//*******************************************************************************************************
+
+BOOL MOVIE_KeyPressed(char ch)
+{
+    int n;
+    if (mode == MODE_OFF) return IF_KeyPressed(ch);
+    ch = toupper(ch);
+    if (ch >= '0' && ch <= '9') n = ch - '0';
+    else if (ch >= 'A' && ch <= 'Z') n = ch - 'A' + 10;
+    else return FALSE;
+    return (keys[n >> 3] & (1 << (n & 7))) != 0;
+}
+
+//*******************************************************************************************************
+//      A frame has ended (HWC_FRAMESYNC). Record the keys if they have changed, or play back the
+//      next frame's. Returns TRUE if playing back, when the host should not wait for the frame time.
+//*******************************************************************************************************
+
+BOOL MOVIE_Frame(void)
+{
+    if (mode == MODE_OFF) return FALSE;
+    if (mode == MODE_ENDED)
+    {
+        MOVIE_Stop();
+        return FALSE;
+    }
+    frame++;
+    if (mode == MODE_RECORD)
+    {
+        if (MOVIE_SampleKeys()) MOVIE_WriteEvent(EVENT_KEYS);
+        return FALSE;
+    }
+    MOVIE_PlayEvents();
+    return TRUE;
+}
+
+//*******************************************************************************************************
+//          The machine is being reset (see DBG_Reset()), which is recorded against this frame
+//*******************************************************************************************************
+
+void MOVIE_Reset(void)
+{
+    if (mode == MODE_RECORD) MOVIE_WriteEvent(EVENT_RESET);
+}
+
+//*******************************************************************************************************
+//                  TRUE once if a played back reset is due, the caller then does it
+//*******************************************************************************************************
+
+BOOL MOVIE_ResetDue(void)
+{
+    BOOL due = resetDue;
+    resetDue = FALSE;
+    return due;
+}
+
+//*******************************************************************************************************
+//          TRUE if a played back reset is due, without taking it, so frames are not run past it
+//*******************************************************************************************************
+
+BOOL MOVIE_ResetPending(void)
+{
+    return resetDue;
+}
@@ -0,0 +1,28 @@
+//*******************************************************************************************************
+//*******************************************************************************************************
+//
+//      Name:       Movie.H
+//      Purpose:    Input movie recording and playback header
+//      Date:       17th October 2026
+//
+//*******************************************************************************************************
+//*******************************************************************************************************
+
+#ifndef _MOVIE_H
+#define _MOVIE_H
+
+#include "cpu.h"
+
+BOOL MOVIE_Record(const char *fileName,CPU1802MACHINE *cpu);
+BOOL MOVIE_Play(const char *fileName,CPU1802MACHINE *cpu);
+void MOVIE_Stop(void);
+BOOL MOVIE_Active(void);
+BOOL MOVIE_Playing(void);
+unsigned long MOVIE_FrameCount(void);
+BOOL MOVIE_KeyPressed(char ch);
+BOOL MOVIE_Frame(void);
+void MOVIE_Reset(void);
+BOOL MOVIE_ResetDue(void);
+BOOL MOVIE_ResetPending(void);
+
+#endif // _MOVIE_H
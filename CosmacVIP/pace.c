@@ -0,0 +1,167 @@
+//*******************************************************************************************************
+//*******************************************************************************************************
+//
+//      Name:       Pace.C
+//      Purpose:    Frame pacing, keeping the frames to the 1861's 60Hz without using up the host
+//      Date:       17th October 2026
+//
+//*******************************************************************************************************
+//*******************************************************************************************************
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+#include "general.h"
+#include "pace.h"
+
+// Each frame end is due at a fixed time from when pacing started, worked out from the frame count, so
+// rounding never builds up and the rate is the 1861's and not the nearest whole millisecond. Most of
+// the wait is spent asleep, and only the last part spun, as the host wakes up late by some amount.
+// How late each frame actually ends is kept as the jitter. If the host falls too far behind (or the
+// frames stop, in the debugger) it starts again from now rather than rushing to catch up.
+//
+// Frames that end over a frame late are not drawn (see PACE_Skip()), a few at a time, so the machine
+// catches up with the time. In turbo there is no waiting at all and frames are only drawn as often as
+// the host's display would show them, the more frames the host can run the more are skipped.
+
+#define FRAME_RATE      (60)                                                        // 3668 cycles at 220,080 a second
+#define NS_PER_SECOND   (1000000000LL)
+#define MAX_BEHIND      (4)                                                         // Frames late before starting again
+#define MAX_SKIP        (3)                                                         // Frames skipped in a row to catch up
+#define DISPLAY_RATE    (60)                                                        // Frames drawn a second in turbo
+#ifdef _WIN32
+#define SPIN_NS         (2000000LL)                                                 // Spun for the last of the wait, as
+#else                                                                               // the host sleeps longer than asked.
+#define SPIN_NS         (1000000LL)
+#endif
+
+static BOOL started = FALSE;                                                        // Pacing from start,
+static long long start;
+static unsigned long frame;                                                         // frames since then.
+static PACESTATS stats;
+static BOOL turbo = FALSE;                                                          // Running flat out
+static BOOL behind = FALSE;                                                         // Last frame ended a frame late
+static int skipRun = 0;                                                             // Frames skipped in a row
+static long long lastDrawn;                                                         // When a frame was last drawn (turbo)
+
+//*******************************************************************************************************
+//                              Host's monotonic clock in nanoseconds
+//*******************************************************************************************************
+
+long long PACE_Time(void)
+{
+    #ifdef _WIN32
+    static LARGE_INTEGER frequency;
+    LARGE_INTEGER count;
+    if (frequency.QuadPart == 0) QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&count);
+    return (long long)((double)count.QuadPart * NS_PER_SECOND / frequency.QuadPart);
+    #else
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC,&t);
+    return (long long)t.tv_sec * NS_PER_SECOND + t.tv_nsec;
+    #endif
+}
+
+//*******************************************************************************************************
+//                                  Sleep for about this many nanoseconds
+//*******************************************************************************************************
+
+static void PACE_Sleep(long long ns)
+{
+    #ifdef _WIN32
+    Sleep((DWORD)(ns / 1000000));
+    #else
+    struct timespec t;
+    t.tv_sec = ns / NS_PER_SECOND;
+    t.tv_nsec = ns % NS_PER_SECOND;
+    nanosleep(&t,NULL);
+    #endif
+}
+
+//*******************************************************************************************************
+//              Start pacing again from now, the next frame ends a frame's time from now
+//*******************************************************************************************************
+
+void PACE_Reset(void)
+{
+    started = TRUE;
+    start = PACE_Time();
+    frame = 0;
+}
+
+//*******************************************************************************************************
+//                          Wait for the end of the frame (HWC_FRAMESYNC)
+//*******************************************************************************************************
+
+void PACE_Wait(void)
+{
+    long long due,now,late;
+    if (turbo) return;
+    if (!started) PACE_Reset();
+    frame++;
+    due = start + (long long)frame * NS_PER_SECOND / FRAME_RATE;
+    now = PACE_Time();
+    if (due - now > SPIN_NS) PACE_Sleep(due - now - SPIN_NS);                       // Sleep for most of it
+    while ((now = PACE_Time()) < due) {}                                             // and spin for the rest.
+    late = now - due;
+    if (late > MAX_BEHIND * NS_PER_SECOND / FRAME_RATE)                             // Too far behind to catch up
+    {
+        PACE_Reset();
+        stats.resyncs++;
+        return;
+    }
+    stats.frames++;
+    behind = (late > NS_PER_SECOND / FRAME_RATE);
+    stats.lastLate = (long)late;
+    if (stats.lastLate > stats.worstLate) stats.worstLate = stats.lastLate;
+    stats.averageLate += (stats.lastLate - stats.averageLate) / 16;                 // Running average of the last few
+}
+
+//*******************************************************************************************************
+//          Run flat out, or back to 60Hz from now. Frames have no time while in turbo.
+//*******************************************************************************************************
+
+void PACE_SetTurbo(BOOL isTurbo)
+{
+    if (isTurbo == turbo) return;
+    turbo = isTurbo;
+    lastDrawn = PACE_Time();
+    if (!turbo) PACE_Reset();
+}
+
+//*******************************************************************************************************
+//      Called at each frame end, TRUE if the frame is not to be drawn as the host has fallen behind,
+//      or in turbo if one has been drawn in the last display frame.
+//*******************************************************************************************************
+
+BOOL PACE_Skip(void)
+{
+    BOOL skip;
+    long long now;
+    if (turbo)
+    {
+        now = PACE_Time();
+        skip = (now - lastDrawn < NS_PER_SECOND / DISPLAY_RATE);
+        if (!skip) lastDrawn = now;
+    }
+    else
+    {
+        skip = behind && skipRun < MAX_SKIP;
+        behind = FALSE;
+    }
+    skipRun = skip ? skipRun + 1 : 0;
+    if (skip) stats.skipped++;
+    return skip;
+}
+
+//*******************************************************************************************************
+//                                      How well it is keeping time
+//*******************************************************************************************************
+
+void PACE_GetStats(PACESTATS *s)
+{
+    *s = stats;
+}
@@ -0,0 +1,31 @@
+//*******************************************************************************************************
+//*******************************************************************************************************
+//
+//      Name:       Pace.H
+//      Purpose:    Frame pacing header
+//      Date:       17th October 2026
+//
+//*******************************************************************************************************
+//*******************************************************************************************************
+
+#ifndef _PACE_H
+#define _PACE_H
+
+typedef struct _PACE_STATS
+{
+    unsigned long frames;                                                           // Frames waited for
+    long lastLate;                                                                  // How late the last one was (ns)
+    long worstLate;                                                                 // the latest one
+    long averageLate;                                                               // and on average
+    unsigned long resyncs;                                                          // Times it fell too far behind
+    unsigned long skipped;                                                          // Frames not drawn
+} PACESTATS;
+
+void PACE_Reset(void);
+void PACE_Wait(void);
+void PACE_GetStats(PACESTATS *stats);
+void PACE_SetTurbo(BOOL isTurbo);
+BOOL PACE_Skip(void);
+long long PACE_Time(void);
+
+#endif // _PACE_H
@@ -0,0 +1,219 @@
+//*******************************************************************************************************
+//*******************************************************************************************************
+//
+//      Name:       Rewind.C
+//      Purpose:    Rewind buffer, the machine saved at each frame end so play can be stepped back
+//      Date:       17th October 2026
+//
+//*******************************************************************************************************
+//*******************************************************************************************************
+
+#include <stdlib.h>
+#include <string.h>
+#include "general.h"
+#include "cpu.h"
+#include "rewind.h"
+
+// The last frame recorded is kept whole (see CPU_SaveState()). Each frame before it is kept as the
+// difference from the one after, the two XORed together and the runs of zeros squashed, which is
+// small as little of the machine changes in a frame. Applying a difference to the whole frame gives
+// the one before, which becomes the whole frame, so stepping back costs one difference each time.
+//
+// The differences go in a ring of budget bytes, one after another, starting again at the front when
+// the next will not fit at the end. The oldest are dropped to make room, so it always holds as many of
+// the latest frames as the budget allows.
+
+typedef struct _REWIND_ENTRY
+{
+    long offset;                                                                    // Where the difference is in the ring
+    long size;                                                                      // and its size in bytes
+} REWINDENTRY;
+
+struct _REWIND_BUFFER
+{
+    CPU1802MACHINE *cpu;                                                            // Machine it records
+    long stateSize;                                                                 // Bytes in a saved machine
+    BYTE8 *current;                                                                 // Last frame recorded, whole
+    BYTE8 *next;                                                                    // Frame being recorded
+    BYTE8 *delta;                                                                   // Difference being made
+    BOOL haveCurrent;                                                               // Something is in current
+    BYTE8 *ring;                                                                    // Differences, oldest first
+    long ringSize;
+    long head;                                                                      // Where the next one goes
+    REWINDENTRY *entry;                                                             // Each difference in the ring,
+    int maxEntries;                                                                 // a ring of its own.
+    int first;                                                                      // Oldest
+    int count;                                                                      // and how many
+};
+
+#define RUN_MAX     (255)                                                           // Longest run in a difference
+#define DELTA_MAX(n)    (3 * ((n) + 1) / 2 + 2)                                     // Largest difference of n bytes, when
+                                                                                    // they alternate same and not (2 -> 3)
+
+//*******************************************************************************************************
+//      Make a rewind buffer for a machine, keeping up to budget bytes of differences. NULL if there
+//      is not the memory.
+//*******************************************************************************************************
+
+REWINDBUFFER *REWIND_Create(CPU1802MACHINE *cpu,long budget)
+{
+    REWINDBUFFER *rw = (REWINDBUFFER *)calloc(1,sizeof(REWINDBUFFER));
+    if (rw == NULL) return NULL;
+    rw->cpu = cpu;
+    rw->stateSize = CPU_StateSize(cpu);
+    rw->ringSize = budget;
+    rw->maxEntries = budget / 64 + 1;                                               // Differences are rarely smaller
+    rw->current = (BYTE8 *)malloc(rw->stateSize);
+    rw->next = (BYTE8 *)malloc(rw->stateSize);
+    rw->delta = (BYTE8 *)malloc(DELTA_MAX(rw->stateSize));
+    rw->ring = (BYTE8 *)malloc(rw->ringSize);
+    rw->entry = (REWINDENTRY *)malloc(rw->maxEntries * sizeof(REWINDENTRY));
+    if (rw->current == NULL || rw->next == NULL || rw->delta == NULL || rw->ring == NULL || rw->entry == NULL)
+    {
+        REWIND_Destroy(rw);
+        return NULL;
+    }
+    return rw;
+}
+
+//*******************************************************************************************************
+//                                          Release a rewind buffer
+//*******************************************************************************************************
+
+void REWIND_Destroy(REWINDBUFFER *rw)
+{
+    if (rw == NULL) return;
+    free(rw->current);free(rw->next);free(rw->delta);free(rw->ring);free(rw->entry);
+    free(rw);
+}
+
+//*******************************************************************************************************
+//          Forget everything recorded, for when the machine jumps (a reset or a loaded state)
+//*******************************************************************************************************
+
+void REWIND_Clear(REWINDBUFFER *rw)
+{
+    rw->haveCurrent = FALSE;
+    rw->head = rw->first = rw->count = 0;
+}
+
+//*******************************************************************************************************
+//      XOR a and b into delta as pairs of counts, a run of zero bytes then a run of bytes that are
+//      not, followed by those bytes. Returns its size.
+//*******************************************************************************************************
+
+static long REWIND_Encode(const BYTE8 *a,const BYTE8 *b,long size,BYTE8 *delta)
+{
+    long i = 0,out = 0,count;
+    BYTE8 *runSize;
+    while (i < size)
+    {
+        count = 0;                                                                  // Run of bytes the same
+        while (i < size && count < RUN_MAX && a[i] == b[i]) { i++;count++; }
+        delta[out++] = (BYTE8)count;
+        runSize = delta + out++;                                                    // then a run that differ
+        count = 0;
+        while (i < size && count < RUN_MAX && a[i] != b[i]) { delta[out++] = a[i] ^ b[i];i++;count++; }
+        *runSize = (BYTE8)count;
+    }
+    return out;
+}
+
+//*******************************************************************************************************
+//                          XOR a difference made by REWIND_Encode() into state
+//*******************************************************************************************************
+
+static void REWIND_Apply(BYTE8 *state,const BYTE8 *delta,long size)
+{
+    const BYTE8 *end = delta + size;
+    int count;
+    while (delta < end)
+    {
+        state += *delta++;
+        count = *delta++;
+        while (count-- > 0) *state++ ^= *delta++;
+    }
+}
+
+//*******************************************************************************************************
+//                                      Drop the oldest difference
+//*******************************************************************************************************
+
+static void REWIND_DropOldest(REWINDBUFFER *rw)
+{
+    rw->first = (rw->first + 1) % rw->maxEntries;
+    rw->count--;
+}
+
+//*******************************************************************************************************
+//      Put a difference in the ring after the newest, dropping the oldest ones where it goes. If it
+//      is bigger than the whole ring, nothing before it can be kept.
+//*******************************************************************************************************
+
+static void REWIND_Push(REWINDBUFFER *rw,const BYTE8 *delta,long size)
+{
+    REWINDENTRY *e;
+    long at = rw->head;
+    if (size > rw->ringSize)
+    {
+        REWIND_Clear(rw);
+        return;
+    }
+    if (at + size > rw->ringSize)                                                   // Will not fit at the end,
+    {
+        while (rw->count > 0 && rw->entry[rw->first].offset >= rw->head)            // so those past the newest go
+            REWIND_DropOldest(rw);
+        at = 0;                                                                     // and it starts at the front.
+    }
+    while (rw->count > 0)                                                           // Drop any in the way.
+    {
+        e = &rw->entry[rw->first];
+        if (e->offset >= at + size || e->offset + e->size <= at) break;
+        REWIND_DropOldest(rw);
+    }
+    if (rw->count == rw->maxEntries) REWIND_DropOldest(rw);
+    e = &rw->entry[(rw->first + rw->count) % rw->maxEntries];
+    e->offset = at;e->size = size;
+    memcpy(rw->ring + at,delta,size);
+    rw->count++;
+    rw->head = at + size;
+}
+
+//*******************************************************************************************************
+//      Record the machine as it is now, at the end of a frame (when CPU_Run() returns CPU_STOP_FRAME)
+//*******************************************************************************************************
+
+void REWIND_Record(REWINDBUFFER *rw)
+{
+    BYTE8 *swap;
+    CPU_SaveState(rw->cpu,rw->next,rw->stateSize);
+    if (rw->haveCurrent)                                                            // Keep the last one as a difference
+        REWIND_Push(rw,rw->delta,REWIND_Encode(rw->current,rw->next,rw->stateSize,rw->delta));
+    swap = rw->current;rw->current = rw->next;rw->next = swap;
+    rw->haveCurrent = TRUE;
+}
+
+//*******************************************************************************************************
+//      Put the machine back to the frame before the last one recorded, returning FALSE if there is
+//      none. That frame is then the last one recorded, so each call goes back a frame.
+//*******************************************************************************************************
+
+BOOL REWIND_StepBack(REWINDBUFFER *rw)
+{
+    REWINDENTRY *e;
+    if (rw->count == 0) return FALSE;
+    e = &rw->entry[(rw->first + rw->count - 1) % rw->maxEntries];                   // Newest difference
+    REWIND_Apply(rw->current,rw->ring + e->offset,e->size);
+    rw->head = e->offset;                                                           // is no longer needed.
+    rw->count--;
+    return CPU_LoadState(rw->cpu,rw->current,rw->stateSize);
+}
+
+//*******************************************************************************************************
+//                                  Number of frames it can step back
+//*******************************************************************************************************
+
+int REWIND_Frames(REWINDBUFFER *rw)
+{
+    return rw->count;
+}
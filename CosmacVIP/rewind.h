@@ -0,0 +1,25 @@
+//*******************************************************************************************************
+//*******************************************************************************************************
+//
+//      Name:       Rewind.H
+//      Purpose:    Rewind buffer header
+//      Date:       17th October 2026
+//
+//*******************************************************************************************************
+//*******************************************************************************************************
+
+#ifndef _REWIND_H
+#define _REWIND_H
+
+#include "cpu.h"
+
+typedef struct _REWIND_BUFFER REWINDBUFFER;
+
+REWINDBUFFER *REWIND_Create(CPU1802MACHINE *cpu,long budget);
+void REWIND_Destroy(REWINDBUFFER *rw);
+void REWIND_Clear(REWINDBUFFER *rw);
+void REWIND_Record(REWINDBUFFER *rw);
+BOOL REWIND_StepBack(REWINDBUFFER *rw);
+int REWIND_Frames(REWINDBUFFER *rw);
+
+#endif // _REWIND_H
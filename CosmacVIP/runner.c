@@ -0,0 +1,354 @@
+//*******************************************************************************************************
+//*******************************************************************************************************
+//
+//      Name:       Runner.C
+//      Purpose:    Headless corpus runner, every ROM on a machine of its own, on all the cores
+//      Date:       17th October 2026
+//
+//*******************************************************************************************************
+//*******************************************************************************************************
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <dirent.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <time.h>
+#include "general.h"
+#include "cpu.h"
+#include "system.h"
+
+// Built on its own (the Runner target), with no SDL. Each .ch8 file runs on a VIP with the CHIP-8
+// interpreter at $0000 and the game at $0200, each .bin on an Elf at $0000, and a Studio 2 runs the
+// games built into its ROM (named Studio2/builtin, there is no file). The keys are pressed in
+// a fixed pattern, half a second at a time, so the games do more than sit on their title screen. Each
+// frame's display is hashed, again only if it might have changed (see CPU_DisplayChanged()), and the
+// hashes chained, and that is checked against the golden file.
+//
+//      runner [options] [files or directories]     (default ../Chip8 ../Transmit ../Miscellany
+//                                                   and the Studio 2)
+//
+//      -frames=n       frames to run each for (3000)
+//      -threads=n      threads to run them on (one a core)
+//      -golden=file    hashes to check against (../Chip8/golden.txt)
+//      -update         write the hashes to the golden file instead
+//      -chip8=file     CHIP-8 interpreter (../Miscellany/chip8.rom)
+//      -studio2        run the Studio 2, with any files given
+//      -jit -hle -hooks    turn on the native paths, which must give the same hashes
+//      -clock=n        run the 1802 n times as fast (see CPU_SetClock()), only checked with -golden
+//
+// It returns 1 if any differ from the golden file. MIPS counts an instruction every 2 cycles, the
+// long branches and skips take 3, so it is a little high.
+
+#define MAX_TASKS       (512)                                                       // Most files run at once
+#define RAM_SIZE        (0x1000)                                                    // 4k, as the VIP had
+#define KEY_FRAMES      (30)                                                        // Frames each key is held for
+#define FNV_PRIME       (16777619UL)                                                // Display hash (32 bit FNV-1a)
+#define FNV_BASIS       (2166136261UL)
+
+typedef struct _RUNNER_TASK
+{
+    char name[256];                                                                 // Directory and file, e.g. Chip8/brix.ch8
+    char path[512];                                                                 // where it was found
+    BYTE8 machine;                                                                  // MACHINE_ it runs on
+    BOOL loaded;                                                                    // Files could be read
+    unsigned long hash;                                                             // Display hashes, chained
+    unsigned long frames;                                                           // Frames run
+    long long cycles;                                                               // 1802 cycles run
+    double seconds;                                                                 // and the time it took
+} RUNNERTASK;
+
+static RUNNERTASK tasks[MAX_TASKS];
+static int taskCount = 0;
+static int nextTask = 0;                                                            // Next one a thread takes
+static pthread_mutex_t taskLock = PTHREAD_MUTEX_INITIALIZER;
+
+static unsigned long frameCount = 3000;
+static const char *chip8Path = "../Miscellany/chip8.rom";
+static BOOL useJit = FALSE,useHle = FALSE,useHooks = FALSE;
+static int clockMultiplier = 1;                                                     // 1802 clock, as a multiple
+
+static __thread unsigned long keyFrame;                                             // Frame this thread's machine is on
+
+//*******************************************************************************************************
+//      The machines' only contact with the host. Nothing waits or makes a sound, and the keys are
+//      the fixed pattern, one key or none down, different every KEY_FRAMES frames.
+//*******************************************************************************************************
+
+BYTE8 SYSTEM_Command(BYTE8 cmd,BYTE8 param)
+{
+    unsigned long n;
+    if (cmd != HWC_READKEYBOARD) return 0;
+    n = ((keyFrame / KEY_FRAMES + 1) * 2654435761UL) & 0xFFFFFFFFUL;
+    return ((n >> 16) % 24) == (param & 0x0F);                                      // 16 keys, or none a third of the time
+}
+
+//*******************************************************************************************************
+//                          Hash the display, the screen being off has one too
+//*******************************************************************************************************
+
+static unsigned long RUN_Hash(const BYTE8 *screen)
+{
+    unsigned long hash = FNV_BASIS;
+    int i;
+    if (screen == NULL) return ((hash ^ 0xFF) * FNV_PRIME) & 0xFFFFFFFFUL;
+    for (i = 0;i < CPU_DISPLAY_LINES*CPU_DISPLAY_BYTES;i++)
+        hash = ((hash ^ screen[i]) * FNV_PRIME) & 0xFFFFFFFFUL;
+    return hash;
+}
+
+//*******************************************************************************************************
+//                                  Load a file into memory, FALSE if it can't
+//*******************************************************************************************************
+
+static BOOL RUN_Load(CPU1802MACHINE *cpu,const char *path,WORD16 address)
+{
+    BYTE8 buffer[RAM_SIZE];
+    FILE *f = fopen(path,"rb");
+    size_t i,size;
+    if (f == NULL) return FALSE;
+    size = fread(buffer,1,sizeof(buffer),f);
+    fclose(f);
+    for (i = 0;i < size;i++) CPU_WriteMemory(cpu,address+i,buffer[i]);
+    return TRUE;
+}
+
+//*******************************************************************************************************
+//                                      Host time in seconds
+//*******************************************************************************************************
+
+static double RUN_Time(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC,&t);
+    return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+//*******************************************************************************************************
+//                                  Run one file on a machine of its own
+//*******************************************************************************************************
+
+static void RUN_Task(RUNNERTASK *task)
+{
+    CPU1802MACHINE *cpu = CPU_Create(task->machine,RAM_SIZE);
+    unsigned long frameHash = 0,hashedFrame,cycleCount,lastCount;
+    double start;
+    if (cpu == NULL) return;
+    if (task->machine == MACHINE_COSMACVIP)
+        task->loaded = RUN_Load(cpu,chip8Path,0x0000) && RUN_Load(cpu,task->path,0x0200);
+    else if (task->machine == MACHINE_STUDIO2)
+        task->loaded = TRUE;                                                        // All in ROM
+    else
+        task->loaded = RUN_Load(cpu,task->path,0x0000);
+    if (task->loaded)
+    {
+        CPU_SetClock(cpu,(WORD16)clockMultiplier);
+        if (useJit) CPU_SetJit(cpu,TRUE);
+        if (useHle) { CPU_SetChip8(cpu,TRUE);CPU_SetStudio2(cpu,TRUE); }
+        if (useHooks) CPU_SetHooks(cpu,TRUE);
+        task->hash = FNV_BASIS;
+        hashedFrame = CPU_ReadFrameCount(cpu);                                      // Changed since, as it has been reset
+        lastCount = CPU_ReadCycleCount(cpu);
+        start = RUN_Time();
+        for (keyFrame = 0;keyFrame < frameCount;keyFrame++)
+        {
+            while (CPU_Run(cpu,CPU_RUN_UNLIMITED) != CPU_STOP_FRAME) {}             // No break point, so a whole frame
+            if (CPU_DisplayChanged(cpu,hashedFrame))                                // Otherwise the hash is as it was
+            {
+                frameHash = RUN_Hash(CPU_GetScreenMemoryAddress(cpu));
+                hashedFrame = CPU_ReadFrameCount(cpu);
+            }
+            task->hash = ((task->hash ^ frameHash) * FNV_PRIME) & 0xFFFFFFFFUL;
+            cycleCount = CPU_ReadCycleCount(cpu);                                   // Added up a frame at a time, as
+            task->cycles += (unsigned long)(cycleCount - lastCount);                // the count wraps (32 bits on Win64)
+            lastCount = cycleCount;
+        }
+        task->seconds = RUN_Time() - start;
+        task->frames = frameCount;
+    }
+    CPU_Destroy(cpu);
+}
+
+//*******************************************************************************************************
+//                          Each thread takes the next file to run until none are left
+//*******************************************************************************************************
+
+static void *RUN_Thread(void *unused)
+{
+    int n;
+    (void)unused;
+    for (;;)
+    {
+        pthread_mutex_lock(&taskLock);
+        n = nextTask++;
+        pthread_mutex_unlock(&taskLock);
+        if (n >= taskCount) return NULL;
+        RUN_Task(&tasks[n]);
+    }
+}
+
+//*******************************************************************************************************
+//          Add a file to run, named by its directory and name. Only .ch8 and .bin files are run.
+//*******************************************************************************************************
+
+static void RUN_AddFile(const char *path)
+{
+    const char *ext = strrchr(path,'.');
+    const char *name = path + strlen(path);
+    RUNNERTASK *task;
+    int slashes = 0;
+    if (ext == NULL || taskCount >= MAX_TASKS) return;
+    if (strcmp(ext,".ch8") != 0 && strcmp(ext,".bin") != 0) return;
+    while (name > path && slashes < 2)                                              // Back to the start of the directory
+    {
+        name--;
+        if (*name == '/' || *name == '\\') slashes++;
+    }
+    if (slashes == 2) name++;
+    while (*name == '.' || *name == '/' || *name == '\\') name++;
+    task = &tasks[taskCount++];
+    memset(task,0,sizeof(RUNNERTASK));
+    strncpy(task->path,path,sizeof(task->path)-1);
+    strncpy(task->name,name,sizeof(task->name)-1);
+    task->machine = (strcmp(ext,".ch8") == 0) ? MACHINE_COSMACVIP : MACHINE_ELF;
+}
+
+//*******************************************************************************************************
+//                              Add the Studio 2, which runs the games in its ROM
+//*******************************************************************************************************
+
+static void RUN_AddStudio2(void)
+{
+    RUNNERTASK *task;
+    if (taskCount >= MAX_TASKS) return;
+    task = &tasks[taskCount++];
+    memset(task,0,sizeof(RUNNERTASK));
+    strcpy(task->name,"Studio2/builtin");
+    task->machine = MACHINE_STUDIO2;
+}
+
+//*******************************************************************************************************
+//                                  Add a file, or every file in a directory
+//*******************************************************************************************************
+
+static void RUN_Add(const char *path)
+{
+    char file[512];
+    struct dirent *entry;
+    DIR *dir = opendir(path);
+    if (dir == NULL)
+    {
+        RUN_AddFile(path);
+        return;
+    }
+    while ((entry = readdir(dir)) != NULL)
+    {
+        snprintf(file,sizeof(file),"%s/%s",path,entry->d_name);
+        RUN_AddFile(file);
+    }
+    closedir(dir);
+}
+
+static int RUN_Compare(const void *a,const void *b)
+{
+    return strcmp(((const RUNNERTASK *)a)->name,((const RUNNERTASK *)b)->name);
+}
+
+//*******************************************************************************************************
+//          Find a file's hash in the golden file, FALSE if it is not there for this many frames
+//*******************************************************************************************************
+
+static BOOL RUN_Golden(FILE *golden,const RUNNERTASK *task,unsigned long *hash)
+{
+    char line[512],name[256];
+    unsigned long frames;
+    if (golden == NULL) return FALSE;
+    rewind(golden);
+    while (fgets(line,sizeof(line),golden) != NULL)
+    {
+        if (sscanf(line,"%lx %lu %255[^\r\n]",hash,&frames,name) == 3 &&
+                                    frames == task->frames && strcmp(name,task->name) == 0) return TRUE;
+    }
+    return FALSE;
+}
+
+//*******************************************************************************************************
+//                                              Main Program
+//*******************************************************************************************************
+
+int main(int argc,char *argv[])
+{
+    const char *goldenPath = NULL;
+    BOOL update = FALSE,anyFiles = FALSE;
+    int i,threads = (int)sysconf(_SC_NPROCESSORS_ONLN),failed = 0,fresh = 0;
+    pthread_t *pool;
+    FILE *golden;
+    unsigned long hash;
+    double start,seconds,frames = 0;
+    long long cycles = 0;
+    const char *status;
+
+    for (i = 1;i < argc;i++)
+    {
+        if (strncmp(argv[i],"-frames=",8) == 0) frameCount = strtoul(argv[i]+8,NULL,10);
+        else if (strncmp(argv[i],"-threads=",9) == 0) threads = atoi(argv[i]+9);
+        else if (strncmp(argv[i],"-golden=",8) == 0) goldenPath = argv[i]+8;
+        else if (strncmp(argv[i],"-chip8=",7) == 0) chip8Path = argv[i]+7;
+        else if (strncmp(argv[i],"-clock=",7) == 0) clockMultiplier = atoi(argv[i]+7);
+        else if (strcmp(argv[i],"-update") == 0) update = TRUE;
+        else if (strcmp(argv[i],"-jit") == 0) useJit = TRUE;
+        else if (strcmp(argv[i],"-hle") == 0) useHle = TRUE;
+        else if (strcmp(argv[i],"-hooks") == 0) useHooks = TRUE;
+        else if (strcmp(argv[i],"-studio2") == 0) { RUN_AddStudio2();anyFiles = TRUE; }
+        else if (argv[i][0] == '-') exit(fprintf(stderr,"Unknown option %s\n",argv[i]));
+        else { RUN_Add(argv[i]);anyFiles = TRUE; }
+    }
+    if (!anyFiles)
+    {
+        RUN_Add("../Chip8");RUN_Add("../Transmit");RUN_Add("../Miscellany");
+        RUN_AddStudio2();
+    }
+    if (taskCount == 0) exit(fprintf(stderr,"Nothing to run\n"));
+    if (clockMultiplier < 1 || clockMultiplier > CPU_CLOCK_MAX) exit(fprintf(stderr,"Clock must be 1 to %d\n",CPU_CLOCK_MAX));
+    if (goldenPath == NULL && clockMultiplier == 1) goldenPath = "../Chip8/golden.txt"; // Hashes at the real clock
+    if (goldenPath == NULL && update) exit(fprintf(stderr,"Give a -golden file for another clock\n"));
+    qsort(tasks,taskCount,sizeof(RUNNERTASK),RUN_Compare);
+    if (threads < 1) threads = 1;
+    if (threads > taskCount) threads = taskCount;
+
+    start = RUN_Time();                                                             // Run them all
+    pool = (pthread_t *)malloc(threads * sizeof(pthread_t));
+    for (i = 0;i < threads;i++) pthread_create(&pool[i],NULL,RUN_Thread,NULL);
+    for (i = 0;i < threads;i++) pthread_join(pool[i],NULL);
+    free(pool);
+    seconds = RUN_Time() - start;
+
+    golden = (goldenPath != NULL) ? fopen(goldenPath,update ? "w" : "r") : NULL;
+    if (update && golden == NULL) exit(fprintf(stderr,"Cannot write %s\n",goldenPath));
+    for (i = 0;i < taskCount;i++)                                                   // Report each one
+    {
+        RUNNERTASK *task = &tasks[i];
+        if (!task->loaded)
+        {
+            printf("LOAD  %-8s %10s   %s\n","","",task->name);
+            failed++;
+            continue;
+        }
+        if (update)
+        {
+            fprintf(golden,"%08lx %lu %s\n",task->hash,task->frames,task->name);
+            status = "SAVED";
+        }
+        else if (!RUN_Golden(golden,task,&hash)) { status = "NEW";fresh++; }
+        else if (hash != task->hash) { status = "DIFF";failed++; }
+        else status = "OK";
+        printf("%-5s %08lx %10.0f fps %s\n",status,task->hash,task->frames / task->seconds,task->name);
+        cycles += task->cycles;
+        frames += task->frames;
+    }
+    if (golden != NULL) fclose(golden);
+    printf("%d files, %d threads, %.0f frames in %.2fs : %.0f fps, %.1f MIPS, %d differ, %d new\n",
+                taskCount,threads,frames,seconds,frames / seconds,(double)cycles / 2 / seconds / 1e6,failed,fresh);
+    return (failed != 0) ? 1 : 0;
+}
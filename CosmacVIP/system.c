@@ -12,18 +12,31 @@
 #include "general.h"
 #include "hardware.h"
 #include "system.h"
+#include "movie.h"
+#include "pace.h"
 
 //*******************************************************************************************************
 //                                      Hardware interface
 //*******************************************************************************************************
 
-#ifdef IS_COSMACVIP
-static char *keys = "X123QWEASDZC4RFV";                                             // Map ASCII keys -> VIP keys
-#else
 static char *keys = "0123456789ABCDEF";                                             // ELF just use 0-9 A-F as the keypad varies.
-#endif
 
-static int nextTime = 0;                                                            // Time of next frame end
+static BOOL headless = FALSE;                                                       // Frames being run only to be thrown away
+
+void SYSTEM_SetMachine(BYTE8 machine)
+{
+    if (machine == MACHINE_COSMACVIP) keys = "X123QWEASDZC4RFV";                    // Map ASCII keys -> VIP keys
+}
+
+//*******************************************************************************************************
+//      Run without the host, for frames that are not shown (see DBG_RunAhead()). They do not wait
+//      for the frame time and make no sound, the keys are still read.
+//*******************************************************************************************************
+
+void SYSTEM_SetHeadless(BOOL isHeadless)
+{
+    headless = isHeadless;
+}
 
 BYTE8 SYSTEM_Command(BYTE8 cmd,BYTE8 param)
 {
@@ -31,17 +44,18 @@ BYTE8 SYSTEM_Command(BYTE8 cmd,BYTE8 param)
     switch(cmd)
     {
         case HWC_READKEYBOARD:                                                      // Command 0 : read keyboard status - 0-15 or 0xFF
-            retVal = IF_KeyPressed(keys[param & 0x0F]);
+            retVal = MOVIE_KeyPressed(keys[param & 0x0F]);
             break;
         case HWC_UPDATEQ:                                                           // Command 1 : update Q
-            IF_SetSound(param != 0);
+            if (!headless) IF_SetSound(param != 0);
             break;
         case HWC_FRAMESYNC:
-            while (nextTime > IF_GetTime()) {}                                      // Command 2 : Synchronise to 60Hz.
-            nextTime = IF_GetTime()+1000/60;
+            if (headless) break;
+            if (MOVIE_Frame()) break;                                               // Movies play back flat out
+            PACE_Wait();                                                            // Command 2 : Synchronise to 60Hz.
             break;
         case HWC_READIKEY:                                                          // Command 4 : Read I Key Status.
-            retVal = IF_KeyPressed('I');
+            retVal = MOVIE_KeyPressed('I');
             break;
         case HWC_UPDATELED:                                                         // Command 5 : Update 2 Digit LED Display (ELF)
             break;
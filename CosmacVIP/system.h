@@ -20,5 +20,7 @@
 #define HWC_SETKEYPAD           (5)
 
 BYTE8 SYSTEM_Command(BYTE8 cmd,BYTE8 param);
+void SYSTEM_SetMachine(BYTE8 machine);
+void SYSTEM_SetHeadless(BOOL isHeadless);
 
 #endif // _SYSTEM_H
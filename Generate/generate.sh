@@ -1,3 +1,4 @@
 python2 process.py
 python2 binaryconv.py
+python2 staticrom.py
 cp *.h ../Miscellany/*.h ../CosmacVIP
@@ -67,4 +67,33 @@ for i in range(0,256):
 	codefile.write("    "+code[i]+"\n")
 	codefile.write("    break;\n")
 
+#
+#	Direct threaded version of the same code. Each handler ends in DISPATCH() which fetches and jumps
+#	to the next handler itself, using the GCC labels-as-values table in cpu1802dispatch.h
+#
+codefile = open("cpu1802threaded.h","w")
+codefile.write("/* GENERATED */\n\n")
+for i in range(0,256):
+	codefile.write("_op{0:02x}: /* {1} */\n".format(i,mnemonics[i]))
+	codefile.write("    "+code[i]+"\n")
+	codefile.write("    DISPATCH();\n")
+
+open("cpu1802dispatch.h","w").write("/* GENERATED */\n\n"+",".join(["&&_op{0:02x}".format(i) for i in range(0,256)]))
+
+#
+#	Decode information for the block cache, one byte per opcode. Bits 0-1 are the number of operand
+#	bytes, bit 2 is set if it takes an extra cycle, bit 3 if it changes P and bit 4 if it writes memory.
+#
+decode = [0] * 256
+for i in range(0,256):
+	n = code[i].count("FETCH2()") + 2 * code[i].count("FETCH3()")
+	n = n + 4 * code[i].count("Cycles--")
+	if re.search("RETURN\\(|\\bP = ",code[i]) is not None:
+		n = n + 8
+	if code[i].find("WRITE(") >= 0:
+		n = n + 16
+	decode[i] = "0x{0:02x}".format(n)
+
+open("cpu1802decode.h","w").write("/* GENERATED */\n\n"+",".join(decode))
+
 print "Generated source successfully."
\ No newline at end of file
@@ -0,0 +1,283 @@
+#
+#	Ahead of time compiler for the built in ROM images.
+#
+#	Traces the code reachable in each image and writes cpu1802static.h, which has a labelled C block
+#	for each basic block built from the same per opcode code as cpu1802.h, with the operands already
+#	filled in. cpucore.h includes it in the run loop, which jumps into it whenever R[P] is the start
+#	of one of these blocks. Each instruction starts with STATIC_FETCH(opcode), where the display loop
+#	fetches the lines due before one that could tell (see cpucore.h). Must be run after process.py
+#	(it reads cpu1802.h) ; see generate.sh
+#
+import re,sys
+from binaryconv import loadImage
+
+#
+#	Images to compile. Entries are where code is known to start, isRAM is set if the image is loaded
+#	into RAM, where it has to be checked before it is run. Tables are the instruction jump tables of
+#	the interpreters, (high bytes, low bytes, first entry, entries) ; the handlers are only reached
+#	through these so cannot be traced otherwise. Hooks are where the run loop may take over (see
+#	STATIC_HOOK() in cpucore.h), the CHIP-8 fetch loop and the DXYN drawing after the interrupt, and
+#	the Studio 2 BIOS fetch loop. Routines are the same for the ROM routines run natively when hooks
+#	are on (STATIC_ROUTINE(), see cpuhooks.h).
+#
+images = [
+	{ "name":"monitor", "machine":"IS_COSMACVIP", "file":"monitor.rom", "fudge":1, "base":0x8000, "isRAM":False,
+																"entries":[0x8000,0x800A], "tables":[], "routines":[0x8012] },
+	{ "name":"chip8",   "machine":"IS_COSMACVIP", "file":"chip8.rom",   "fudge":0, "base":0x0000, "isRAM":True,
+																"entries":[0x0000], "tables":[(0x0050,0x0060,1,15)], "hooks":[0x001B,0x00AD],
+																"routines":[0x00AD,0x00E5] },
+	{ "name":"studio2", "machine":"IS_STUDIO2",   "file":"studio2.rom", "fudge":2, "base":0x0000, "isRAM":False,
+																"entries":[0x0000], "tables":[(0x00E0,0x00F0,1,15)], "hooks":[0x006B], "routines":[0x0100] }
+]
+
+#
+#	Load the C for each opcode from the generated cpu1802.h
+#
+code = [""] * 256
+mnemonics = [""] * 256
+for m in re.finditer("case 0x([0-9a-f]{2}): /\\* (.*?) \\*/\\n    (.*)\\n    break;",open("cpu1802.h").read()):
+	code[int(m.group(1),16)] = m.group(3)
+	mnemonics[int(m.group(1),16)] = m.group(2)
+
+def length(op):																	# Bytes taken by an instruction
+	return 1 + code[op].count("FETCH2()") + 2 * code[op].count("FETCH3()")
+
+def cycles(op):																	# Cycles taken by an instruction
+	return 2 + code[op].count("Cycles--")
+
+def changesR(op):																# True if it changes any of R0-RF
+	return re.search("R\\[[^\\]]+\\](\\+\\+|--|\\s*[-+]?=[^=])",code[op]) is not None
+
+def writes(op):																	# True if it writes memory
+	return code[op].find("WRITE(") >= 0
+
+#
+#	Where an instruction can go next. Returns a list of addresses, None if it cannot be known (change
+#	of P). R[P] has been moved past the operand when a short branch is taken, so it uses that page.
+#
+def successors(op,addr,operand):
+	after = (addr + length(op)) & 0xFFFF
+	if op == 0x00:																	# IDL repeats itself
+		return [addr]
+	if (op & 0xF0) == 0xD0 or op == 0x70 or op == 0x71:								# SEP, RET, DIS
+		return None
+	if op == 0x30:																	# BR
+		return [(after & 0xFF00) | operand]
+	if (op & 0xF0) == 0x30:															# Short branches and SKP
+		return [after] if op == 0x38 else [after,(after & 0xFF00) | operand]
+	if op == 0xC0:																	# LBR
+		return [operand]
+	if op in [0xC1,0xC2,0xC3,0xC9,0xCA,0xCB]:										# Long branches
+		return [after,operand]
+	if op == 0xC8:																	# LSKP
+		return [after]
+	if op in [0xC5,0xC6,0xC7,0xCC,0xCD,0xCE,0xCF]:									# Long skips
+		return [after,(after + 2) & 0xFFFF]
+	return [after]
+
+def isControl(op):																# True if an instruction ends a block
+	return op == 0x00 or (op & 0xF0) == 0x30 or (op & 0xF0) == 0xD0 or op == 0x70 or op == 0x71 or \
+			(op & 0xF0) == 0xC0 and op != 0xC4
+
+#
+#	Compiles one image
+#
+class StaticImage:
+	def __init__(self,info):
+		self.info = info
+		self.name = info["name"]
+		self.base = info["base"]
+		self.image = loadImage(info["file"],info["fudge"])
+		self.instructions = {}														# address -> (opcode,operand)
+		self.leaders = {}															# addresses starting blocks
+
+	def read(self,addr):														# Byte in image, None if outside
+		addr = addr - self.base
+		return self.image[addr] if addr >= 0 and addr < len(self.image) else None
+
+	def decode(self,addr):														# Decode instruction, None if off the end
+		op = self.read(addr)
+		if op is None:
+			return None
+		operand = 0
+		for n in range(1,length(op)):
+			b = self.read(addr+n)
+			if b is None:
+				return None
+			operand = (operand << 8) | b
+		return (op,operand)
+	#
+	#	Follow every path from the entry points. Code after a change of P is also followed, as 1802
+	#	subroutines return to it (and usually start just after the SEP that leaves them), as is any
+	#	address put together in a register with LDI / PHI / LDI / PLO.
+	#
+	def trace(self):
+		pending = list(self.info["entries"])
+		for hiTable,loTable,first,count in self.info["tables"]:
+			for n in range(first,first+count):
+				pending.append((self.read(hiTable+n) << 8) | self.read(loTable+n))
+		pending = pending + self.info.get("hooks",[]) + self.info.get("routines",[])
+		for a in pending:
+			self.leaders[a] = True
+		while len(pending) > 0:
+			addr = pending.pop()
+			known = {}															# LDI values put into registers
+			dValue = None
+			while addr not in self.instructions:
+				instruction = self.decode(addr)
+				if instruction is None:
+					break
+				self.instructions[addr] = instruction
+				op,operand = instruction
+				if op == 0xF8:
+					dValue = operand
+				elif (op & 0xE0) == 0xA0 and dValue is not None:					# PLO / PHI of a known value
+					r = op & 0x0F
+					lo,hi = known.get(r,(None,None))
+					known[r] = (dValue,hi) if op < 0xB0 else (lo,dValue)
+					if None not in known[r]:
+						self.addEntry((known[r][1] << 8) | known[r][0],pending)
+				else:
+					dValue = None
+				nextAddr = successors(op,addr,operand)
+				if nextAddr is None:												# New P, carry on after it
+					self.addEntry(addr+length(op),pending)
+					break
+				if isControl(op):
+					for a in nextAddr:
+						self.addEntry(a,pending)
+					break
+				addr = nextAddr[0]
+				if addr in self.leaders:
+					break
+
+	def addEntry(self,addr,pending):
+		addr = addr & 0xFFFF
+		if self.decode(addr) is not None:
+			if addr not in self.leaders:
+				self.leaders[addr] = True
+				pending.append(addr)
+	#
+	#	Split into basic blocks, each starting at a leader and ending at a control instruction, at an
+	#	instruction that is not traced, or before the next leader.
+	#
+	def blocks(self):
+		for addr in self.instructions.keys():
+			op,operand = self.instructions[addr]
+			nextAddr = successors(op,addr,operand)
+			if nextAddr is not None and isControl(op):
+				for a in nextAddr:
+					if a in self.instructions:
+						self.leaders[a] = True
+		blocks = []
+		for start in sorted(self.leaders.keys()):
+			if start not in self.instructions:
+				continue
+			addr = start
+			block = []
+			while True:
+				op,operand = self.instructions[addr]
+				block.append(addr)
+				nextAddr = successors(op,addr,operand)
+				if nextAddr is None or isControl(op):
+					break
+				addr = nextAddr[0]
+				if addr in self.leaders or addr not in self.instructions:
+					break
+			blocks.append(block)
+		return blocks
+	#
+	#	C for a jump to addr, straight to its block if there is one
+	#
+	def jump(self,addr,labels):
+		return "goto _s{0:04x};".format(addr) if addr in labels else "goto staticDispatch;"
+
+	def render(self):
+		self.trace()
+		blocks = self.blocks()
+		labels = {}
+		for b in blocks:
+			labels[b[0]] = True
+		out = []
+		for b in blocks:
+			out.append("_s{0:04x}:".format(b[0]))
+			if b[0] in self.info.get("hooks",[]):
+				out.append("    STATIC_HOOK();")
+			if b[0] in self.info.get("routines",[]):
+				out.append("    STATIC_ROUTINE();")
+			total = sum([cycles(self.instructions[a][0]) for a in b])
+			out.append("    if (Cycles - {0} < limit) goto staticLeave;".format(total))
+			for addr in b:
+				op,operand = self.instructions[addr]
+				after = (addr + length(op)) & 0xFFFF
+				c = code[op].replace("FETCH2()","0x{0:02x}".format(operand))
+				c = c.replace("FETCH3()","{{ _temp = 0x{0:04x}; }}".format(operand))
+				out.append("    STATIC_FETCH(0x{4:02x});Cycles -= 2;R[P] = 0x{0:04x};{1} /* {2:04x} {3} */".format(after,c,addr,mnemonics[op],op))
+				nextAddr = successors(op,addr,operand)
+				if nextAddr is None:
+					out.append("    goto staticDispatch;")
+				elif isControl(op):
+					if len(nextAddr) > 1 and nextAddr[0] != nextAddr[1]:
+						out.append("    if (R[P] == 0x{0:04x}) {1}".format(nextAddr[1],self.jump(nextAddr[1],labels)))
+					out.append("    "+self.jump(nextAddr[0],labels))
+				else:
+					if changesR(op):												# Stop if it was R[P]
+						out.append("    if (R[P] != 0x{0:04x}) goto staticDispatch;".format(after))
+					if writes(op) and self.info["isRAM"]:							# or it changed this code
+						out.append("    if (cpu->staticRam != STATIC_VALID) goto staticDispatch;")
+					if addr == b[-1]:
+						out.append("    "+self.jump(after,labels))
+		return (blocks,out)
+	#
+	#	Dispatch from R[P] to the blocks. RAM images are checked against the image first.
+	#
+	def dispatch(self,blocks):
+		out = []
+		self.data = []
+		cases = ["        case 0x{0:04x}: goto _s{0:04x};".format(b[0]) for b in blocks]
+		if self.info["isRAM"]:
+			ranges = []
+			for addr in sorted(self.instructions.keys()):
+				end = addr + length(self.instructions[addr][0])
+				if len(ranges) > 0 and ranges[-1][1] >= addr:
+					ranges[-1][1] = max(ranges[-1][1],end)
+				else:
+					ranges.append([addr,end])
+			data = ",".join(["0x{0:04x},{1}".format(r[0],r[1]-r[0]) for r in ranges])
+			self.data = [ "    static const WORD16 _ranges_{0}[] = {{ {1},0,0 }};".format(self.name,data),
+						  "    static const BYTE8 _image_{0}[] = {{ {1} }};".format(self.name,",".join([str(b) for b in self.image])) ]
+			out.append("    if (R[P] >= 0x{0:04x} && R[P] < 0x{1:04x} && STATIC_RAM_OK(_image_{2},0x{0:04x},_ranges_{2})) switch (R[P])". \
+															format(self.base,self.base+len(self.image),self.name))
+		else:
+			out.append("    switch (R[P])")
+		out.append("    {")
+		out = out + cases
+		out.append("    }")
+		return out
+
+#
+#	Write the code for each machine, each one a dispatch then the blocks of all its images
+#
+machines = []
+for info in images:
+	if info["machine"] not in machines:
+		machines.append(info["machine"])
+
+h = open("cpu1802static.h","w")
+h.write("/* GENERATED */\n\n")
+for machine in machines:
+	compiled = [StaticImage(info) for info in images if info["machine"] == machine]
+	rendered = [c.render() for c in compiled]
+	dispatch = [c.dispatch(r[0]) for c,r in zip(compiled,rendered)]
+	h.write("#ifdef {0}\n".format(machine))
+	for c in compiled:
+		h.write("".join([x+"\n" for x in c.data]))
+	h.write("staticDispatch:\n")
+	for d in dispatch:
+		h.write("\n".join(d)+"\n")
+	h.write("    goto staticLeave;\n")
+	for i in range(0,len(compiled)):
+		h.write("\n".join(rendered[i][1])+"\n")
+		sys.stdout.write("{0}: {1} instructions in {2} blocks.\n".format(compiled[i].name,len(compiled[i].instructions),len(rendered[i][0])))
+	h.write("#endif\n\n")
+h.close()